@@ -10,3 +10,5 @@ double Activation::ArcTan::df(double x) const
 {
     return 1.0 / (1.0 + (x * x));
 }
+
+template class Activation::ScalarActivationImpl<Activation::ArcTan>;
@@ -0,0 +1,234 @@
+#include "Attention.h"
+
+// ========================================
+// [Private] Layout & Validation Method(s)
+// ========================================
+Attention::Layout Attention::ResolveLayout(const Tensor& _query, const Tensor& _key, const Tensor& _value)
+{
+	if (_query.IsEmpty() || _key.IsEmpty() || _value.IsEmpty())
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: operands must not be empty.");
+	}
+
+	if (_query.Rank() < 2 || _key.Rank() != _query.Rank() || _value.Rank() != _query.Rank())
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: query, key and value must have the same rank (>= 2).");
+	}
+
+	std::vector<int> query_shape = _query.Shape();
+	std::vector<int> key_shape = _key.Shape();
+	std::vector<int> value_shape = _value.Shape();
+
+	int rank = _query.Rank();
+
+	if (!std::equal(query_shape.begin(), query_shape.end() - 2, key_shape.begin())
+		|| !std::equal(query_shape.begin(), query_shape.end() - 2, value_shape.begin()))
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: leading (batch) dimensions must match.");
+	}
+
+	if (key_shape[rank - 1] != query_shape[rank - 1])
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: query and key depths must match.");
+	}
+
+	if (value_shape[rank - 2] != key_shape[rank - 2])
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: key and value lengths must match.");
+	}
+
+	Layout layout;
+
+	for (int i = 0; i < rank - 2; i++)
+	{
+		layout.batch *= query_shape[i];
+	}
+
+	layout.query_length = query_shape[rank - 2];
+	layout.key_length = key_shape[rank - 2];
+	layout.depth = query_shape[rank - 1];
+	layout.value_depth = value_shape[rank - 1];
+
+	return layout;
+}
+
+// ========================================
+// [Private] Kernel Method(s)
+// ========================================
+// Rows [_query_begin, _query_end) of one batch entry. _scratch holds the
+// score tile, the running max and denominator per row and the unnormalized
+// output rows: QUERY_BLOCK * (KEY_BLOCK + 2 + value_depth) doubles.
+//
+// Per key tile and row: m' = max(m, max_j s_j); the previous denominator and
+// accumulator are rescaled by exp(m - m'), then p_j = exp(s_j - m') is added
+// to the denominator and p_j * v_j to the accumulator. Dividing by the
+// denominator at the end gives exactly softmax(s) V.
+void Attention::QueryBlock(const double* _query, const double* _key, const double* _value, double* _output, const Layout& _layout, const int& _query_begin, const int& _query_end, const bool& _causal, const double& _scale, const FastMath::Precision& _precision, double* _scratch)
+{
+	const int rows = _query_end - _query_begin;
+	const int depth = _layout.depth;
+	const int value_depth = _layout.value_depth;
+	const int causal_offset = _layout.key_length - _layout.query_length;
+
+	double* scores = _scratch;
+	double* row_max = scores + (Attention::QUERY_BLOCK * Attention::KEY_BLOCK);
+	double* row_sum = row_max + Attention::QUERY_BLOCK;
+	double* accumulator = row_sum + Attention::QUERY_BLOCK;
+
+	std::fill(row_max, row_max + rows, -std::numeric_limits<double>::infinity());
+	std::fill(row_sum, row_sum + rows, 0.0);
+	std::fill(accumulator, accumulator + (static_cast<size_t>(rows) * value_depth), 0.0);
+
+	// Tiles past the last row's causal limit are fully masked for the block.
+	int key_end = _layout.key_length;
+	if (_causal)
+	{
+		key_end = std::clamp(_query_end + causal_offset, 0, _layout.key_length);
+	}
+
+	for (int key_begin = 0; key_begin < key_end; key_begin += Attention::KEY_BLOCK)
+	{
+		const int tile = std::min(Attention::KEY_BLOCK, key_end - key_begin);
+
+		for (int i = 0; i < rows; i++)
+		{
+			// Number of keys of this tile visible to the row.
+			int visible = tile;
+			if (_causal)
+			{
+				visible = std::clamp(_query_begin + i + causal_offset + 1 - key_begin, 0, tile);
+			}
+
+			if (visible == 0)
+			{
+				continue;
+			}
+
+			const double* q = _query + (static_cast<size_t>(_query_begin + i) * depth);
+			double* s = scores + (static_cast<size_t>(i) * Attention::KEY_BLOCK);
+
+			double tile_max = -std::numeric_limits<double>::infinity();
+
+			for (int j = 0; j < visible; j++)
+			{
+				const double* k = _key + (static_cast<size_t>(key_begin + j) * depth);
+
+				double dot = 0.0;
+				for (int d = 0; d < depth; d++)
+				{
+					dot += q[d] * k[d];
+				}
+
+				s[j] = dot * _scale;
+				tile_max = std::max(tile_max, s[j]);
+			}
+
+			double new_max = std::max(row_max[i], tile_max);
+			double correction = FastMath::Exp(row_max[i] - new_max, _precision);
+
+			double* acc = accumulator + (static_cast<size_t>(i) * value_depth);
+
+			if (correction != 1.0)
+			{
+				for (int d = 0; d < value_depth; d++)
+				{
+					acc[d] *= correction;
+				}
+			}
+
+			double sum = row_sum[i] * correction;
+
+			for (int j = 0; j < visible; j++)
+			{
+				double p = FastMath::Exp(s[j] - new_max, _precision);
+				const double* v = _value + (static_cast<size_t>(key_begin + j) * value_depth);
+
+				sum += p;
+				for (int d = 0; d < value_depth; d++)
+				{
+					acc[d] += p * v[d];
+				}
+			}
+
+			row_max[i] = new_max;
+			row_sum[i] = sum;
+		}
+	}
+
+	for (int i = 0; i < rows; i++)
+	{
+		const double* acc = accumulator + (static_cast<size_t>(i) * value_depth);
+		double* out = _output + (static_cast<size_t>(_query_begin + i) * value_depth);
+
+		double inverse = (row_sum[i] > 0.0) ? (1.0 / row_sum[i]) : 0.0;
+
+		for (int d = 0; d < value_depth; d++)
+		{
+			out[d] = acc[d] * inverse;
+		}
+	}
+}
+
+// ========================================
+// Scaled Dot-Product Attention Method(s)
+// ========================================
+Tensor Attention::ScaledDotProduct(const Tensor& _query, const Tensor& _key, const Tensor& _value, const bool& _causal, const double& _scale)
+{
+	Tensor output;
+	Attention::ScaledDotProduct(_query, _key, _value, output, _causal, _scale);
+
+	return output;
+}
+
+void Attention::ScaledDotProduct(const Tensor& _query, const Tensor& _key, const Tensor& _value, Tensor& _output, const bool& _causal, const double& _scale)
+{
+	Layout layout = Attention::ResolveLayout(_query, _key, _value);
+
+	if (_query.SharesData(_output) || _key.SharesData(_output) || _value.SharesData(_output))
+	{
+		throw std::invalid_argument("[Attention] Scaled dot-product failed: output must not alias an operand.");
+	}
+
+	std::vector<int> output_shape = _query.Shape();
+	output_shape.back() = layout.value_depth;
+
+	_output.Resize(output_shape);
+
+	double scale = (_scale > 0.0) ? _scale : (1.0 / std::sqrt(static_cast<double>(layout.depth)));
+
+	const double* query = &*_query.begin();
+	const double* key = &*_key.begin();
+	const double* value = &*_value.begin();
+	double* output = &*_output.begin();
+
+	// Resolved once so every worker uses the same exp accuracy.
+	const FastMath::Precision precision = FastMath::GetPrecision();
+
+	const int query_blocks = (layout.query_length + Attention::QUERY_BLOCK - 1) / Attention::QUERY_BLOCK;
+	const int tasks = layout.batch * query_blocks;
+
+	const size_t scratch_size = static_cast<size_t>(Attention::QUERY_BLOCK) * (Attention::KEY_BLOCK + 2 + layout.value_depth);
+
+	// Approximate multiply-adds per task, to keep small problems on one thread.
+	long long task_work = static_cast<long long>(Attention::QUERY_BLOCK) * layout.key_length * (layout.depth + layout.value_depth);
+	int grain = static_cast<int>(std::max(1LL, Attention::GRAIN / std::max(1LL, task_work)));
+
+	Utils::ParallelFor(0, tasks, [&](int begin, int end)
+		{
+			std::vector<double> scratch(scratch_size);
+
+			for (int task = begin; task < end; task++)
+			{
+				int b = task / query_blocks;
+				int query_begin = (task % query_blocks) * Attention::QUERY_BLOCK;
+				int query_end = std::min(query_begin + Attention::QUERY_BLOCK, layout.query_length);
+
+				Attention::QueryBlock(
+					query + (static_cast<size_t>(b) * layout.query_length * layout.depth),
+					key + (static_cast<size_t>(b) * layout.key_length * layout.depth),
+					value + (static_cast<size_t>(b) * layout.key_length * layout.value_depth),
+					output + (static_cast<size_t>(b) * layout.query_length * layout.value_depth),
+					layout, query_begin, query_end, _causal, scale, precision, scratch.data());
+			}
+		}, grain);
+}
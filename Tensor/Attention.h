@@ -0,0 +1,62 @@
+#pragma once
+
+#include "FastMath.h"
+#include "Tensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ========================================
+// Attention Class
+// ========================================
+// Scaled dot-product attention, softmax(Q K^T * scale) V, computed as one
+// streaming kernel. For every (batch, query block) the keys and values are
+// visited in tiles; each tile's scores live only in a small scratch buffer
+// and are folded into the output with the online softmax (running row max,
+// running denominator, rescaled accumulator), so the T x T score matrix is
+// never materialized. Work is split across threads over (batch, query block)
+// pairs.
+//
+// Shapes: query [..., Tq, D], key [..., Tk, D], value [..., Tk, Dv] with
+// identical leading dimensions (e.g. [B, H]); the output is [..., Tq, Dv].
+class Attention
+{
+private:
+    struct Layout
+    {
+        int batch = 1;
+        int query_length = 1;
+        int key_length = 1;
+        int depth = 1;
+        int value_depth = 1;
+    };
+
+    // ========== Constants ==========
+    static constexpr int QUERY_BLOCK = 32;
+    static constexpr int KEY_BLOCK = 64;
+    static constexpr int GRAIN = 1 << 14;
+
+private:
+    static Layout ResolveLayout(const Tensor& _query, const Tensor& _key, const Tensor& _value);
+
+    static void QueryBlock(const double* _query, const double* _key, const double* _value, double* _output, const Layout& _layout, const int& _query_begin, const int& _query_end, const bool& _causal, const double& _scale, const FastMath::Precision& _precision, double* _scratch);
+
+public:
+    // ========================================
+    // Scaled Dot-Product Attention Methods
+    // ========================================
+    // scale <= 0 selects 1 / sqrt(D). With causal = true, query i attends to
+    // keys j <= i + (Tk - Tq), i.e. the mask is aligned to the last key so a
+    // block of new queries can attend over a longer cached key sequence;
+    // query rows that see no key at all (only possible when Tq > Tk) are zero.
+    static Tensor ScaledDotProduct(const Tensor& _query, const Tensor& _key, const Tensor& _value, const bool& _causal = false, const double& _scale = 0.0);
+
+    // Writes into _output (resized if needed); _output must not share storage
+    // with the operands.
+    static void ScaledDotProduct(const Tensor& _query, const Tensor& _key, const Tensor& _value, Tensor& _output, const bool& _causal = false, const double& _scale = 0.0);
+};
@@ -0,0 +1,558 @@
+#include "BandedMatrix.h"
+
+// ========================================
+// [Private] Band Indexing Method(s)
+// ========================================
+size_t LinAlg::BandedMatrix::Index(const int& _row, const int& _col) const
+{
+	return static_cast<size_t>(_row) * this->width + (_col - _row + this->lower);
+}
+
+bool LinAlg::BandedMatrix::InBand(const int& _row, const int& _col) const
+{
+	return (_col - _row >= -this->lower) && (_col - _row <= this->upper);
+}
+
+// ========================================
+// [Private] Factorized Solve Method(s)
+// ========================================
+void LinAlg::BandedMatrix::SolveInPlace(double* _rhs) const
+{
+	int n = this->size;
+	int kl = this->lower;
+	int ku = this->lower + this->upper;
+
+	// Forward sweep: replay the row interchanges and apply the unit-lower multipliers.
+	for (int k = 0; k < n - 1; k++)
+	{
+		int p = this->pivots[k];
+		if (p != k)
+		{
+			std::swap(_rhs[k], _rhs[p]);
+		}
+
+		double b_k = _rhs[k];
+		if (b_k == 0.0)
+		{
+			continue;
+		}
+
+		int last = std::min(n - 1, k + kl);
+		for (int i = k + 1; i <= last; i++)
+		{
+			_rhs[i] -= this->band[this->Index(i, k)] * b_k;
+		}
+	}
+
+	// Back substitution: U has upper bandwidth kl + ku after pivoting.
+	for (int i = n - 1; i >= 0; i--)
+	{
+		const double* row = &this->band[static_cast<size_t>(i) * this->width + kl - i];
+
+		double sum = _rhs[i];
+		int last = std::min(n - 1, i + ku);
+		for (int j = i + 1; j <= last; j++)
+		{
+			sum -= row[j] * _rhs[j];
+		}
+
+		_rhs[i] = sum / row[i];
+	}
+}
+
+bool LinAlg::BandedMatrix::ThomasSweep(const double* _sub, const double* _diag, const double* _super, double* _rhs, double* _c_prime, const int& _n)
+{
+	double denom = _diag[0];
+	if (std::abs(denom) < LinAlg::BandedMatrix::TOLERANCE)
+	{
+		return false;
+	}
+
+	_c_prime[0] = (_n > 1) ? _super[0] / denom : 0.0;
+	_rhs[0] /= denom;
+
+	for (int i = 1; i < _n; i++)
+	{
+		denom = _diag[i] - _sub[i - 1] * _c_prime[i - 1];
+
+		if (std::abs(denom) < LinAlg::BandedMatrix::TOLERANCE)
+		{
+			return false;
+		}
+
+		_c_prime[i] = (i < _n - 1) ? _super[i] / denom : 0.0;
+		_rhs[i] = (_rhs[i] - _sub[i - 1] * _rhs[i - 1]) / denom;
+	}
+
+	for (int i = _n - 2; i >= 0; i--)
+	{
+		_rhs[i] -= _c_prime[i] * _rhs[i + 1];
+	}
+
+	return true;
+}
+
+// ========================================
+// BandedMatrix Constructor(s)
+// ========================================
+LinAlg::BandedMatrix::BandedMatrix(const int& _size, const int& _lower, const int& _upper)
+{
+	if (_size <= 0)
+	{
+		throw std::invalid_argument("[BandedMatrix] Constructor failed: size of a banded matrix must be > 0.");
+	}
+
+	if (_lower < 0 || _upper < 0)
+	{
+		throw std::invalid_argument("[BandedMatrix] Constructor failed: bandwidths must be non-negative.");
+	}
+
+	this->size = _size;
+	this->lower = std::min(_lower, _size - 1);
+	this->upper = std::min(_upper, _size - 1);
+	this->width = 2 * this->lower + this->upper + 1;
+
+	this->band.assign(static_cast<size_t>(this->size) * this->width, 0.0);
+}
+
+LinAlg::BandedMatrix::BandedMatrix(const LinAlg::Matrix& _matrix, const int& _lower, const int& _upper)
+	: BandedMatrix(_matrix.Row(), _lower, _upper)
+{
+	if (!_matrix.IsSquare())
+	{
+		throw std::invalid_argument("[BandedMatrix] Constructor failed: source Matrix must be square.");
+	}
+
+	std::vector<double> flat = _matrix.GetFlatData();
+
+	for (int i = 0; i < this->size; i++)
+	{
+		int first = std::max(0, i - this->lower);
+		int last = std::min(this->size - 1, i + this->upper);
+
+		for (int j = first; j <= last; j++)
+		{
+			this->band[this->Index(i, j)] = flat[static_cast<size_t>(i) * this->size + j];
+		}
+	}
+}
+
+LinAlg::BandedMatrix LinAlg::BandedMatrix::FromMatrix(const LinAlg::Matrix& _matrix, const double& _tolerance)
+{
+	if (_matrix.IsEmpty() || !_matrix.IsSquare())
+	{
+		throw std::invalid_argument("[BandedMatrix] FromMatrix failed: source Matrix must be non-empty and square.");
+	}
+
+	int n = _matrix.Row();
+	std::vector<double> flat = _matrix.GetFlatData();
+
+	int kl = 0;
+	int ku = 0;
+	for (int i = 0; i < n; i++)
+	{
+		for (int j = 0; j < n; j++)
+		{
+			if (std::abs(flat[static_cast<size_t>(i) * n + j]) > _tolerance)
+			{
+				kl = std::max(kl, i - j);
+				ku = std::max(ku, j - i);
+			}
+		}
+	}
+
+	return LinAlg::BandedMatrix(_matrix, kl, ku);
+}
+
+LinAlg::BandedMatrix LinAlg::BandedMatrix::Tridiagonal(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super)
+{
+	int n = static_cast<int>(_diag.size());
+
+	if (n == 0)
+	{
+		throw std::invalid_argument("[BandedMatrix] Tridiagonal construction failed: empty diagonal.");
+	}
+
+	if (static_cast<int>(_sub.size()) != n - 1 || static_cast<int>(_super.size()) != n - 1)
+	{
+		throw std::invalid_argument("[BandedMatrix] Tridiagonal construction failed: off-diagonals must have size n - 1.");
+	}
+
+	LinAlg::BandedMatrix result(n, 1, 1);
+
+	for (int i = 0; i < n; i++)
+	{
+		result.band[result.Index(i, i)] = _diag[i];
+
+		if (i > 0)
+		{
+			result.band[result.Index(i, i - 1)] = _sub[i - 1];
+		}
+
+		if (i < n - 1)
+		{
+			result.band[result.Index(i, i + 1)] = _super[i];
+		}
+	}
+
+	return result;
+}
+
+// ========================================
+// BandedMatrix Property Method(s)
+// ========================================
+int LinAlg::BandedMatrix::Size() const
+{
+	return this->size;
+}
+
+int LinAlg::BandedMatrix::LowerBandwidth() const
+{
+	return this->lower;
+}
+
+int LinAlg::BandedMatrix::UpperBandwidth() const
+{
+	return this->upper;
+}
+
+bool LinAlg::BandedMatrix::IsFactorized() const
+{
+	return this->factorized;
+}
+
+// ========================================
+// BandedMatrix Element Access Method(s)
+// ========================================
+double LinAlg::BandedMatrix::Get(const int& _row, const int& _col) const
+{
+	if (this->factorized)
+	{
+		throw std::runtime_error("[BandedMatrix] Get failed: storage holds LU factors.");
+	}
+
+	if (_row < 0 || _row >= this->size || _col < 0 || _col >= this->size)
+	{
+		throw std::out_of_range("[BandedMatrix] Get failed: index out of bounds.");
+	}
+
+	if (!this->InBand(_row, _col))
+	{
+		return 0.0;
+	}
+
+	return this->band[this->Index(_row, _col)];
+}
+
+void LinAlg::BandedMatrix::Set(const int& _row, const int& _col, const double& _value)
+{
+	if (this->factorized)
+	{
+		throw std::runtime_error("[BandedMatrix] Set failed: storage holds LU factors.");
+	}
+
+	if (_row < 0 || _row >= this->size || _col < 0 || _col >= this->size)
+	{
+		throw std::out_of_range("[BandedMatrix] Set failed: index out of bounds.");
+	}
+
+	if (!this->InBand(_row, _col))
+	{
+		throw std::invalid_argument("[BandedMatrix] Set failed: element lies outside the band.");
+	}
+
+	this->band[this->Index(_row, _col)] = _value;
+}
+
+std::vector<double> LinAlg::BandedMatrix::MatVec(const std::vector<double>& _vector) const
+{
+	if (this->factorized)
+	{
+		throw std::runtime_error("[BandedMatrix] MatVec failed: storage holds LU factors.");
+	}
+
+	if (static_cast<int>(_vector.size()) != this->size)
+	{
+		throw std::invalid_argument("[BandedMatrix] MatVec failed: vector size mismatch.");
+	}
+
+	std::vector<double> result(this->size, 0.0);
+
+	for (int i = 0; i < this->size; i++)
+	{
+		const double* row = &this->band[static_cast<size_t>(i) * this->width + this->lower - i];
+
+		int first = std::max(0, i - this->lower);
+		int last = std::min(this->size - 1, i + this->upper);
+
+		double sum = 0.0;
+		for (int j = first; j <= last; j++)
+		{
+			sum += row[j] * _vector[j];
+		}
+
+		result[i] = sum;
+	}
+
+	return result;
+}
+
+// ========================================
+// BandedMatrix Factorization Method(s)
+// ========================================
+void LinAlg::BandedMatrix::Factorize()
+{
+	if (this->factorized)
+	{
+		return;
+	}
+
+	int n = this->size;
+	int kl = this->lower;
+	int ku = this->lower + this->upper;
+
+	this->pivots.assign(n, 0);
+
+	for (int k = 0; k < n; k++)
+	{
+		int last_row = std::min(n - 1, k + kl);
+		int last_col = std::min(n - 1, k + ku);
+
+		int p = k;
+		double max_value = std::abs(this->band[this->Index(k, k)]);
+		for (int i = k + 1; i <= last_row; i++)
+		{
+			double value = std::abs(this->band[this->Index(i, k)]);
+			if (value > max_value)
+			{
+				max_value = value;
+				p = i;
+			}
+		}
+
+		if (max_value < LinAlg::BandedMatrix::TOLERANCE)
+		{
+			throw std::runtime_error("[BandedMatrix] LU factorization failed: matrix is singular.");
+		}
+
+		this->pivots[k] = p;
+
+		if (p != k)
+		{
+			for (int j = k; j <= last_col; j++)
+			{
+				std::swap(this->band[this->Index(k, j)], this->band[this->Index(p, j)]);
+			}
+		}
+
+		const double* pivot_row = &this->band[static_cast<size_t>(k) * this->width + kl - k];
+		double pivot = pivot_row[k];
+
+		for (int i = k + 1; i <= last_row; i++)
+		{
+			double* row = &this->band[static_cast<size_t>(i) * this->width + kl - i];
+
+			double factor = row[k] / pivot;
+			row[k] = factor;
+
+			if (factor == 0.0)
+			{
+				continue;
+			}
+
+			for (int j = k + 1; j <= last_col; j++)
+			{
+				row[j] -= factor * pivot_row[j];
+			}
+		}
+	}
+
+	this->factorized = true;
+}
+
+// ========================================
+// BandedMatrix Solve Method(s)
+// ========================================
+std::vector<double> LinAlg::BandedMatrix::Solve(const std::vector<double>& _rhs) const
+{
+	if (static_cast<int>(_rhs.size()) != this->size)
+	{
+		throw std::invalid_argument("[BandedMatrix] Solve failed: right-hand side size mismatch.");
+	}
+
+	std::vector<double> result = _rhs;
+
+	if (this->factorized)
+	{
+		this->SolveInPlace(result.data());
+		return result;
+	}
+
+	LinAlg::BandedMatrix lu = *this;
+	lu.Factorize();
+	lu.SolveInPlace(result.data());
+
+	return result;
+}
+
+LinAlg::Matrix LinAlg::BandedMatrix::Solve(const LinAlg::Matrix& _rhs) const
+{
+	if (_rhs.Row() != this->size)
+	{
+		throw std::invalid_argument("[BandedMatrix] Solve failed: right-hand side row-count mismatch.");
+	}
+
+	const LinAlg::BandedMatrix* lu = this;
+	LinAlg::BandedMatrix factored;
+
+	if (!this->factorized)
+	{
+		factored = *this;
+		factored.Factorize();
+		lu = &factored;
+	}
+
+	int n = this->size;
+	int n_rhs = _rhs.Column();
+
+	std::vector<double> flat = _rhs.GetFlatData();
+	std::vector<double> result(flat.size());
+
+	// Columns are independent once the factors are shared; solve them across threads.
+	Utils::ParallelFor(0, n_rhs, [&](int begin, int end)
+		{
+			std::vector<double> column(n);
+
+			for (int c = begin; c < end; c++)
+			{
+				for (int i = 0; i < n; i++)
+				{
+					column[i] = flat[static_cast<size_t>(i) * n_rhs + c];
+				}
+
+				lu->SolveInPlace(column.data());
+
+				for (int i = 0; i < n; i++)
+				{
+					result[static_cast<size_t>(i) * n_rhs + c] = column[i];
+				}
+			}
+		});
+
+	return LinAlg::Matrix({ n, n_rhs }, result);
+}
+
+void LinAlg::BandedMatrix::ThomasSolve(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super, std::vector<double>& _rhs)
+{
+	int n = static_cast<int>(_diag.size());
+
+	if (n == 0)
+	{
+		throw std::invalid_argument("[BandedMatrix] Thomas Solve failed: empty diagonal.");
+	}
+
+	if (static_cast<int>(_sub.size()) != n - 1 || static_cast<int>(_super.size()) != n - 1 || static_cast<int>(_rhs.size()) != n)
+	{
+		throw std::invalid_argument("[BandedMatrix] Thomas Solve failed: off-diagonals must have size n - 1 and right-hand side size n.");
+	}
+
+	std::vector<double> c_prime(n);
+
+	if (!LinAlg::BandedMatrix::ThomasSweep(_sub.data(), _diag.data(), _super.data(), _rhs.data(), c_prime.data(), n))
+	{
+		throw std::runtime_error("[BandedMatrix] Thomas Solve failed: zero pivot encountered (use banded LU for non-dominant systems).");
+	}
+}
+
+void LinAlg::BandedMatrix::BatchedThomasSolve(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super, std::vector<double>& _rhs, const int& _batch)
+{
+	if (_batch <= 0 || _diag.empty() || _diag.size() % _batch != 0)
+	{
+		throw std::invalid_argument("[BandedMatrix] Batched Thomas Solve failed: diagonal must hold batch * n values with batch, n > 0.");
+	}
+
+	int n = static_cast<int>(_diag.size() / _batch);
+	size_t off_total = static_cast<size_t>(_batch) * (n - 1);
+
+	if (_sub.size() != off_total || _super.size() != off_total || _rhs.size() != _diag.size())
+	{
+		throw std::invalid_argument("[BandedMatrix] Batched Thomas Solve failed: off-diagonals must hold batch * (n - 1) values and right-hand side batch * n.");
+	}
+
+	auto solve = [&](int begin, int end)
+		{
+			std::vector<double> c_prime(n);
+
+			for (int b = begin; b < end; b++)
+			{
+				size_t off_offset = static_cast<size_t>(b) * (n - 1);
+				size_t offset = static_cast<size_t>(b) * n;
+
+				if (!LinAlg::BandedMatrix::ThomasSweep(_sub.data() + off_offset, &_diag[offset], _super.data() + off_offset, &_rhs[offset], c_prime.data(), n))
+				{
+					throw std::runtime_error("[BandedMatrix] Batched Thomas Solve failed: zero pivot encountered.");
+				}
+			}
+		};
+
+	// Each sweep is O(n), so small batches are not worth a thread.
+	if (_diag.size() <= static_cast<size_t>(LinAlg::BandedMatrix::PARALLEL_VOLUME))
+	{
+		solve(0, _batch);
+		return;
+	}
+
+	Utils::ParallelFor(0, _batch, solve, std::max(1, LinAlg::BandedMatrix::PARALLEL_VOLUME / n));
+}
+
+void LinAlg::BandedMatrix::BatchedSolve(std::vector<LinAlg::BandedMatrix>& _systems, std::vector<std::vector<double>>& _rhs)
+{
+	if (_systems.size() != _rhs.size())
+	{
+		throw std::invalid_argument("[BandedMatrix] Batched Solve failed: mismatch between no. of systems and right-hand sides.");
+	}
+
+	for (size_t b = 0; b < _systems.size(); b++)
+	{
+		if (static_cast<int>(_rhs[b].size()) != _systems[b].size)
+		{
+			throw std::invalid_argument("[BandedMatrix] Batched Solve failed: right-hand side size mismatch.");
+		}
+	}
+
+	// Systems are factorized in place so later calls can reuse the factors.
+	Utils::ParallelFor(0, static_cast<int>(_systems.size()), [&](int begin, int end)
+		{
+			for (int b = begin; b < end; b++)
+			{
+				_systems[b].Factorize();
+				_systems[b].SolveInPlace(_rhs[b].data());
+			}
+		});
+}
+
+// ========================================
+// BandedMatrix Conversion Method(s)
+// ========================================
+LinAlg::Matrix LinAlg::BandedMatrix::ToMatrix() const
+{
+	if (this->factorized)
+	{
+		throw std::runtime_error("[BandedMatrix] ToMatrix failed: storage holds LU factors.");
+	}
+
+	std::vector<double> flat(static_cast<size_t>(this->size) * this->size, 0.0);
+
+	for (int i = 0; i < this->size; i++)
+	{
+		int first = std::max(0, i - this->lower);
+		int last = std::min(this->size - 1, i + this->upper);
+
+		for (int j = first; j <= last; j++)
+		{
+			flat[static_cast<size_t>(i) * this->size + j] = this->band[this->Index(i, j)];
+		}
+	}
+
+	return LinAlg::Matrix({ this->size, this->size }, flat);
+}
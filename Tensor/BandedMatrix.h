@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Matrix.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LinAlg
+{
+    // Square matrix with kl sub-diagonals and ku super-diagonals. Rows are
+    // stored contiguously with room for kl extra super-diagonals so partial
+    // pivoting can fill in without reallocating: element (i, j) lives at
+    // band[i * width + (j - i + kl)] with width = 2 * kl + ku + 1.
+    class BandedMatrix
+    {
+    private:
+        std::vector<double> band;
+
+        std::vector<int> pivots;
+
+        int size = 0;
+
+        int lower = 0;
+
+        int upper = 0;
+
+        int width = 0;
+
+        bool factorized = false;
+
+        // ========== Constants ==========
+        static constexpr double TOLERANCE = 1e-12;
+        static constexpr int PARALLEL_VOLUME = 1 << 15;
+
+    private:
+        size_t Index(const int& _row, const int& _col) const;
+
+        bool InBand(const int& _row, const int& _col) const;
+
+        void SolveInPlace(double* _rhs) const;
+
+        // Thomas sweep over one n x n system: _sub[i - 1] and _super[i] are the
+        // off-diagonals of row i, _c_prime is n values of scratch, and the
+        // solution overwrites _rhs. Returns false on a zero pivot.
+        static bool ThomasSweep(const double* _sub, const double* _diag, const double* _super, double* _rhs, double* _c_prime, const int& _n);
+
+    public:
+        BandedMatrix() {}
+
+        BandedMatrix(const int& _size, const int& _lower, const int& _upper);
+
+        BandedMatrix(const Matrix& _matrix, const int& _lower, const int& _upper);
+
+        static BandedMatrix FromMatrix(const Matrix& _matrix, const double& _tolerance = 1e-9);
+
+        static BandedMatrix Tridiagonal(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super);
+
+        int Size() const;
+
+        int LowerBandwidth() const;
+
+        int UpperBandwidth() const;
+
+        bool IsFactorized() const;
+
+        double Get(const int& _row, const int& _col) const;
+
+        void Set(const int& _row, const int& _col, const double& _value);
+
+        std::vector<double> MatVec(const std::vector<double>& _vector) const;
+
+        void Factorize();
+
+        std::vector<double> Solve(const std::vector<double>& _rhs) const;
+
+        Matrix Solve(const Matrix& _rhs) const;
+
+        Matrix ToMatrix() const;
+
+        // Tridiagonal solve without pivoting (diagonally dominant systems):
+        // _sub and _super hold n - 1 values, _diag and _rhs n, and the
+        // solution overwrites _rhs.
+        static void ThomasSolve(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super, std::vector<double>& _rhs);
+
+        // ThomasSolve over _batch systems of equal size stored back to back,
+        // i.e. every operand is the concatenation of the single-system ones.
+        static void BatchedThomasSolve(const std::vector<double>& _sub, const std::vector<double>& _diag, const std::vector<double>& _super, std::vector<double>& _rhs, const int& _batch);
+
+        static void BatchedSolve(std::vector<BandedMatrix>& _systems, std::vector<std::vector<double>>& _rhs);
+    };
+}
@@ -1 +1,13 @@
 #include "BaseActivation.h"
+#include "Tensor.h"
+
+
+void Activation::BaseActivation::f(const Tensor& tensor, Tensor& output) const
+{
+    output = this->f(tensor);
+}
+
+void Activation::BaseActivation::df(const Tensor& tensor, Tensor& output) const
+{
+    output = this->df(tensor);
+}
@@ -6,6 +6,7 @@
 #include <numeric>
 #include <numbers>
 #include <stdexcept>
+#include <utility>
 
 class Tensor;
 
@@ -25,5 +26,20 @@ namespace Activation
         virtual Tensor f(const Tensor& tensor) const = 0;
 
         virtual Tensor df(const Tensor& tensor) const = 0;
+
+        // Write into output, reusing its storage when the shape already
+        // matches; output may be tensor itself.
+        virtual void f(const Tensor& tensor, Tensor& output) const;
+
+        virtual void df(const Tensor& tensor, Tensor& output) const;
+
+        // f and df evaluated together, sharing the intermediates both need.
+        virtual std::pair<Tensor, Tensor> fdf(const Tensor& tensor) const = 0;
+
+        // Vector-Jacobian (grad^T * J) and Jacobian-vector (J * tangent)
+        // products at tensor, without materializing J.
+        virtual Tensor VJP(const Tensor& tensor, const Tensor& grad) const = 0;
+
+        virtual Tensor JVP(const Tensor& tensor, const Tensor& tangent) const = 0;
     };
 }
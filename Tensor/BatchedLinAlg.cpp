@@ -0,0 +1,521 @@
+#include "BatchedLinAlg.h"
+
+// ========================================
+// [Private] Batch Layout Method(s)
+// ========================================
+int LinAlg::Batched::BatchCount(const Tensor& _tensor, const std::string& _operation, const bool& _square)
+{
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[Batched] " + _operation + " failed: empty Tensor.");
+	}
+
+	if (_tensor.Rank() < 2)
+	{
+		throw std::invalid_argument("[Batched] " + _operation + " failed: Tensor must be of rank >= 2 with matrices in the last two axes.");
+	}
+
+	std::vector<int> shape = _tensor.Shape();
+
+	int rows = shape[shape.size() - 2];
+	int columns = shape[shape.size() - 1];
+
+	if (_square && rows != columns)
+	{
+		throw std::invalid_argument("[Batched] " + _operation + " failed: matrices in the last two axes must be square.");
+	}
+
+	return _tensor.Volume() / (rows * columns);
+}
+
+int LinAlg::Batched::Grain(const int& _rows, const int& _columns)
+{
+	// Aim for roughly 32K multiply-adds per thread chunk so tiny matrices are not
+	// dominated by thread start-up.
+	int work = std::max(1, _rows * _columns * std::min(_rows, _columns));
+	return std::max(1, 32768 / work);
+}
+
+template<typename Func>
+void LinAlg::Batched::DispatchSize(const int& _n, Func&& _func)
+{
+	switch (_n)
+	{
+	case 1: _func(std::integral_constant<int, 1>{}); break;
+	case 2: _func(std::integral_constant<int, 2>{}); break;
+	case 3: _func(std::integral_constant<int, 3>{}); break;
+	case 4: _func(std::integral_constant<int, 4>{}); break;
+	case 5: _func(std::integral_constant<int, 5>{}); break;
+	case 6: _func(std::integral_constant<int, 6>{}); break;
+	case 7: _func(std::integral_constant<int, 7>{}); break;
+	case 8: _func(std::integral_constant<int, 8>{}); break;
+	default: _func(std::integral_constant<int, 0>{}); break;
+	}
+}
+
+// ========================================
+// [Private] Matrix Kernel Method(s)
+// ========================================
+// N > 0 fixes every loop bound at compile time so the compiler can fully
+// unroll the small cases; N == 0 is the runtime-sized fallback.
+template<int N>
+int LinAlg::Batched::LUKernel(double* _a, int* _permutation, const int& _n)
+{
+	const int n = (N > 0) ? N : _n;
+	int swaps = 0;
+
+	for (int i = 0; i < n; i++)
+	{
+		_permutation[i] = i;
+	}
+
+	for (int k = 0; k < n; k++)
+	{
+		int pivot = k;
+		double max_value = std::abs(_a[k * n + k]);
+
+		for (int i = k + 1; i < n; i++)
+		{
+			double value = std::abs(_a[i * n + k]);
+			if (value > max_value)
+			{
+				max_value = value;
+				pivot = i;
+			}
+		}
+
+		if (max_value < LinAlg::Batched::TOLERANCE)
+		{
+			for (int i = k; i < n; i++)
+			{
+				_a[i * n + k] = 0.0;
+			}
+			continue;
+		}
+
+		if (pivot != k)
+		{
+			for (int j = 0; j < n; j++)
+			{
+				std::swap(_a[k * n + j], _a[pivot * n + j]);
+			}
+
+			std::swap(_permutation[k], _permutation[pivot]);
+			swaps++;
+		}
+
+		double inv_pivot = 1.0 / _a[k * n + k];
+
+		for (int i = k + 1; i < n; i++)
+		{
+			double factor = _a[i * n + k] * inv_pivot;
+			_a[i * n + k] = factor;
+
+			if (factor == 0.0)
+			{
+				continue;
+			}
+
+			for (int j = k + 1; j < n; j++)
+			{
+				_a[i * n + j] -= factor * _a[k * n + j];
+			}
+		}
+	}
+
+	return swaps;
+}
+
+template<int N>
+bool LinAlg::Batched::CholeskyKernel(const double* _a, double* _l, const int& _n)
+{
+	const int n = (N > 0) ? N : _n;
+
+	for (int i = 0; i < n; i++)
+	{
+		for (int j = 0; j < i; j++)
+		{
+			if (std::abs(_a[i * n + j] - _a[j * n + i]) > LinAlg::Batched::TOLERANCE)
+			{
+				return false;
+			}
+		}
+	}
+
+	for (int j = 0; j < n; j++)
+	{
+		double sum = _a[j * n + j];
+		for (int k = 0; k < j; k++)
+		{
+			sum -= _l[j * n + k] * _l[j * n + k];
+		}
+
+		if (sum <= LinAlg::Batched::TOLERANCE)
+		{
+			return false;
+		}
+
+		double diag = std::sqrt(sum);
+		_l[j * n + j] = diag;
+
+		for (int i = j + 1; i < n; i++)
+		{
+			double value = _a[i * n + j];
+			for (int k = 0; k < j; k++)
+			{
+				value -= _l[i * n + k] * _l[j * n + k];
+			}
+
+			_l[i * n + j] = value / diag;
+		}
+	}
+
+	return true;
+}
+
+template<int N>
+void LinAlg::Batched::LUSolveIdentityKernel(const double* _lu, const int* _permutation, double* _inverse, const int& _n)
+{
+	const int n = (N > 0) ? N : _n;
+
+	// Column j of A^-1 solves L * U * x = P^T * e_j; each column is solved in
+	// place inside the output, forward then backward.
+	for (int j = 0; j < n; j++)
+	{
+		for (int i = 0; i < n; i++)
+		{
+			double value = (_permutation[i] == j) ? 1.0 : 0.0;
+			for (int k = 0; k < i; k++)
+			{
+				value -= _lu[i * n + k] * _inverse[k * n + j];
+			}
+
+			_inverse[i * n + j] = value;
+		}
+
+		for (int i = n - 1; i >= 0; i--)
+		{
+			double value = _inverse[i * n + j];
+			for (int k = i + 1; k < n; k++)
+			{
+				value -= _lu[i * n + k] * _inverse[k * n + j];
+			}
+
+			_inverse[i * n + j] = value / _lu[i * n + i];
+		}
+	}
+}
+
+void LinAlg::Batched::QRKernel(double* _r, double* _q, double* _v, const int& _m, const int& _n)
+{
+	for (int i = 0; i < _m; i++)
+	{
+		for (int j = 0; j < _m; j++)
+		{
+			_q[i * _m + j] = (i == j) ? 1.0 : 0.0;
+		}
+	}
+
+	int k = std::min(_m, _n);
+
+	for (int i = 0; i < k; i++)
+	{
+		int vsize = _m - i;
+
+		double norm_x = 0.0;
+		for (int r = 0; r < vsize; r++)
+		{
+			_v[r] = _r[(r + i) * _n + i];
+			norm_x += _v[r] * _v[r];
+		}
+		norm_x = std::sqrt(norm_x);
+
+		if (norm_x < LinAlg::Batched::TOLERANCE)
+		{
+			continue;
+		}
+
+		_v[0] += (_v[0] >= 0) ? norm_x : -norm_x;
+
+		double norm_v = 0.0;
+		for (int r = 0; r < vsize; r++)
+		{
+			norm_v += _v[r] * _v[r];
+		}
+		norm_v = std::sqrt(norm_v);
+
+		if (norm_v < LinAlg::Batched::TOLERANCE)
+		{
+			continue;
+		}
+
+		for (int r = 0; r < vsize; r++)
+		{
+			_v[r] /= norm_v;
+		}
+
+		// R <- H * R, touching only the trailing block.
+		for (int c = i; c < _n; c++)
+		{
+			double dot = 0.0;
+			for (int r = 0; r < vsize; r++)
+			{
+				dot += _v[r] * _r[(r + i) * _n + c];
+			}
+
+			dot *= 2.0;
+			for (int r = 0; r < vsize; r++)
+			{
+				_r[(r + i) * _n + c] -= dot * _v[r];
+			}
+		}
+
+		// Q <- Q * H
+		for (int r = 0; r < _m; r++)
+		{
+			double dot = 0.0;
+			for (int c = 0; c < vsize; c++)
+			{
+				dot += _q[r * _m + c + i] * _v[c];
+			}
+
+			dot *= 2.0;
+			for (int c = 0; c < vsize; c++)
+			{
+				_q[r * _m + c + i] -= dot * _v[c];
+			}
+		}
+
+		for (int r = i + 1; r < _m; r++)
+		{
+			_r[r * _n + i] = 0.0;
+		}
+	}
+
+	for (int i = 0; i < _m * _n; i++)
+	{
+		if (std::abs(_r[i]) < LinAlg::Batched::TOLERANCE)
+		{
+			_r[i] = 0.0;
+		}
+	}
+
+	for (int i = 0; i < _m * _m; i++)
+	{
+		if (std::abs(_q[i]) < LinAlg::Batched::TOLERANCE)
+		{
+			_q[i] = 0.0;
+		}
+	}
+}
+
+// ========================================
+// Batched Decomposition Method(s)
+// ========================================
+LinAlg::BatchedLUResult LinAlg::Batched::LU(const Tensor& _tensor)
+{
+	int batch = LinAlg::Batched::BatchCount(_tensor, "LU Decomposition");
+
+	std::vector<int> shape = _tensor.Shape();
+	int n = shape.back();
+	int mat_size = n * n;
+
+	Tensor L(shape, 0.0);
+	Tensor U = _tensor;
+	Tensor P(shape, 0.0);
+
+	double* l_data = &*L.begin();
+	double* u_data = &*U.begin();
+	double* p_data = &*P.begin();
+
+	LinAlg::Batched::DispatchSize(n, [&](auto _size)
+		{
+			constexpr int N = decltype(_size)::value;
+
+			Utils::ParallelFor(0, batch, [&](int begin, int end)
+				{
+					std::vector<int> permutation(n);
+
+					for (int b = begin; b < end; b++)
+					{
+						double* u = u_data + static_cast<size_t>(b) * mat_size;
+						double* l = l_data + static_cast<size_t>(b) * mat_size;
+						double* p = p_data + static_cast<size_t>(b) * mat_size;
+
+						LinAlg::Batched::LUKernel<N>(u, permutation.data(), n);
+
+						// Unpack the compact factors into unit-lower L and upper U.
+						for (int i = 0; i < n; i++)
+						{
+							l[i * n + i] = 1.0;
+							for (int j = 0; j < i; j++)
+							{
+								l[i * n + j] = u[i * n + j];
+								u[i * n + j] = 0.0;
+							}
+
+							p[permutation[i] * n + i] = 1.0;
+						}
+					}
+				}, LinAlg::Batched::Grain(n, n));
+		});
+
+	return LinAlg::BatchedLUResult(L, U, P);
+}
+
+Tensor LinAlg::Batched::Cholesky(const Tensor& _tensor)
+{
+	int batch = LinAlg::Batched::BatchCount(_tensor, "Cholesky Decomposition");
+
+	std::vector<int> shape = _tensor.Shape();
+	int n = shape.back();
+	int mat_size = n * n;
+
+	Tensor L(shape, 0.0);
+
+	const double* a_data = &*_tensor.begin();
+	double* l_data = &*L.begin();
+
+	LinAlg::Batched::DispatchSize(n, [&](auto _size)
+		{
+			constexpr int N = decltype(_size)::value;
+
+			Utils::ParallelFor(0, batch, [&](int begin, int end)
+				{
+					for (int b = begin; b < end; b++)
+					{
+						const double* a = a_data + static_cast<size_t>(b) * mat_size;
+						double* l = l_data + static_cast<size_t>(b) * mat_size;
+
+						if (!LinAlg::Batched::CholeskyKernel<N>(a, l, n))
+						{
+							throw std::runtime_error("[Batched] Cholesky Decomposition failed: matrix at batch index " + std::to_string(b) + " is not symmetric positive-definite.");
+						}
+					}
+				}, LinAlg::Batched::Grain(n, n));
+		});
+
+	return L;
+}
+
+Tensor LinAlg::Batched::Inverse(const Tensor& _tensor)
+{
+	int batch = LinAlg::Batched::BatchCount(_tensor, "Inversion");
+
+	std::vector<int> shape = _tensor.Shape();
+	int n = shape.back();
+	int mat_size = n * n;
+
+	Tensor result(shape, 0.0);
+
+	const double* a_data = &*_tensor.begin();
+	double* inv_data = &*result.begin();
+
+	LinAlg::Batched::DispatchSize(n, [&](auto _size)
+		{
+			constexpr int N = decltype(_size)::value;
+
+			Utils::ParallelFor(0, batch, [&](int begin, int end)
+				{
+					std::vector<double> lu(mat_size);
+					std::vector<int> permutation(n);
+
+					for (int b = begin; b < end; b++)
+					{
+						const double* a = a_data + static_cast<size_t>(b) * mat_size;
+						std::copy(a, a + mat_size, lu.begin());
+
+						LinAlg::Batched::LUKernel<N>(lu.data(), permutation.data(), n);
+
+						for (int i = 0; i < n; i++)
+						{
+							if (std::abs(lu[i * n + i]) < LinAlg::Batched::TOLERANCE)
+							{
+								throw std::runtime_error("[Batched] Inversion failed: matrix at batch index " + std::to_string(b) + " is singular (not full rank).");
+							}
+						}
+
+						LinAlg::Batched::LUSolveIdentityKernel<N>(lu.data(), permutation.data(), inv_data + static_cast<size_t>(b) * mat_size, n);
+					}
+				}, LinAlg::Batched::Grain(n, n));
+		});
+
+	return result;
+}
+
+LinAlg::BatchedQRResult LinAlg::Batched::QR(const Tensor& _tensor)
+{
+	int batch = LinAlg::Batched::BatchCount(_tensor, "Householder QR Decomposition", false);
+
+	std::vector<int> shape = _tensor.Shape();
+	int rows = shape[shape.size() - 2];
+	int columns = shape.back();
+
+	std::vector<int> q_shape = shape;
+	q_shape.back() = rows;
+
+	Tensor Q(q_shape, 0.0);
+	Tensor R = _tensor;
+
+	double* q_data = &*Q.begin();
+	double* r_data = &*R.begin();
+
+	Utils::ParallelFor(0, batch, [&](int begin, int end)
+		{
+			std::vector<double> v(rows);
+
+			for (int b = begin; b < end; b++)
+			{
+				LinAlg::Batched::QRKernel(
+					r_data + static_cast<size_t>(b) * rows * columns,
+					q_data + static_cast<size_t>(b) * rows * rows,
+					v.data(), rows, columns);
+			}
+		}, LinAlg::Batched::Grain(rows, columns));
+
+	return LinAlg::BatchedQRResult(Q, R);
+}
+
+Tensor LinAlg::Batched::Determinant(const Tensor& _tensor)
+{
+	int batch = LinAlg::Batched::BatchCount(_tensor, "Determinant Computation");
+
+	std::vector<int> shape = _tensor.Shape();
+	int n = shape.back();
+	int mat_size = n * n;
+
+	std::vector<double> determinants(batch);
+
+	const double* a_data = &*_tensor.begin();
+
+	LinAlg::Batched::DispatchSize(n, [&](auto _size)
+		{
+			constexpr int N = decltype(_size)::value;
+
+			Utils::ParallelFor(0, batch, [&](int begin, int end)
+				{
+					std::vector<double> lu(mat_size);
+					std::vector<int> permutation(n);
+
+					for (int b = begin; b < end; b++)
+					{
+						const double* a = a_data + static_cast<size_t>(b) * mat_size;
+						std::copy(a, a + mat_size, lu.begin());
+
+						int swaps = LinAlg::Batched::LUKernel<N>(lu.data(), permutation.data(), n);
+
+						double det = (swaps % 2 == 0) ? 1.0 : -1.0;
+						for (int i = 0; i < n; i++)
+						{
+							det *= lu[i * n + i];
+						}
+
+						determinants[b] = det;
+					}
+				}, LinAlg::Batched::Grain(n, n));
+		});
+
+	std::vector<int> batch_shape(shape.begin(), shape.end() - 2);
+
+	return Tensor(batch_shape, determinants);
+}
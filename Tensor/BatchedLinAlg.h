@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Tensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LinAlg
+{
+    struct BatchedLUResult
+    {
+        Tensor L;
+        Tensor U;
+        Tensor P;
+    };
+
+    struct BatchedQRResult
+    {
+        Tensor Q;
+        Tensor R;
+    };
+
+    // Decompositions applied independently to every matrix held in the two
+    // trailing axes of a Tensor [..., n, n]. Each matrix is factorized in the
+    // Tensor's contiguous storage, the batch is split across threads, and
+    // sizes up to 8 are dispatched to kernels unrolled at compile time.
+    // Results follow the LinAlg::Matrix conventions (A = P * L * U, A = Q * R).
+    class Batched
+    {
+    private:
+        // ========== Constants ==========
+        static constexpr double TOLERANCE = 1e-9;
+
+        static constexpr int MAX_UNROLLED_SIZE = 8;
+
+    private:
+        static int BatchCount(const Tensor& _tensor, const std::string& _operation, const bool& _square = true);
+
+        static int Grain(const int& _rows, const int& _columns);
+
+        template<typename Func>
+        static void DispatchSize(const int& _n, Func&& _func);
+
+        template<int N>
+        static int LUKernel(double* _a, int* _permutation, const int& _n);
+
+        template<int N>
+        static bool CholeskyKernel(const double* _a, double* _l, const int& _n);
+
+        template<int N>
+        static void LUSolveIdentityKernel(const double* _lu, const int* _permutation, double* _inverse, const int& _n);
+
+        static void QRKernel(double* _r, double* _q, double* _v, const int& _m, const int& _n);
+
+    public:
+        static LinAlg::BatchedLUResult LU(const Tensor& _tensor);
+
+        static Tensor Cholesky(const Tensor& _tensor);
+
+        static Tensor Inverse(const Tensor& _tensor);
+
+        static LinAlg::BatchedQRResult QR(const Tensor& _tensor);
+
+        static Tensor Determinant(const Tensor& _tensor);
+    };
+}
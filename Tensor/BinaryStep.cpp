@@ -10,3 +10,5 @@ double Activation::BinaryStep::df(double x) const
 {
     return 0.0;
 }
+
+template class Activation::ScalarActivationImpl<Activation::BinaryStep>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class BinaryStep : public ScalarActivation
+    class BinaryStep : public ScalarActivationImpl<BinaryStep>
     {
     public:
         using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<BinaryStep>;
 };
@@ -0,0 +1,188 @@
+#include "Conversion.h"
+
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#include <immintrin.h>
+#define CONVERSION_F16C
+#endif
+
+// ========================================
+// [Private] Kernel Method(s)
+// ========================================
+template<typename From, typename To>
+void Conversion::Kernel(const From* _source, To* _destination, const int& _begin, const int& _end)
+{
+	if constexpr (std::is_integral_v<To> && std::is_floating_point_v<From>)
+	{
+		// Clamped in double, where both int32 limits are exact; a NaN passes
+		// the clamp unchanged and is then selected away.
+		constexpr double lowest = static_cast<double>(std::numeric_limits<To>::lowest());
+		constexpr double highest = static_cast<double>(std::numeric_limits<To>::max());
+
+		for (int i = _begin; i < _end; i++)
+		{
+			double value = static_cast<double>(_source[i]);
+			double clamped = std::nearbyint(std::min(std::max(value, lowest), highest));
+
+			_destination[i] = (value == value) ? static_cast<To>(clamped) : To(0);
+		}
+	}
+	else if constexpr (std::is_integral_v<To> && sizeof(To) < sizeof(From))
+	{
+		constexpr From lowest = static_cast<From>(std::numeric_limits<To>::lowest());
+		constexpr From highest = static_cast<From>(std::numeric_limits<To>::max());
+
+		for (int i = _begin; i < _end; i++)
+		{
+			_destination[i] = static_cast<To>(std::min(std::max(_source[i], lowest), highest));
+		}
+	}
+	else
+	{
+		int i = _begin;
+
+#ifdef CONVERSION_F16C
+		if constexpr (std::is_same_v<From, float> && std::is_same_v<To, Float16>)
+		{
+			for (; i + 8 <= _end; i += 8)
+			{
+				__m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(_source + i), _MM_FROUND_TO_NEAREST_INT);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(_destination + i), half);
+			}
+		}
+		else if constexpr (std::is_same_v<From, Float16> && std::is_same_v<To, float>)
+		{
+			for (; i + 8 <= _end; i += 8)
+			{
+				__m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_source + i));
+				_mm256_storeu_ps(_destination + i, _mm256_cvtph_ps(half));
+			}
+		}
+#endif
+
+		// The 16-bit types only convert to and from float; double goes
+		// through it (exactly when widening).
+		using Step = std::conditional_t<(sizeof(From) == 2 || sizeof(To) == 2), float, To>;
+
+		for (; i < _end; i++)
+		{
+			_destination[i] = static_cast<To>(static_cast<Step>(_source[i]));
+		}
+	}
+}
+
+template<typename From, typename To>
+void Conversion::Run(const From* _source, To* _destination, const int& _count)
+{
+	if (_count <= 0)
+	{
+		return;
+	}
+
+	Utils::ParallelFor(0, _count, [&](int begin, int end)
+		{
+			Conversion::Kernel(_source, _destination, begin, end);
+		}, Conversion::PARALLEL_COUNT);
+}
+
+// ========================================
+// Conversion Method(s)
+// ========================================
+void Conversion::Convert(const double* _source, float* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const double* _source, int32_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const double* _source, int8_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const float* _source, double* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const float* _source, int32_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const float* _source, int8_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int32_t* _source, double* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int32_t* _source, float* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int32_t* _source, int8_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int8_t* _source, double* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int8_t* _source, float* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const int8_t* _source, int32_t* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const float* _source, BFloat16* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const float* _source, Float16* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const double* _source, BFloat16* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const double* _source, Float16* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const BFloat16* _source, float* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const Float16* _source, float* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const BFloat16* _source, double* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
+
+void Conversion::Convert(const Float16* _source, double* _destination, const int& _count)
+{
+	Conversion::Run(_source, _destination, _count);
+}
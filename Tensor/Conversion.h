@@ -0,0 +1,83 @@
+#pragma once
+
+#include "HalfPrecision.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// ========================================
+// Conversion Class
+// ========================================
+// Element type conversion between the storage types of TypedTensor
+// (double, float, int32_t, int8_t, BFloat16, Float16). Every kernel is one
+// flat loop without branches, which compilers turn into packed conversions
+// (cvtpd2ps, cvtps2pd, cvtdq2ps, ...), and long arrays are split across
+// threads. Float16 <-> float uses the F16C instructions (vcvtps2ph /
+// vcvtph2ps, 8 values at a time) when the build targets them (AVX2 or
+// -mf16c) and the branch-free software conversion otherwise; BFloat16 is
+// always converted in software, which is a shift and a rounding add.
+//
+// Conversions to an integer type round to nearest (ties to even), saturate
+// at the type's range and map NaN to 0, so out-of-range values never wrap.
+// Conversions between floating types round to nearest as the hardware does;
+// double values beyond float's range become +-Inf. double values reach the
+// 16-bit types through float, so a double within 2^-29 (relative) of a
+// 16-bit rounding tie may round the other way.
+class Conversion
+{
+private:
+    // ========== Constants ==========
+    static constexpr int PARALLEL_COUNT = 1 << 18;
+
+private:
+    template<typename From, typename To>
+    static void Kernel(const From* _source, To* _destination, const int& _begin, const int& _end);
+
+    template<typename From, typename To>
+    static void Run(const From* _source, To* _destination, const int& _count);
+
+public:
+    static void Convert(const double* _source, float* _destination, const int& _count);
+
+    static void Convert(const double* _source, int32_t* _destination, const int& _count);
+
+    static void Convert(const double* _source, int8_t* _destination, const int& _count);
+
+    static void Convert(const float* _source, double* _destination, const int& _count);
+
+    static void Convert(const float* _source, int32_t* _destination, const int& _count);
+
+    static void Convert(const float* _source, int8_t* _destination, const int& _count);
+
+    static void Convert(const int32_t* _source, double* _destination, const int& _count);
+
+    static void Convert(const int32_t* _source, float* _destination, const int& _count);
+
+    static void Convert(const int32_t* _source, int8_t* _destination, const int& _count);
+
+    static void Convert(const int8_t* _source, double* _destination, const int& _count);
+
+    static void Convert(const int8_t* _source, float* _destination, const int& _count);
+
+    static void Convert(const int8_t* _source, int32_t* _destination, const int& _count);
+
+    static void Convert(const float* _source, BFloat16* _destination, const int& _count);
+
+    static void Convert(const float* _source, Float16* _destination, const int& _count);
+
+    static void Convert(const double* _source, BFloat16* _destination, const int& _count);
+
+    static void Convert(const double* _source, Float16* _destination, const int& _count);
+
+    static void Convert(const BFloat16* _source, float* _destination, const int& _count);
+
+    static void Convert(const Float16* _source, float* _destination, const int& _count);
+
+    static void Convert(const BFloat16* _source, double* _destination, const int& _count);
+
+    static void Convert(const Float16* _source, double* _destination, const int& _count);
+};
@@ -1,4 +1,5 @@
 #include "ELU.h"
+#include "FastMath.h"
 
 Activation::ELU::ELU(double alpha)
 {
@@ -17,10 +18,27 @@ Activation::ELU::ELU(double alpha)
 
 double Activation::ELU::f(double x) const
 {
-	return (x >= 0) ? x : (alpha * (std::exp(x) - 1));
+	return (x >= 0) ? x : (alpha * (FastMath::Exp(x) - 1));
 }
 
 double Activation::ELU::df(double x) const
 {
-	return (x >= 0) ? 1 : (alpha * std::exp(x));
+	return (x >= 0) ? 1 : (alpha * FastMath::Exp(x));
 }
+
+void Activation::ELU::fdf(double x, double& value, double& derivative) const
+{
+	if (x >= 0)
+	{
+		value = x;
+		derivative = 1;
+		return;
+	}
+
+	double e = alpha * FastMath::Exp(x);
+
+	value = e - alpha;
+	derivative = e;
+}
+
+template class Activation::ScalarActivationImpl<Activation::ELU>;
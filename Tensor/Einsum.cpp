@@ -0,0 +1,747 @@
+#include "Einsum.h"
+
+// ========================================
+// [Private] Parsing Method(s)
+// ========================================
+int Einsum::LabelIndex(const char& _label)
+{
+	if (_label >= 'a' && _label <= 'z')
+	{
+		return _label - 'a';
+	}
+
+	if (_label >= 'A' && _label <= 'Z')
+	{
+		return 26 + (_label - 'A');
+	}
+
+	throw std::invalid_argument(std::string("[Tensor] Einsum failed: invalid label '") + _label + "', labels must be letters (a-z, A-Z).");
+}
+
+void Einsum::Parse(const std::string& _equation, const std::vector<const Tensor*>& _operands, std::vector<Node>& _nodes, std::vector<int>& _output_labels, std::vector<int>& _label_dims)
+{
+	std::string equation;
+	for (char c : _equation)
+	{
+		if (!std::isspace(static_cast<unsigned char>(c)))
+		{
+			equation.push_back(c);
+		}
+	}
+
+	size_t arrow = equation.find("->");
+	std::string inputs = equation.substr(0, arrow);
+
+	std::vector<std::string> terms(1);
+	for (char c : inputs)
+	{
+		if (c == ',')
+		{
+			terms.emplace_back();
+		}
+		else
+		{
+			terms.back().push_back(c);
+		}
+	}
+
+	if (_operands.empty() || terms.size() != _operands.size())
+	{
+		throw std::invalid_argument("[Tensor] Einsum failed: number of operand terms (" + std::to_string(terms.size())
+			+ ") does not match the number of operands (" + std::to_string(_operands.size()) + ").");
+	}
+
+	_label_dims.assign(Einsum::LABELS, -1);
+	std::vector<int> occurrences(Einsum::LABELS, 0);
+
+	_nodes.clear();
+	_nodes.reserve(2 * _operands.size());
+
+	for (size_t i = 0; i < terms.size(); i++)
+	{
+		const Tensor* operand = _operands[i];
+
+		if (operand == nullptr || operand->IsEmpty())
+		{
+			throw std::invalid_argument("[Tensor] Einsum failed: operands must not be empty.");
+		}
+
+		if (static_cast<int>(terms[i].size()) != operand->Rank())
+		{
+			throw std::invalid_argument("[Tensor] Einsum failed: term '" + terms[i] + "' does not match the rank of operand "
+				+ std::to_string(i) + " (" + std::to_string(operand->Rank()) + ").");
+		}
+
+		Node node;
+		node.input = operand;
+		node.shape = operand->Shape();
+
+		for (size_t a = 0; a < terms[i].size(); a++)
+		{
+			int label = Einsum::LabelIndex(terms[i][a]);
+
+			if (_label_dims[label] != -1 && _label_dims[label] != node.shape[a])
+			{
+				throw std::invalid_argument(std::string("[Tensor] Einsum failed: inconsistent dimension for label '") + terms[i][a] + "'.");
+			}
+
+			_label_dims[label] = node.shape[a];
+			node.labels.push_back(label);
+			node.mask |= (std::uint64_t(1) << label);
+			occurrences[label]++;
+		}
+
+		_nodes.push_back(std::move(node));
+	}
+
+	_output_labels.clear();
+
+	if (arrow != std::string::npos)
+	{
+		std::string output = equation.substr(arrow + 2);
+		std::uint64_t seen = 0;
+
+		for (char c : output)
+		{
+			int label = Einsum::LabelIndex(c);
+
+			if (occurrences[label] == 0)
+			{
+				throw std::invalid_argument(std::string("[Tensor] Einsum failed: output label '") + c + "' does not appear in any operand.");
+			}
+
+			if (seen & (std::uint64_t(1) << label))
+			{
+				throw std::invalid_argument(std::string("[Tensor] Einsum failed: output label '") + c + "' is repeated.");
+			}
+
+			seen |= (std::uint64_t(1) << label);
+			_output_labels.push_back(label);
+		}
+	}
+	else
+	{
+		// Implicit output: the labels used exactly once, in alphabetical
+		// (character) order.
+		std::string output;
+		for (char c : inputs)
+		{
+			if (c != ',' && occurrences[Einsum::LabelIndex(c)] == 1)
+			{
+				output.push_back(c);
+			}
+		}
+
+		std::sort(output.begin(), output.end());
+
+		for (char c : output)
+		{
+			_output_labels.push_back(Einsum::LabelIndex(c));
+		}
+	}
+}
+
+// ========================================
+// [Private] Node Helper Method(s)
+// ========================================
+const Tensor& Einsum::Source(const Node& _node)
+{
+	return (_node.input != nullptr) ? *_node.input : _node.storage;
+}
+
+double Einsum::LabelVolume(const std::uint64_t& _mask, const std::vector<int>& _label_dims)
+{
+	double volume = 1.0;
+
+	for (int label = 0; label < Einsum::LABELS; label++)
+	{
+		if (_mask & (std::uint64_t(1) << label))
+		{
+			volume *= _label_dims[label];
+		}
+	}
+
+	return volume;
+}
+
+// The node with only _labels (unique, in that order) left: repeated labels
+// are read along their diagonal, all other labels are summed out.
+Einsum::Node Einsum::Reduce(const Node& _node, const std::vector<int>& _labels, const std::vector<int>& _label_dims)
+{
+	Node result;
+
+	result.labels = _labels;
+	for (int label : _labels)
+	{
+		result.shape.push_back(_label_dims[label]);
+		result.mask |= (std::uint64_t(1) << label);
+	}
+
+	result.storage = Tensor(result.shape, 0.0);
+	Einsum::LoopNest({ &_node }, result.labels, _label_dims, &*result.storage.begin());
+
+	return result;
+}
+
+// A copy of the node with its axes permuted into _labels order.
+Einsum::Node Einsum::Canonicalize(const Node& _node, const std::vector<int>& _labels)
+{
+	Node result;
+
+	result.labels = _labels;
+	result.mask = _node.mask;
+
+	std::vector<int> permutation;
+	for (int label : _labels)
+	{
+		int axis = static_cast<int>(std::find(_node.labels.begin(), _node.labels.end(), label) - _node.labels.begin());
+
+		permutation.push_back(axis);
+		result.shape.push_back(_node.shape[axis]);
+	}
+
+	Einsum::Source(_node).Transpose(permutation, result.storage);
+
+	return result;
+}
+
+// The stride that walks the labels of _group (outermost first) as one
+// flattened index, if the node's layout allows it. An empty group has
+// stride 0.
+bool Einsum::GroupStride(const Node& _node, const std::vector<int>& _group, int& _stride)
+{
+	_stride = 0;
+
+	if (_group.empty())
+	{
+		return true;
+	}
+
+	std::vector<int> strides = Utils::ShapeToStrides(_node.shape);
+
+	int previous_stride = 0;
+	for (size_t g = 0; g < _group.size(); g++)
+	{
+		int axis = static_cast<int>(std::find(_node.labels.begin(), _node.labels.end(), _group[g]) - _node.labels.begin());
+
+		if (g > 0 && previous_stride != strides[axis] * _node.shape[axis])
+		{
+			return false;
+		}
+
+		previous_stride = strides[axis];
+	}
+
+	_stride = previous_stride;
+
+	return true;
+}
+
+// ========================================
+// [Private] Path Method(s)
+// ========================================
+// cost(S) = min over splits S = A + B of cost(A) + cost(B) + |labels(A) u
+// labels(B)|, where labels(X) are the labels an intermediate over X keeps:
+// those also used outside X or in the output. O(3^n) splits.
+std::vector<Einsum::Step> Einsum::OptimalPath(const std::vector<Node>& _nodes, const std::uint64_t& _output_mask, const std::vector<int>& _label_dims)
+{
+	int count = static_cast<int>(_nodes.size());
+	int full = (1 << count) - 1;
+
+	std::vector<std::uint64_t> labels_of(full + 1, 0);
+	for (int set = 1; set <= full; set++)
+	{
+		int lowest = set & -set;
+		int node = std::countr_zero(static_cast<unsigned>(lowest));
+
+		labels_of[set] = labels_of[set ^ lowest] | _nodes[node].mask;
+	}
+
+	auto kept = [&](int set) { return labels_of[set] & (_output_mask | labels_of[full ^ set]); };
+
+	std::vector<double> cost(full + 1, 0.0);
+	std::vector<int> split(full + 1, 0);
+
+	for (int set = 1; set <= full; set++)
+	{
+		if ((set & (set - 1)) == 0)
+		{
+			continue;
+		}
+
+		int lowest = set & -set;
+		double best = std::numeric_limits<double>::infinity();
+
+		// Submasks holding the lowest node, so each split is seen once.
+		for (int part = (set - 1) & set; part > 0; part = (part - 1) & set)
+		{
+			if (!(part & lowest))
+			{
+				continue;
+			}
+
+			int rest = set ^ part;
+			double candidate = cost[part] + cost[rest] + Einsum::LabelVolume(kept(part) | kept(rest), _label_dims);
+
+			if (candidate < best)
+			{
+				best = candidate;
+				split[set] = part;
+			}
+		}
+
+		cost[set] = best;
+	}
+
+	std::vector<Step> path;
+
+	// Post-order over the split tree; intermediates are numbered after the
+	// inputs in creation order.
+	std::function<int(int)> build = [&](int set) -> int
+		{
+			if ((set & (set - 1)) == 0)
+			{
+				return std::countr_zero(static_cast<unsigned>(set));
+			}
+
+			int left = build(split[set]);
+			int right = build(set ^ split[set]);
+
+			path.push_back({ left, right });
+
+			return count + static_cast<int>(path.size()) - 1;
+		};
+
+	build(full);
+
+	return path;
+}
+
+// Repeatedly contracts the pair whose result is smallest relative to its
+// operands, breaking ties by operation count.
+std::vector<Einsum::Step> Einsum::GreedyPath(const std::vector<Node>& _nodes, const std::uint64_t& _output_mask, const std::vector<int>& _label_dims)
+{
+	int count = static_cast<int>(_nodes.size());
+
+	std::vector<int> active(count);
+	std::iota(active.begin(), active.end(), 0);
+
+	std::vector<std::uint64_t> masks;
+	for (const Node& node : _nodes)
+	{
+		masks.push_back(node.mask);
+	}
+
+	std::vector<Step> path;
+
+	while (active.size() > 1)
+	{
+		double best_growth = std::numeric_limits<double>::infinity();
+		double best_cost = std::numeric_limits<double>::infinity();
+		size_t best_i = 0;
+		size_t best_j = 1;
+
+		for (size_t i = 0; i < active.size(); i++)
+		{
+			for (size_t j = i + 1; j < active.size(); j++)
+			{
+				std::uint64_t others = _output_mask;
+				for (size_t o = 0; o < active.size(); o++)
+				{
+					if (o != i && o != j)
+					{
+						others |= masks[active[o]];
+					}
+				}
+
+				std::uint64_t both = masks[active[i]] | masks[active[j]];
+
+				double growth = Einsum::LabelVolume(both & others, _label_dims)
+					- Einsum::LabelVolume(masks[active[i]], _label_dims) - Einsum::LabelVolume(masks[active[j]], _label_dims);
+				double cost = Einsum::LabelVolume(both, _label_dims);
+
+				if (growth < best_growth || (growth == best_growth && cost < best_cost))
+				{
+					best_growth = growth;
+					best_cost = cost;
+					best_i = i;
+					best_j = j;
+				}
+			}
+		}
+
+		std::uint64_t others = _output_mask;
+		for (size_t o = 0; o < active.size(); o++)
+		{
+			if (o != best_i && o != best_j)
+			{
+				others |= masks[active[o]];
+			}
+		}
+
+		path.push_back({ active[best_i], active[best_j] });
+		masks.push_back((masks[active[best_i]] | masks[active[best_j]]) & others);
+
+		active.erase(active.begin() + best_j);
+		active[best_i] = count + static_cast<int>(path.size()) - 1;
+	}
+
+	return path;
+}
+
+// ========================================
+// [Private] Contraction Method(s)
+// ========================================
+Einsum::Node Einsum::Contract(const Node& _left, const Node& _right, const std::uint64_t& _keep, const std::vector<int>& _label_dims)
+{
+	auto ordered = [](const Node& _node, const std::uint64_t& _mask)
+		{
+			std::vector<int> group;
+			for (int label : _node.labels)
+			{
+				if (_mask & (std::uint64_t(1) << label))
+				{
+					group.push_back(label);
+				}
+			}
+
+			return group;
+		};
+
+	std::uint64_t shared = _left.mask & _right.mask;
+
+	std::vector<int> batch = ordered(_left, shared & _keep);
+	std::vector<int> depth = ordered(_left, shared & ~_keep);
+	std::vector<int> rows = ordered(_left, _left.mask & ~_right.mask);
+	std::vector<int> columns = ordered(_right, _right.mask & ~_left.mask);
+
+	// Shared groups are walked in the same order by both operands; take the
+	// right operand's order when only that one avoids a copy.
+	int stride = 0;
+	for (std::vector<int>* group : { &batch, &depth })
+	{
+		if (!Einsum::GroupStride(_left, *group, stride) || !Einsum::GroupStride(_right, *group, stride))
+		{
+			std::vector<int> alternative = ordered(_right, (group == &batch) ? (shared & _keep) : (shared & ~_keep));
+
+			if (Einsum::GroupStride(_left, alternative, stride) && Einsum::GroupStride(_right, alternative, stride))
+			{
+				*group = alternative;
+			}
+		}
+	}
+
+	Node result;
+
+	result.labels = batch;
+	result.labels.insert(result.labels.end(), rows.begin(), rows.end());
+	result.labels.insert(result.labels.end(), columns.begin(), columns.end());
+
+	for (int label : result.labels)
+	{
+		result.shape.push_back(_label_dims[label]);
+		result.mask |= (std::uint64_t(1) << label);
+	}
+
+	result.storage = Tensor(result.shape, 0.0);
+	double* output = &*result.storage.begin();
+
+	ProductLayout layout;
+	layout.batch = static_cast<int>(Einsum::LabelVolume(shared & _keep, _label_dims));
+	layout.rows = static_cast<int>(Einsum::LabelVolume(_left.mask & ~_right.mask, _label_dims));
+	layout.columns = static_cast<int>(Einsum::LabelVolume(_right.mask & ~_left.mask, _label_dims));
+	layout.depth = static_cast<int>(Einsum::LabelVolume(shared & ~_keep, _label_dims));
+
+	// Element-wise and broadcast products have no inner dimension to
+	// stream over.
+	if (layout.depth == 1 && (layout.rows == 1 || layout.columns == 1))
+	{
+		Einsum::LoopNest({ &_left, &_right }, result.labels, _label_dims, output);
+		return result;
+	}
+
+	const Node* left = &_left;
+	const Node* right = &_right;
+
+	Node left_copy;
+	Node right_copy;
+
+	if (!Einsum::GroupStride(*left, batch, layout.a_batch) || !Einsum::GroupStride(*left, rows, layout.a_row) || !Einsum::GroupStride(*left, depth, layout.a_depth))
+	{
+		std::vector<int> order = batch;
+		order.insert(order.end(), rows.begin(), rows.end());
+		order.insert(order.end(), depth.begin(), depth.end());
+
+		left_copy = Einsum::Canonicalize(*left, order);
+		left = &left_copy;
+
+		Einsum::GroupStride(*left, batch, layout.a_batch);
+		Einsum::GroupStride(*left, rows, layout.a_row);
+		Einsum::GroupStride(*left, depth, layout.a_depth);
+	}
+
+	if (!Einsum::GroupStride(*right, batch, layout.b_batch) || !Einsum::GroupStride(*right, depth, layout.b_depth) || !Einsum::GroupStride(*right, columns, layout.b_column))
+	{
+		std::vector<int> order = batch;
+		order.insert(order.end(), depth.begin(), depth.end());
+		order.insert(order.end(), columns.begin(), columns.end());
+
+		right_copy = Einsum::Canonicalize(*right, order);
+		right = &right_copy;
+
+		Einsum::GroupStride(*right, batch, layout.b_batch);
+		Einsum::GroupStride(*right, depth, layout.b_depth);
+		Einsum::GroupStride(*right, columns, layout.b_column);
+	}
+
+	Einsum::BatchedProduct(&*Einsum::Source(*left).begin(), &*Einsum::Source(*right).begin(), output, layout);
+
+	return result;
+}
+
+// output[position] = sum over the labels not in the output of the product of
+// the inputs. A label repeated within an input contributes the sum of its
+// axes' strides, i.e. walks the diagonal.
+void Einsum::LoopNest(const std::vector<const Node*>& _inputs, const std::vector<int>& _output_labels, const std::vector<int>& _label_dims, double* _output)
+{
+	int count = static_cast<int>(_inputs.size());
+	int output_rank = static_cast<int>(_output_labels.size());
+
+	std::uint64_t output_mask = 0;
+	for (int label : _output_labels)
+	{
+		output_mask |= (std::uint64_t(1) << label);
+	}
+
+	std::uint64_t all_mask = 0;
+	for (const Node* input : _inputs)
+	{
+		all_mask |= input->mask;
+	}
+
+	std::vector<int> summed_labels;
+	for (int label = 0; label < Einsum::LABELS; label++)
+	{
+		if ((all_mask & ~output_mask) & (std::uint64_t(1) << label))
+		{
+			summed_labels.push_back(label);
+		}
+	}
+
+	int summed_rank = static_cast<int>(summed_labels.size());
+
+	std::vector<const double*> data(count);
+	std::vector<int> output_strides(static_cast<size_t>(count) * output_rank, 0);
+	std::vector<int> summed_strides(static_cast<size_t>(count) * summed_rank, 0);
+
+	for (int i = 0; i < count; i++)
+	{
+		const Node& input = *_inputs[i];
+		std::vector<int> strides = Utils::ShapeToStrides(input.shape);
+
+		data[i] = &*Einsum::Source(input).begin();
+
+		for (size_t axis = 0; axis < input.labels.size(); axis++)
+		{
+			int label = input.labels[axis];
+
+			auto in_output = std::find(_output_labels.begin(), _output_labels.end(), label);
+			if (in_output != _output_labels.end())
+			{
+				output_strides[(i * output_rank) + (in_output - _output_labels.begin())] += strides[axis];
+			}
+			else
+			{
+				auto in_summed = std::find(summed_labels.begin(), summed_labels.end(), label);
+				summed_strides[(i * summed_rank) + (in_summed - summed_labels.begin())] += strides[axis];
+			}
+		}
+	}
+
+	int output_volume = static_cast<int>(Einsum::LabelVolume(output_mask, _label_dims));
+	int summed_volume = static_cast<int>(Einsum::LabelVolume(all_mask & ~output_mask, _label_dims));
+
+	Utils::ParallelFor(0, output_volume, [&](int begin, int end)
+		{
+			std::vector<int> offsets(count);
+			std::vector<int> position(summed_rank);
+
+			for (int p = begin; p < end; p++)
+			{
+				std::fill(offsets.begin(), offsets.end(), 0);
+
+				int remainder = p;
+				for (int j = output_rank - 1; j >= 0; j--)
+				{
+					int dim = _label_dims[_output_labels[j]];
+					int index = remainder % dim;
+					remainder /= dim;
+
+					for (int i = 0; i < count; i++)
+					{
+						offsets[i] += index * output_strides[(i * output_rank) + j];
+					}
+				}
+
+				std::fill(position.begin(), position.end(), 0);
+				double sum = 0.0;
+
+				for (int s = 0; s < summed_volume; s++)
+				{
+					double product = 1.0;
+					for (int i = 0; i < count; i++)
+					{
+						product *= data[i][offsets[i]];
+					}
+
+					sum += product;
+
+					for (int d = summed_rank - 1; d >= 0; d--)
+					{
+						position[d]++;
+						for (int i = 0; i < count; i++)
+						{
+							offsets[i] += summed_strides[(i * summed_rank) + d];
+						}
+
+						if (position[d] < _label_dims[summed_labels[d]])
+						{
+							break;
+						}
+
+						for (int i = 0; i < count; i++)
+						{
+							offsets[i] -= position[d] * summed_strides[(i * summed_rank) + d];
+						}
+						position[d] = 0;
+					}
+				}
+
+				_output[p] = sum;
+			}
+		}, std::max(1, Einsum::GRAIN / std::max(1, summed_volume)));
+}
+
+// Strided batched LinAlg::Gemm; any column stride is absorbed when the
+// operands are packed.
+void Einsum::BatchedProduct(const double* _a, const double* _b, double* _c, const ProductLayout& _layout)
+{
+	LinAlg::Gemm::Batch batch;
+	batch.shape = { _layout.batch };
+	batch.a_strides = { _layout.a_batch };
+	batch.b_strides = { _layout.b_batch };
+	batch.c_strides = { static_cast<long long>(_layout.rows) * _layout.columns };
+
+	LinAlg::Gemm::Multiply({ _a, _layout.rows, _layout.depth, _layout.a_row, _layout.a_depth }, false,
+		{ _b, _layout.depth, _layout.columns, _layout.b_depth, _layout.b_column }, false,
+		{ _c, _layout.columns, 1 }, batch);
+}
+
+// ========================================
+// Evaluation Method(s)
+// ========================================
+Tensor Einsum::Evaluate(const std::string& _equation, const std::vector<const Tensor*>& _operands)
+{
+	std::vector<Node> nodes;
+	std::vector<int> output_labels;
+	std::vector<int> label_dims;
+
+	Einsum::Parse(_equation, _operands, nodes, output_labels, label_dims);
+
+	std::uint64_t output_mask = 0;
+	for (int label : output_labels)
+	{
+		output_mask |= (std::uint64_t(1) << label);
+	}
+
+	std::vector<int> operand_count(Einsum::LABELS, 0);
+	for (const Node& node : nodes)
+	{
+		for (int label = 0; label < Einsum::LABELS; label++)
+		{
+			operand_count[label] += (node.mask >> label) & 1;
+		}
+	}
+
+	// Diagonals and labels private to one operand are resolved up front, so
+	// every pairwise step sees unique labels that are all needed later.
+	for (Node& node : nodes)
+	{
+		std::vector<int> labels;
+		bool reduce = false;
+
+		for (int label : node.labels)
+		{
+			bool repeated = std::find(labels.begin(), labels.end(), label) != labels.end();
+			bool summed = (operand_count[label] == 1) && !(output_mask & (std::uint64_t(1) << label));
+
+			if (repeated || summed)
+			{
+				reduce = true;
+			}
+			else
+			{
+				labels.push_back(label);
+			}
+		}
+
+		if (reduce)
+		{
+			node = Einsum::Reduce(node, labels, label_dims);
+		}
+	}
+
+	int count = static_cast<int>(nodes.size());
+
+	std::vector<Step> path = (count <= Einsum::OPTIMAL_LIMIT)
+		? Einsum::OptimalPath(nodes, output_mask, label_dims)
+		: Einsum::GreedyPath(nodes, output_mask, label_dims);
+
+	std::vector<bool> alive(count, true);
+
+	for (const Step& step : path)
+	{
+		std::uint64_t others = output_mask;
+		for (size_t j = 0; j < nodes.size(); j++)
+		{
+			if (alive[j] && static_cast<int>(j) != step.left && static_cast<int>(j) != step.right)
+			{
+				others |= nodes[j].mask;
+			}
+		}
+
+		std::uint64_t keep = (nodes[step.left].mask | nodes[step.right].mask) & others;
+
+		Node result = Einsum::Contract(nodes[step.left], nodes[step.right], keep, label_dims);
+
+		// Consumed intermediates release their storage right away.
+		nodes[step.left].storage = Tensor();
+		nodes[step.right].storage = Tensor();
+		alive[step.left] = false;
+		alive[step.right] = false;
+
+		nodes.push_back(std::move(result));
+		alive.push_back(true);
+	}
+
+	Node& final_node = nodes.back();
+
+	std::vector<int> permutation;
+	for (int label : output_labels)
+	{
+		permutation.push_back(static_cast<int>(std::find(final_node.labels.begin(), final_node.labels.end(), label) - final_node.labels.begin()));
+	}
+
+	bool identity = true;
+	for (size_t i = 0; i < permutation.size(); i++)
+	{
+		identity = identity && (permutation[i] == static_cast<int>(i));
+	}
+
+	if (identity && final_node.input == nullptr)
+	{
+		return std::move(final_node.storage);
+	}
+
+	return Einsum::Source(final_node).Transpose(permutation);
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Tensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ========================================
+// Einsum Class
+// ========================================
+// Engine behind Tensor::Einsum. An expression is evaluated as:
+//   1. Per-operand reduction: repeated labels (diagonals) and labels used
+//      by no other operand nor the output are removed with a loop nest.
+//   2. Path search: the pairwise contraction order minimizing the total
+//      multiply-add count, exhaustively (subset dynamic programming) for up
+//      to OPTIMAL_LIMIT operands and greedily (smallest intermediate first)
+//      beyond that.
+//   3. Each pair is mapped onto a batched product C[b, m, n] = sum_k
+//      A[b, m, k] * B[b, k, n]: labels shared and still needed become the
+//      batch, shared and no longer needed the reduction, the rest rows and
+//      columns. Operands are read through strides when each label group is
+//      contiguous in memory and copied into that order only when it is not.
+//      Pure element-wise / broadcast pairs use the loop nest instead.
+//   4. The last intermediate is transposed into the requested output order.
+class Einsum
+{
+private:
+    // An operand or intermediate: the label and dimension of each axis over
+    // a row-major buffer. Inputs are referenced in place, intermediates own
+    // their storage.
+    struct Node
+    {
+        const Tensor* input = nullptr;
+        Tensor storage;
+        std::vector<int> labels;
+        std::vector<int> shape;
+        std::uint64_t mask = 0;
+    };
+
+    // Contracts nodes left and right; the result is appended to the nodes.
+    struct Step
+    {
+        int left = 0;
+        int right = 0;
+    };
+
+    // C[b, m, n] = sum_k A[b, m, k] * B[b, k, n]; A and B are addressed
+    // through the strides below, C is contiguous.
+    struct ProductLayout
+    {
+        int batch = 1;
+        int rows = 1;
+        int columns = 1;
+        int depth = 1;
+
+        int a_batch = 0;
+        int a_row = 0;
+        int a_depth = 0;
+
+        int b_batch = 0;
+        int b_depth = 0;
+        int b_column = 0;
+    };
+
+    // ========== Constants ==========
+    static constexpr int LABELS = 52;
+    static constexpr int OPTIMAL_LIMIT = 10;
+    static constexpr int GRAIN = 1 << 14;
+
+private:
+    static int LabelIndex(const char& _label);
+
+    static void Parse(const std::string& _equation, const std::vector<const Tensor*>& _operands, std::vector<Node>& _nodes, std::vector<int>& _output_labels, std::vector<int>& _label_dims);
+
+    static const Tensor& Source(const Node& _node);
+
+    static double LabelVolume(const std::uint64_t& _mask, const std::vector<int>& _label_dims);
+
+    static std::vector<Step> OptimalPath(const std::vector<Node>& _nodes, const std::uint64_t& _output_mask, const std::vector<int>& _label_dims);
+
+    static std::vector<Step> GreedyPath(const std::vector<Node>& _nodes, const std::uint64_t& _output_mask, const std::vector<int>& _label_dims);
+
+    static Node Reduce(const Node& _node, const std::vector<int>& _labels, const std::vector<int>& _label_dims);
+
+    static Node Canonicalize(const Node& _node, const std::vector<int>& _labels);
+
+    static bool GroupStride(const Node& _node, const std::vector<int>& _group, int& _stride);
+
+    static Node Contract(const Node& _left, const Node& _right, const std::uint64_t& _keep, const std::vector<int>& _label_dims);
+
+    static void LoopNest(const std::vector<const Node*>& _inputs, const std::vector<int>& _output_labels, const std::vector<int>& _label_dims, double* _output);
+
+    static void BatchedProduct(const double* _a, const double* _b, double* _c, const ProductLayout& _layout);
+
+public:
+    static Tensor Evaluate(const std::string& _equation, const std::vector<const Tensor*>& _operands);
+};
@@ -1,4 +1,5 @@
 #include "Exponential.h"
+#include "FastMath.h"
 
 
 double Activation::Exponential::f(double x) const
@@ -7,10 +8,18 @@ double Activation::Exponential::f(double x) const
     {
         throw std::overflow_error("[Activation] Exponential failed: input too large, would cause overflow.");
     }
-    return std::exp(x);
+    return FastMath::Exp(x);
 }
 
 double Activation::Exponential::df(double x) const
 {
     return this->f(x);
 }
+
+void Activation::Exponential::fdf(double x, double& value, double& derivative) const
+{
+    value = this->Exponential::f(x);
+    derivative = value;
+}
+
+template class Activation::ScalarActivationImpl<Activation::Exponential>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class Exponential : public ScalarActivation
+	class Exponential : public ScalarActivationImpl<Exponential>
 	{
 	private:
 		static constexpr double X_LIMIT = 700.0;
@@ -14,8 +14,14 @@ namespace Activation
 
 		using ScalarActivation::df;
 
+		using ScalarActivation::fdf;
+
 		double f(double x) const override;
 
 		double df(double x) const override;
+
+		void fdf(double x, double& value, double& derivative) const override;
 	};
+
+	extern template class ScalarActivationImpl<Exponential>;
 }
@@ -0,0 +1,121 @@
+#include "FastMath.h"
+
+#include <algorithm>
+
+
+// ========================================
+// [Private] Batch Helper Method(s)
+// ========================================
+template <typename Func>
+void FastMath::Map(std::span<const double> input, std::span<double> output, Func func)
+{
+    const double* in = input.data();
+    double* out = output.data();
+    std::size_t count = std::min(input.size(), output.size());
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out[i] = func(in[i]);
+    }
+}
+
+// ========================================
+// Batch Method(s)
+// ========================================
+// The switch picks one fully inlined loop per precision, so the kernels see
+// no per-element dispatch.
+void FastMath::Exp(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Exp<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Exp<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Exp<Precision::Full>(x); });
+        break;
+    }
+}
+
+void FastMath::Log(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log<Precision::Full>(x); });
+        break;
+    }
+}
+
+void FastMath::Log1p(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log1p<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log1p<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Log1p<Precision::Full>(x); });
+        break;
+    }
+}
+
+void FastMath::Tanh(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Tanh<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Tanh<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Tanh<Precision::Full>(x); });
+        break;
+    }
+}
+
+void FastMath::Erf(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Erf<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Erf<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Erf<Precision::Full>(x); });
+        break;
+    }
+}
+
+void FastMath::Sigmoid(std::span<const double> input, std::span<double> output, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        FastMath::Map(input, output, [](double x) { return FastMath::Sigmoid<Precision::High>(x); });
+        break;
+    case Precision::Fast:
+        FastMath::Map(input, output, [](double x) { return FastMath::Sigmoid<Precision::Fast>(x); });
+        break;
+    default:
+        FastMath::Map(input, output, [](double x) { return FastMath::Sigmoid<Precision::Full>(x); });
+        break;
+    }
+}
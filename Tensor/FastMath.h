@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// ========================================
+// FastMath Class
+// ========================================
+// Transcendental functions with selectable accuracy:
+//   Full - the standard library (default, bit-for-bit unchanged behaviour)
+//   High - polynomial kernels: relative error about 1e-8 for Exp, Log,
+//          Log1p and Sigmoid and 6e-8 for Tanh; Erf uses Abramowitz &
+//          Stegun 7.1.26, absolute error up to 1.5e-7
+//   Fast - shorter kernels: relative error about 6e-5 (Exp, Tanh, Sigmoid)
+//          and 4e-6 (Log, Log1p); Erf uses A&S 7.1.25, absolute error up to
+//          2.5e-5
+// The precision is chosen per call or process-wide via SetPrecision (which
+// activations and Math use). At High and Fast, NaN propagates, Log gives
+// -inf at 0 and NaN below it, and Exp overflows to +inf like the standard
+// library, but Exp flushes to 0 below -708 instead of returning subnormals
+// (down to about -745), and Sigmoid, Tanh and Erf inherit that through Exp.
+class FastMath
+{
+public:
+    enum class Precision
+    {
+        Full,
+        High,
+        Fast
+    };
+
+    // Sets the global precision for the lifetime of the object and restores
+    // the previous one on destruction. The setting is process-wide, not
+    // per-thread, so worker threads spawned inside the scope observe it.
+    class ScopedPrecision
+    {
+    private:
+        Precision previous;
+
+    public:
+        explicit ScopedPrecision(Precision precision);
+
+        ~ScopedPrecision();
+
+        ScopedPrecision(const ScopedPrecision&) = delete;
+
+        ScopedPrecision& operator=(const ScopedPrecision&) = delete;
+    };
+
+private:
+    // ========== Constants ==========
+    static constexpr double LOG2E = 1.4426950408889634;
+    static constexpr double LN2_HI = 6.93147180369123816490e-01;
+    static constexpr double LN2_LO = 1.90821492927058770002e-10;
+    static constexpr double LN2 = 0.6931471805599453;
+    static constexpr double SQRT2 = 1.4142135623730951;
+    static constexpr double TWO_OVER_SQRT_PI = 1.1283791670955126;
+
+    static constexpr double ROUND_SHIFT = 6755399441055744.0;
+    static constexpr double TWO_POW_52 = 4503599627370496.0;
+    static constexpr double TWO_POW_54 = 18014398509481984.0;
+
+    static constexpr double EXP_MIN = -708.0;
+    static constexpr double EXP_MAX = 709.782712893384;
+
+    static inline std::atomic<Precision> global_precision{ Precision::Full };
+
+private:
+    template <typename Func>
+    static void Map(std::span<const double> input, std::span<double> output, Func func);
+
+public:
+    static Precision GetPrecision();
+
+    static void SetPrecision(Precision precision);
+
+    // ========================================
+    // Scalar Methods (compile-time precision)
+    // ========================================
+    template <Precision P>
+    static double Exp(double x);
+
+    template <Precision P>
+    static double Log(double x);
+
+    template <Precision P>
+    static double Log1p(double x);
+
+    template <Precision P>
+    static double Tanh(double x);
+
+    template <Precision P>
+    static double Erf(double x);
+
+    template <Precision P>
+    static double Sigmoid(double x);
+
+    // ========================================
+    // Scalar Methods (runtime precision, global by default)
+    // ========================================
+    static double Exp(double x, Precision precision = FastMath::GetPrecision());
+
+    static double Log(double x, Precision precision = FastMath::GetPrecision());
+
+    static double Log1p(double x, Precision precision = FastMath::GetPrecision());
+
+    static double Tanh(double x, Precision precision = FastMath::GetPrecision());
+
+    static double Erf(double x, Precision precision = FastMath::GetPrecision());
+
+    static double Sigmoid(double x, Precision precision = FastMath::GetPrecision());
+
+    // ========================================
+    // Batch Methods
+    // ========================================
+    // output[i] = func(input[i]); the precision is resolved once per call and
+    // input and output may be the same memory.
+    static void Exp(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+
+    static void Log(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+
+    static void Log1p(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+
+    static void Tanh(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+
+    static void Erf(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+
+    static void Sigmoid(std::span<const double> input, std::span<double> output, Precision precision = FastMath::GetPrecision());
+};
+
+#include "FastMath.inl"
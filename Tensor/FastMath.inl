@@ -0,0 +1,294 @@
+#include "FastMath.h"
+
+// ========================================
+// Precision Method(s)
+// ========================================
+inline FastMath::Precision FastMath::GetPrecision()
+{
+    return FastMath::global_precision.load(std::memory_order_relaxed);
+}
+
+inline void FastMath::SetPrecision(Precision precision)
+{
+    FastMath::global_precision.store(precision, std::memory_order_relaxed);
+}
+
+inline FastMath::ScopedPrecision::ScopedPrecision(Precision precision)
+{
+    this->previous = FastMath::GetPrecision();
+    FastMath::SetPrecision(precision);
+}
+
+inline FastMath::ScopedPrecision::~ScopedPrecision()
+{
+    FastMath::SetPrecision(this->previous);
+}
+
+// ========================================
+// Scalar Kernel Method(s)
+// ========================================
+// The kernels below are branch-free (edge cases are blended in with selects)
+// so batch loops over them can be vectorized.
+
+// exp: x = n * ln2 + r with |r| <= ln2 / 2 (Cody-Waite split of ln2), e^r by
+// a Taylor polynomial (degree 7 for High, 4 for Fast). n is rounded with the
+// 1.5 * 2^52 shift, which also leaves it in the low mantissa bits, and 2^n is
+// applied as 2 * 2^(n - 1) so the largest n stays representable. Results
+// below e^-708 flush to zero.
+template <FastMath::Precision P>
+double FastMath::Exp(double x)
+{
+    if constexpr (P == Precision::Full)
+    {
+        return std::exp(x);
+    }
+    else
+    {
+        double xc = std::min(std::max(x, FastMath::EXP_MIN), FastMath::EXP_MAX);
+
+        double shifted = (xc * FastMath::LOG2E) + FastMath::ROUND_SHIFT;
+        double n = shifted - FastMath::ROUND_SHIFT;
+        double r = (xc - (n * FastMath::LN2_HI)) - (n * FastMath::LN2_LO);
+
+        double p;
+        if constexpr (P == Precision::High)
+        {
+            p = 1.0 + r * (1.0 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120 + r * (1.0 / 720 + r * (1.0 / 5040)))))));
+        }
+        else
+        {
+            p = 1.0 + r * (1.0 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24))));
+        }
+
+        std::uint64_t scale_bits = (std::bit_cast<std::uint64_t>(shifted) + 1022) << 52;
+        double result = (2.0 * p) * std::bit_cast<double>(scale_bits);
+
+        result = (x > FastMath::EXP_MAX) ? std::numeric_limits<double>::infinity() : result;
+        result = (x < FastMath::EXP_MIN) ? 0.0 : result;
+
+        return (x != x) ? x : result;
+    }
+}
+
+// log: x = m * 2^e with m in [sqrt(1/2), sqrt(2)), log(m) = 2 * atanh(s) for
+// s = (m - 1) / (m + 1), |s| <= 0.172, as an odd series in s. Subnormals are
+// rescaled by 2^54 first.
+template <FastMath::Precision P>
+double FastMath::Log(double x)
+{
+    if constexpr (P == Precision::Full)
+    {
+        return std::log(x);
+    }
+    else
+    {
+        bool subnormal = (x < std::numeric_limits<double>::min());
+        double xs = subnormal ? (x * FastMath::TWO_POW_54) : x;
+
+        std::uint64_t bits = std::bit_cast<std::uint64_t>(xs);
+
+        // The biased exponent is converted to double through the 2^52 bit
+        // pattern, avoiding an int64 -> double conversion in vector loops.
+        double biased = std::bit_cast<double>(((bits >> 52) & 0x7FF) | 0x4330000000000000ull) - FastMath::TWO_POW_52;
+        double exponent = biased - (subnormal ? 1077.0 : 1023.0);
+        double m = std::bit_cast<double>((bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+
+        bool upper = (m > FastMath::SQRT2);
+        m = upper ? (m * 0.5) : m;
+        exponent = upper ? (exponent + 1.0) : exponent;
+
+        double s = (m - 1.0) / (m + 1.0);
+        double s2 = s * s;
+
+        double series;
+        if constexpr (P == Precision::High)
+        {
+            series = 1.0 + s2 * (1.0 / 3 + s2 * (1.0 / 5 + s2 * (1.0 / 7 + s2 * (1.0 / 9))));
+        }
+        else
+        {
+            series = 1.0 + s2 * (1.0 / 3 + s2 * (1.0 / 5));
+        }
+
+        double result = (exponent * FastMath::LN2) + (2.0 * s * series);
+
+        result = (x == std::numeric_limits<double>::infinity()) ? x : result;
+        result = (x == 0.0) ? -std::numeric_limits<double>::infinity() : result;
+        result = (x < 0.0) ? std::numeric_limits<double>::quiet_NaN() : result;
+
+        return (x != x) ? x : result;
+    }
+}
+
+// log1p via log(1 + x) * x / ((1 + x) - 1), which cancels the rounding of 1 + x.
+template <FastMath::Precision P>
+double FastMath::Log1p(double x)
+{
+    if constexpr (P == Precision::Full)
+    {
+        return std::log1p(x);
+    }
+    else
+    {
+        double u = 1.0 + x;
+        double ratio = (u == 1.0 || u == std::numeric_limits<double>::infinity()) ? 1.0 : (x / (u - 1.0));
+
+        return (u == 1.0) ? x : (FastMath::Log<P>(u) * ratio);
+    }
+}
+
+// tanh: odd Taylor series near zero (where 1 - 2 / (e^2x + 1) cancels),
+// otherwise through exp.
+template <FastMath::Precision P>
+double FastMath::Tanh(double x)
+{
+    if constexpr (P == Precision::Full)
+    {
+        return std::tanh(x);
+    }
+    else
+    {
+        double a = std::abs(x);
+        double a2 = a * a;
+
+        double series;
+        if constexpr (P == Precision::High)
+        {
+            series = a * (1.0 + a2 * (-1.0 / 3 + a2 * (2.0 / 15 + a2 * (-17.0 / 315 + a2 * (62.0 / 2835)))));
+        }
+        else
+        {
+            series = a * (1.0 + a2 * (-1.0 / 3 + a2 * (2.0 / 15)));
+        }
+
+        double e = FastMath::Exp<P>(2.0 * a);
+        double t = (a < 0.3) ? series : (1.0 - (2.0 / (e + 1.0)));
+
+        return std::copysign(t, x);
+    }
+}
+
+// erf: Taylor series near zero; Abramowitz & Stegun 7.1.26 (|error| <= 1.5e-7)
+// for High and 7.1.25 (|error| <= 2.5e-5) for Fast elsewhere.
+template <FastMath::Precision P>
+double FastMath::Erf(double x)
+{
+    if constexpr (P == Precision::Full)
+    {
+        return std::erf(x);
+    }
+    else
+    {
+        double a = std::abs(x);
+        double a2 = a * a;
+
+        double series;
+        double poly;
+        if constexpr (P == Precision::High)
+        {
+            series = 1.0 + a2 * (-1.0 / 3 + a2 * (1.0 / 10 + a2 * (-1.0 / 42 + a2 * (1.0 / 216 + a2 * (-1.0 / 1320 + a2 * (1.0 / 9360))))));
+
+            double t = 1.0 / (1.0 + 0.3275911 * a);
+            poly = t * (0.254829592 + t * (-0.284496736 + t * (1.421413741 + t * (-1.453152027 + t * 1.061405429))));
+        }
+        else
+        {
+            series = 1.0 + a2 * (-1.0 / 3 + a2 * (1.0 / 10 + a2 * (-1.0 / 42)));
+
+            double t = 1.0 / (1.0 + 0.47047 * a);
+            poly = t * (0.3480242 + t * (-0.0958798 + t * 0.7478556));
+        }
+
+        double near = FastMath::TWO_OVER_SQRT_PI * a * series;
+        double far = 1.0 - (poly * FastMath::Exp<P>(-a2));
+
+        return std::copysign((a < 0.5) ? near : far, x);
+    }
+}
+
+template <FastMath::Precision P>
+double FastMath::Sigmoid(double x)
+{
+    return 1.0 / (1.0 + FastMath::Exp<P>(-x));
+}
+
+// ========================================
+// Runtime-Dispatch Method(s)
+// ========================================
+inline double FastMath::Exp(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Exp<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Exp<Precision::Fast>(x);
+    default:
+        return FastMath::Exp<Precision::Full>(x);
+    }
+}
+
+inline double FastMath::Log(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Log<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Log<Precision::Fast>(x);
+    default:
+        return FastMath::Log<Precision::Full>(x);
+    }
+}
+
+inline double FastMath::Log1p(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Log1p<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Log1p<Precision::Fast>(x);
+    default:
+        return FastMath::Log1p<Precision::Full>(x);
+    }
+}
+
+inline double FastMath::Tanh(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Tanh<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Tanh<Precision::Fast>(x);
+    default:
+        return FastMath::Tanh<Precision::Full>(x);
+    }
+}
+
+inline double FastMath::Erf(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Erf<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Erf<Precision::Fast>(x);
+    default:
+        return FastMath::Erf<Precision::Full>(x);
+    }
+}
+
+inline double FastMath::Sigmoid(double x, Precision precision)
+{
+    switch (precision)
+    {
+    case Precision::High:
+        return FastMath::Sigmoid<Precision::High>(x);
+    case Precision::Fast:
+        return FastMath::Sigmoid<Precision::Fast>(x);
+    default:
+        return FastMath::Sigmoid<Precision::Full>(x);
+    }
+}
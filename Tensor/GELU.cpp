@@ -1,4 +1,5 @@
 #include "GELU.h"
+#include "FastMath.h"
 
 
 Activation::GELU::GELU(bool approx)
@@ -11,7 +12,7 @@ double Activation::GELU::f(double x) const
     if (this->approx)
     {
         double inner = x + (Activation::GELU::COEFF * x * x * x);
-        double t = std::tanh(Activation::GELU::SQRT_2_OVER_PI * inner);
+        double t = FastMath::Tanh(Activation::GELU::SQRT_2_OVER_PI * inner);
 
         return 0.5 * x * (1.0 + t);
     }
@@ -25,7 +26,7 @@ double Activation::GELU::f(double x) const
         {
             return 0.0;
         }
-        return 0.5 * x * (1.0 + std::erf(x / std::sqrt(2.0)));
+        return 0.5 * x * (1.0 + FastMath::Erf(x / std::sqrt(2.0)));
     }
 }
 
@@ -35,7 +36,7 @@ double Activation::GELU::df(double x) const
     {
         double inner = x + (Activation::GELU::COEFF * x * x * x);
         double u = Activation::GELU::SQRT_2_OVER_PI * inner;
-        double t = std::tanh(u);
+        double t = FastMath::Tanh(u);
 
         double du = Activation::GELU::SQRT_2_OVER_PI * (1.0 + (3.0 * Activation::GELU::COEFF * x * x));
 
@@ -43,8 +44,8 @@ double Activation::GELU::df(double x) const
     }
     else
     {
-        double erf_term = std::erf(x / std::sqrt(2.0));
-        double exp_term = std::exp(-0.5 * x * x);
+        double erf_term = FastMath::Erf(x / std::sqrt(2.0));
+        double exp_term = FastMath::Exp(-0.5 * x * x);
 
         double term_1 = 0.5 * (1.0 + erf_term);
         double term_2 = (x * exp_term) / std::sqrt(2.0 * std::numbers::pi);
@@ -52,3 +53,30 @@ double Activation::GELU::df(double x) const
         return (term_1 + term_2);
     }
 }
+
+void Activation::GELU::fdf(double x, double& value, double& derivative) const
+{
+    if (this->approx)
+    {
+        double inner = x + (Activation::GELU::COEFF * x * x * x);
+        double t = FastMath::Tanh(Activation::GELU::SQRT_2_OVER_PI * inner);
+
+        double du = Activation::GELU::SQRT_2_OVER_PI * (1.0 + (3.0 * Activation::GELU::COEFF * x * x));
+
+        value = 0.5 * x * (1.0 + t);
+        derivative = 0.5 * (1.0 + t + (x * (1.0 - (t * t)) * du));
+    }
+    else
+    {
+        double erf_term = FastMath::Erf(x / std::sqrt(2.0));
+        double exp_term = FastMath::Exp(-0.5 * x * x);
+
+        double term_1 = 0.5 * (1.0 + erf_term);
+        double term_2 = (x * exp_term) / std::sqrt(2.0 * std::numbers::pi);
+
+        value = (x > 10.0) ? x : ((x < -10.0) ? 0.0 : (x * term_1));
+        derivative = (term_1 + term_2);
+    }
+}
+
+template class Activation::ScalarActivationImpl<Activation::GELU>;
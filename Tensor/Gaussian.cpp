@@ -1,4 +1,5 @@
 #include "Gaussian.h"
+#include "FastMath.h"
 
 
 Activation::Gaussian::Gaussian(double center, double std_dev, double scale)
@@ -25,7 +26,7 @@ double Activation::Gaussian::f(double x) const
 
     double exponent = -(diff * diff) / (2.0 * var);
 
-    return (this->scale * std::exp(exponent));
+    return (this->scale * FastMath::Exp(exponent));
 }
 
 double Activation::Gaussian::df(double x) const
@@ -37,3 +38,14 @@ double Activation::Gaussian::df(double x) const
 
     return result;
 }
+
+void Activation::Gaussian::fdf(double x, double& value, double& derivative) const
+{
+    double var = this->std_dev * this->std_dev;
+    double diff = (x - this->center);
+
+    value = this->scale * FastMath::Exp(-(diff * diff) / (2.0 * var));
+    derivative = -(diff / var) * value;
+}
+
+template class Activation::ScalarActivationImpl<Activation::Gaussian>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class Gaussian : public ScalarActivation
+	class Gaussian : public ScalarActivationImpl<Gaussian>
 	{
 	private:
 		double center;
@@ -18,8 +18,14 @@ namespace Activation
 
 		using ScalarActivation::df;
 
+		using ScalarActivation::fdf;
+
 		double f(double x) const override;
 
 		double df(double x) const override;
+
+		void fdf(double x, double& value, double& derivative) const override;
 	};
+
+	extern template class ScalarActivationImpl<Gaussian>;
 }
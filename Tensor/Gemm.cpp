@@ -0,0 +1,1424 @@
+#include "Gemm.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GEMM_AVX2
+#endif
+
+std::array<LinAlg::Gemm::Blocking, LinAlg::Gemm::BUCKETS> LinAlg::Gemm::tuned_blocking{};
+
+// ========================================
+// [Private] Operand Method(s)
+// ========================================
+template<typename T>
+LinAlg::Gemm::BasicView<T> LinAlg::Gemm::Apply(const BasicView<T>& _view, const bool& _transpose)
+{
+	if (!_transpose)
+	{
+		return _view;
+	}
+
+	return { _view.data, _view.columns, _view.rows, _view.column_stride, _view.row_stride };
+}
+
+// Rows [_row_begin, _row_begin + _rows) x depth [_depth_begin, +_depth) of
+// op(A), as _mr-row strips: strip s holds A(s * _mr + i, p) at
+// [(s * _depth + p) * _mr + i], widened to the packed type. Rows past the
+// end are zero.
+template<typename Packed, typename Input>
+void LinAlg::Gemm::PackA(const BasicView<Input>& _a, const int& _row_begin, const int& _depth_begin, const int& _rows, const int& _depth, const int& _mr, Packed* _buffer)
+{
+	for (int strip = 0; strip < _rows; strip += _mr)
+	{
+		int valid = std::min(_mr, _rows - strip);
+		Packed* destination = _buffer + (static_cast<size_t>(strip) * _depth);
+
+		for (int p = 0; p < _depth; p++)
+		{
+			const Input* source = _a.data + (static_cast<size_t>(_row_begin + strip) * _a.row_stride) + (static_cast<size_t>(_depth_begin + p) * _a.column_stride);
+
+			for (int i = 0; i < valid; i++)
+			{
+				destination[i] = static_cast<Packed>(source[static_cast<size_t>(i) * _a.row_stride]);
+			}
+
+			for (int i = valid; i < _mr; i++)
+			{
+				destination[i] = Packed(0);
+			}
+
+			destination += _mr;
+		}
+	}
+}
+
+// Depth [_depth_begin, +_depth) x columns [_column_begin, +_columns) of
+// op(B), as _nr-column strips: strip s holds B(p, s * _nr + j) at
+// [(s * _depth + p) * _nr + j], widened to the packed type. Columns past
+// the end are zero.
+template<typename Packed, typename Input>
+void LinAlg::Gemm::PackB(const BasicView<Input>& _b, const int& _depth_begin, const int& _column_begin, const int& _depth, const int& _columns, const int& _nr, Packed* _buffer)
+{
+	for (int strip = 0; strip < _columns; strip += _nr)
+	{
+		int valid = std::min(_nr, _columns - strip);
+		Packed* destination = _buffer + (static_cast<size_t>(strip) * _depth);
+
+		for (int p = 0; p < _depth; p++)
+		{
+			const Input* source = _b.data + (static_cast<size_t>(_depth_begin + p) * _b.row_stride) + (static_cast<size_t>(_column_begin + strip) * _b.column_stride);
+
+			if (_b.column_stride == 1)
+			{
+				std::copy(source, source + valid, destination);
+			}
+			else
+			{
+				for (int j = 0; j < valid; j++)
+				{
+					destination[j] = static_cast<Packed>(source[static_cast<size_t>(j) * _b.column_stride]);
+				}
+			}
+
+			for (int j = valid; j < _nr; j++)
+			{
+				destination[j] = Packed(0);
+			}
+
+			destination += _nr;
+		}
+	}
+}
+
+// ========================================
+// [Private] Kernel Method(s)
+// ========================================
+// C[0:_rows, 0:_columns] += _alpha * (packed A strip) * (packed B strip).
+// The R x C accumulator stays in registers and each step is an outer
+// product of one packed A column and one packed B row, which compilers
+// vectorize along C. The tile is rounded to Result once, on the update.
+//
+// With AVX2, int16_t strips 8 columns wide take two depth steps at a time:
+// rows p and p + 1 of the B strip are interleaved into (b_pj, b_(p+1)j)
+// pairs, and vpmaddwd against the broadcast pair (a_pi, a_(p+1)i) yields
+// a_pi * b_pj + a_(p+1)i * b_(p+1)j for all 8 columns in one instruction.
+template<typename Accumulator, typename Result, int R, int C>
+void LinAlg::Gemm::MicroKernel(const int& _depth, const PackedType<Accumulator>* _a, const PackedType<Accumulator>* _b, const Accumulator& _alpha, Result* _c, const int& _c_row_stride, const int& _c_column_stride, const int& _rows, const int& _columns)
+{
+	using Packed = PackedType<Accumulator>;
+
+	Accumulator accumulator[R][C] = {};
+
+#ifdef GEMM_AVX2
+	if constexpr (std::is_same_v<Packed, int16_t> && C == 8)
+	{
+		// The R row updates are unrolled by a fold over their indices so the
+		// sums stay in registers.
+		[&]<int... I>(std::integer_sequence<int, I...>)
+		{
+			__m256i sums[R];
+			((sums[I] = _mm256_setzero_si256()), ...);
+
+			for (int p = 0; p < _depth; p += 2)
+			{
+				const bool pair = (p + 1 < _depth);
+
+				const Packed* a = _a + (static_cast<size_t>(p) * R);
+				const Packed* b = _b + (static_cast<size_t>(p) * C);
+
+				__m128i b_0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+				__m128i b_1 = pair ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + C)) : _mm_setzero_si128();
+
+				__m256i b_pairs = _mm256_set_m128i(_mm_unpackhi_epi16(b_0, b_1), _mm_unpacklo_epi16(b_0, b_1));
+
+				// The A pairs are interleaved the same way, 4 rows at a time,
+				// and each is then broadcast from memory.
+				alignas(16) int32_t a_pairs[R];
+
+				for (int i = 0; i < R; i += 4)
+				{
+					__m128i a_0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + i));
+					__m128i a_1 = pair ? _mm_loadl_epi64(reinterpret_cast<const __m128i*>(a + R + i)) : _mm_setzero_si128();
+
+					_mm_store_si128(reinterpret_cast<__m128i*>(a_pairs + i), _mm_unpacklo_epi16(a_0, a_1));
+				}
+
+#if defined(__AVXVNNI__)
+				((sums[I] = _mm256_dpwssd_avx_epi32(sums[I], _mm256_set1_epi32(a_pairs[I]), b_pairs)), ...);
+#else
+				((sums[I] = _mm256_add_epi32(sums[I], _mm256_madd_epi16(_mm256_set1_epi32(a_pairs[I]), b_pairs))), ...);
+#endif
+			}
+
+			(_mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulator[I]), sums[I]), ...);
+		}(std::make_integer_sequence<int, R>());
+	}
+	else
+#endif
+	{
+		for (int p = 0; p < _depth; p++)
+		{
+			const Packed* a = _a + (static_cast<size_t>(p) * R);
+			const Packed* b = _b + (static_cast<size_t>(p) * C);
+
+			for (int i = 0; i < R; i++)
+			{
+				Accumulator a_i = a[i];
+
+				for (int j = 0; j < C; j++)
+				{
+					accumulator[i][j] += a_i * b[j];
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < _rows; i++)
+	{
+		Result* c_row = _c + (static_cast<size_t>(i) * _c_row_stride);
+
+		for (int j = 0; j < _columns; j++)
+		{
+			Result& value = c_row[static_cast<size_t>(j) * _c_column_stride];
+			value = static_cast<Result>(value + (_alpha * accumulator[i][j]));
+		}
+	}
+}
+
+// The register tiles available to tuning; wider tiles suit machines with
+// more (or wider) vector registers.
+template<typename Accumulator, typename Result>
+LinAlg::Gemm::Kernel<Accumulator, Result> LinAlg::Gemm::SelectKernel(const int& _mr, const int& _nr)
+{
+	if (_mr == 4 && _nr == 4) return &LinAlg::Gemm::MicroKernel<Accumulator, Result, 4, 4>;
+	if (_mr == 4 && _nr == 8) return &LinAlg::Gemm::MicroKernel<Accumulator, Result, 4, 8>;
+	if (_mr == 8 && _nr == 4) return &LinAlg::Gemm::MicroKernel<Accumulator, Result, 8, 4>;
+	if (_mr == 8 && _nr == 8) return &LinAlg::Gemm::MicroKernel<Accumulator, Result, 8, 8>;
+
+	return nullptr;
+}
+
+// C *= beta; with beta == 0 C is overwritten without being read, so stale
+// NaN or Inf values do not propagate (as in BLAS).
+template<typename Result, typename Accumulator>
+void LinAlg::Gemm::Scale(const BasicOutput<Result>& _c, const int& _rows, const int& _columns, const Accumulator& _beta)
+{
+	if (_beta == Accumulator(1))
+	{
+		return;
+	}
+
+	for (int i = 0; i < _rows; i++)
+	{
+		Result* c_row = _c.data + (static_cast<size_t>(i) * _c.row_stride);
+
+		for (int j = 0; j < _columns; j++)
+		{
+			Result& value = c_row[static_cast<size_t>(j) * _c.column_stride];
+			value = (_beta == Accumulator(0)) ? Result(0) : static_cast<Result>(value * _beta);
+		}
+	}
+}
+
+// ========================================
+// [Private] Unpacked Kernel Method(s)
+// ========================================
+// y[i] = _alpha * (A x)[i] + _beta * y[i] for rows [_row_begin, _row_end).
+// A is streamed once in its contiguous direction: dot products over rows
+// (four partial sums to hide add latency) when the row is contiguous,
+// column AXPYs into y when the column is.
+template<typename Accumulator, typename Input, typename Result>
+void LinAlg::Gemm::Gemv(const BasicView<Input>& _a, const Input* _x, const int& _x_stride, Result* _y, const int& _y_stride, const int& _row_begin, const int& _row_end, const Accumulator& _alpha, const Accumulator& _beta)
+{
+	const int depth = _a.columns;
+
+	if (_a.column_stride <= _a.row_stride)
+	{
+		const bool contiguous = (_a.column_stride == 1 && _x_stride == 1);
+
+		for (int i = _row_begin; i < _row_end; i++)
+		{
+			const Input* row = _a.data + (static_cast<size_t>(i) * _a.row_stride);
+
+			Accumulator sum_0 = 0, sum_1 = 0, sum_2 = 0, sum_3 = 0;
+			int p = 0;
+
+			if (contiguous)
+			{
+				for (; p + 4 <= depth; p += 4)
+				{
+					sum_0 += static_cast<Accumulator>(row[p]) * _x[p];
+					sum_1 += static_cast<Accumulator>(row[p + 1]) * _x[p + 1];
+					sum_2 += static_cast<Accumulator>(row[p + 2]) * _x[p + 2];
+					sum_3 += static_cast<Accumulator>(row[p + 3]) * _x[p + 3];
+				}
+			}
+
+			for (; p < depth; p++)
+			{
+				sum_0 += static_cast<Accumulator>(row[static_cast<size_t>(p) * _a.column_stride]) * _x[static_cast<size_t>(p) * _x_stride];
+			}
+
+			Result& value = _y[static_cast<size_t>(i) * _y_stride];
+			value = static_cast<Result>(((_beta == Accumulator(0)) ? Accumulator(0) : (value * _beta)) + (_alpha * ((sum_0 + sum_1) + (sum_2 + sum_3))));
+		}
+
+		return;
+	}
+
+	LinAlg::Gemm::Scale(BasicOutput<Result>{ _y + (static_cast<size_t>(_row_begin) * _y_stride), _y_stride, 1 }, _row_end - _row_begin, 1, _beta);
+
+	const bool contiguous = (_a.row_stride == 1 && _y_stride == 1);
+
+	for (int p = 0; p < depth; p++)
+	{
+		const Accumulator scale = _alpha * _x[static_cast<size_t>(p) * _x_stride];
+		const Input* column = _a.data + (static_cast<size_t>(p) * _a.column_stride);
+
+		if (contiguous)
+		{
+			for (int i = _row_begin; i < _row_end; i++)
+			{
+				_y[i] = static_cast<Result>(_y[i] + (scale * column[i]));
+			}
+		}
+		else
+		{
+			for (int i = _row_begin; i < _row_end; i++)
+			{
+				Result& value = _y[static_cast<size_t>(i) * _y_stride];
+				value = static_cast<Result>(value + (scale * column[static_cast<size_t>(i) * _a.row_stride]));
+			}
+		}
+	}
+}
+
+// N x N product with every loop bound known at compile time, so the loops
+// unroll fully. Operands are gathered into local arrays first, which makes
+// the kernel independent of their strides.
+template<int N>
+void LinAlg::Gemm::FixedKernel(const View& _a, const View& _b, const Output& _c, const double& _alpha, const double& _beta)
+{
+	double a[N][N];
+	double b[N][N];
+
+	for (int i = 0; i < N; i++)
+	{
+		for (int p = 0; p < N; p++)
+		{
+			a[i][p] = _a.data[(static_cast<size_t>(i) * _a.row_stride) + (static_cast<size_t>(p) * _a.column_stride)];
+			b[i][p] = _b.data[(static_cast<size_t>(i) * _b.row_stride) + (static_cast<size_t>(p) * _b.column_stride)];
+		}
+	}
+
+	for (int i = 0; i < N; i++)
+	{
+		double accumulator[N] = {};
+
+		for (int p = 0; p < N; p++)
+		{
+			for (int j = 0; j < N; j++)
+			{
+				accumulator[j] += a[i][p] * b[p][j];
+			}
+		}
+
+		double* c_row = _c.data + (static_cast<size_t>(i) * _c.row_stride);
+
+		for (int j = 0; j < N; j++)
+		{
+			double& value = c_row[static_cast<size_t>(j) * _c.column_stride];
+			value = ((_beta == 0.0) ? 0.0 : (value * _beta)) + (_alpha * accumulator[j]);
+		}
+	}
+}
+
+// Small products straight from the strided operands: no packing buffers and
+// no threads, with NR accumulators per row segment.
+template<typename Accumulator, typename Input, typename Result>
+void LinAlg::Gemm::DirectKernel(const BasicView<Input>& _a, const BasicView<Input>& _b, const BasicOutput<Result>& _c, const Accumulator& _alpha, const Accumulator& _beta)
+{
+	const int rows = _a.rows;
+	const int columns = _b.columns;
+	const int depth = _a.columns;
+
+	for (int i = 0; i < rows; i++)
+	{
+		const Input* a_row = _a.data + (static_cast<size_t>(i) * _a.row_stride);
+		Result* c_row = _c.data + (static_cast<size_t>(i) * _c.row_stride);
+
+		for (int j_begin = 0; j_begin < columns; j_begin += LinAlg::Gemm::NR)
+		{
+			const int width = std::min(LinAlg::Gemm::NR, columns - j_begin);
+			Accumulator accumulator[LinAlg::Gemm::NR] = {};
+
+			for (int p = 0; p < depth; p++)
+			{
+				const Accumulator a_ip = a_row[static_cast<size_t>(p) * _a.column_stride];
+				const Input* b_row = _b.data + (static_cast<size_t>(p) * _b.row_stride) + (static_cast<size_t>(j_begin) * _b.column_stride);
+
+				if (_b.column_stride == 1 && width == LinAlg::Gemm::NR)
+				{
+					for (int j = 0; j < LinAlg::Gemm::NR; j++)
+					{
+						accumulator[j] += a_ip * b_row[j];
+					}
+				}
+				else
+				{
+					for (int j = 0; j < width; j++)
+					{
+						accumulator[j] += a_ip * b_row[static_cast<size_t>(j) * _b.column_stride];
+					}
+				}
+			}
+
+			for (int j = 0; j < width; j++)
+			{
+				Result& value = c_row[static_cast<size_t>(j_begin + j) * _c.column_stride];
+				value = static_cast<Result>(((_beta == Accumulator(0)) ? Accumulator(0) : (value * _beta)) + (_alpha * accumulator[j]));
+			}
+		}
+	}
+}
+
+void LinAlg::Gemm::SmallKernel(const View& _a, const View& _b, const Output& _c, const double& _alpha, const double& _beta)
+{
+	const int order = _a.rows;
+
+	if (order <= LinAlg::Gemm::FIXED_ORDER && _a.columns == order && _b.columns == order)
+	{
+		switch (order)
+		{
+		case 2: LinAlg::Gemm::FixedKernel<2>(_a, _b, _c, _alpha, _beta); return;
+		case 3: LinAlg::Gemm::FixedKernel<3>(_a, _b, _c, _alpha, _beta); return;
+		case 4: LinAlg::Gemm::FixedKernel<4>(_a, _b, _c, _alpha, _beta); return;
+		case 5: LinAlg::Gemm::FixedKernel<5>(_a, _b, _c, _alpha, _beta); return;
+		case 6: LinAlg::Gemm::FixedKernel<6>(_a, _b, _c, _alpha, _beta); return;
+		case 7: LinAlg::Gemm::FixedKernel<7>(_a, _b, _c, _alpha, _beta); return;
+		case 8: LinAlg::Gemm::FixedKernel<8>(_a, _b, _c, _alpha, _beta); return;
+		default: break;
+		}
+	}
+
+	LinAlg::Gemm::DirectKernel(_a, _b, _c, _alpha, _beta);
+}
+
+// ========================================
+// [Private] Batch Method(s)
+// ========================================
+// Element offsets of every batch entry, in row-major entry order.
+void LinAlg::Gemm::Offsets(const Batch& _batch, std::vector<long long>& _a_offsets, std::vector<long long>& _b_offsets, std::vector<long long>& _c_offsets)
+{
+	int dimensions = static_cast<int>(_batch.shape.size());
+
+	if (static_cast<int>(_batch.a_strides.size()) != dimensions || static_cast<int>(_batch.b_strides.size()) != dimensions
+		|| static_cast<int>(_batch.c_strides.size()) != dimensions)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: batch strides must match the batch rank.");
+	}
+
+	size_t count = 1;
+	for (int extent : _batch.shape)
+	{
+		count *= static_cast<size_t>(std::max(extent, 0));
+	}
+
+	_a_offsets.assign(count, 0);
+	_b_offsets.assign(count, 0);
+	_c_offsets.assign(count, 0);
+
+	std::vector<int> index(dimensions, 0);
+	long long a_offset = 0;
+	long long b_offset = 0;
+	long long c_offset = 0;
+
+	for (size_t entry = 0; entry < count; entry++)
+	{
+		_a_offsets[entry] = a_offset;
+		_b_offsets[entry] = b_offset;
+		_c_offsets[entry] = c_offset;
+
+		for (int d = dimensions - 1; d >= 0; d--)
+		{
+			a_offset += _batch.a_strides[d];
+			b_offset += _batch.b_strides[d];
+			c_offset += _batch.c_strides[d];
+
+			if (++index[d] < _batch.shape[d])
+			{
+				break;
+			}
+
+			a_offset -= _batch.a_strides[d] * _batch.shape[d];
+			b_offset -= _batch.b_strides[d] * _batch.shape[d];
+			c_offset -= _batch.c_strides[d] * _batch.shape[d];
+			index[d] = 0;
+		}
+	}
+}
+
+// ========================================
+// [Private] Tuning Method(s)
+// ========================================
+int LinAlg::Gemm::Bucket(const int& _rows, const int& _columns, const int& _depth)
+{
+	return ((_rows > LinAlg::Gemm::BUCKET_EDGE) ? 4 : 0)
+		| ((_columns > LinAlg::Gemm::BUCKET_EDGE) ? 2 : 0)
+		| ((_depth > LinAlg::Gemm::BUCKET_EDGE) ? 1 : 0);
+}
+
+bool LinAlg::Gemm::IsValid(const Blocking& _blocking)
+{
+	return LinAlg::Gemm::SelectKernel(_blocking.mr, _blocking.nr) != nullptr
+		&& _blocking.mc > 0 && _blocking.mc <= 4096 && (_blocking.mc % _blocking.mr) == 0
+		&& _blocking.kc > 0 && _blocking.kc <= 4096
+		&& _blocking.nc > 0 && _blocking.nc <= 16384 && (_blocking.nc % _blocking.nr) == 0;
+}
+
+// CPU brand string (x86) and hardware thread count: a cache file is only
+// trusted on the kind of machine that produced it.
+std::string LinAlg::Gemm::MachineSignature()
+{
+	char brand[49] = {};
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int registers[4] = {};
+	__cpuid(registers, static_cast<int>(0x80000000));
+
+	if (static_cast<unsigned int>(registers[0]) >= 0x80000004u)
+	{
+		for (int leaf = 0; leaf < 3; leaf++)
+		{
+			__cpuid(registers, static_cast<int>(0x80000002u + leaf));
+			std::memcpy(brand + (leaf * 16), registers, 16);
+		}
+	}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	unsigned int registers[4] = {};
+
+	if (__get_cpuid(0x80000000u, &registers[0], &registers[1], &registers[2], &registers[3]) && registers[0] >= 0x80000004u)
+	{
+		for (unsigned int leaf = 0; leaf < 3; leaf++)
+		{
+			__get_cpuid(0x80000002u + leaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+			std::memcpy(brand + (leaf * 16), registers, 16);
+		}
+	}
+#endif
+
+	std::string signature(brand);
+	signature.erase(0, signature.find_first_not_of(' '));
+
+	if (signature.empty())
+	{
+		signature = "unknown";
+	}
+
+	return signature + " | " + std::to_string(std::thread::hardware_concurrency()) + " threads";
+}
+
+void LinAlg::Gemm::EnsureLoaded()
+{
+	std::call_once(LinAlg::Gemm::tuning_loaded, []()
+		{
+			LinAlg::Gemm::ReadTuning(LinAlg::Gemm::TUNING_FILE);
+		});
+}
+
+// Format: a header line, a "machine <signature>" line, then one
+// "bucket <index> <mr> <nr> <mc> <kc> <nc>" line per tuned bucket.
+bool LinAlg::Gemm::ReadTuning(const std::string& _path)
+{
+	std::ifstream file(_path);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	std::string line;
+
+	if (!std::getline(file, line) || line != LinAlg::Gemm::TUNING_HEADER)
+	{
+		return false;
+	}
+
+	if (!std::getline(file, line) || line != ("machine " + LinAlg::Gemm::MachineSignature()))
+	{
+		return false;
+	}
+
+	std::array<Blocking, LinAlg::Gemm::BUCKETS> table{};
+
+	while (std::getline(file, line))
+	{
+		if (line.empty())
+		{
+			continue;
+		}
+
+		std::istringstream fields(line);
+		std::string key;
+		int bucket = -1;
+		Blocking blocking;
+
+		if (!(fields >> key >> bucket >> blocking.mr >> blocking.nr >> blocking.mc >> blocking.kc >> blocking.nc)
+			|| key != "bucket" || bucket < 0 || bucket >= LinAlg::Gemm::BUCKETS || !LinAlg::Gemm::IsValid(blocking))
+		{
+			return false;
+		}
+
+		table[bucket] = blocking;
+	}
+
+	std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+	LinAlg::Gemm::tuned_blocking = table;
+
+	return true;
+}
+
+// Best of TUNE_REPEATS timed runs (after one warm-up) of a bucket's
+// representative product under the given blocking.
+double LinAlg::Gemm::Benchmark(const Blocking& _blocking, const View& _a, const View& _b, const Output& _c)
+{
+	LinAlg::Gemm::Product<double>(_a, _b, _c, Batch(), 1.0, 0.0, &_blocking);
+
+	double best = std::numeric_limits<double>::infinity();
+
+	for (int repeat = 0; repeat < LinAlg::Gemm::TUNE_REPEATS; repeat++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		LinAlg::Gemm::Product<double>(_a, _b, _c, Batch(), 1.0, 0.0, &_blocking);
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		best = std::min(best, elapsed.count());
+	}
+
+	return best;
+}
+
+// ========================================
+// [Private] Strassen Method(s)
+// ========================================
+// _z = _x + _sign * _y element-wise; _z may alias _x or _y.
+void LinAlg::Gemm::Combine(const View& _x, const View& _y, const double& _sign, const Output& _z)
+{
+	const int rows = _x.rows;
+	const int columns = _x.columns;
+
+	const bool contiguous = (_x.column_stride == 1 && _y.column_stride == 1 && _z.column_stride == 1);
+	int grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / std::max(1, columns)));
+
+	Utils::ParallelFor(0, rows, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				const double* x = _x.data + (static_cast<size_t>(i) * _x.row_stride);
+				const double* y = _y.data + (static_cast<size_t>(i) * _y.row_stride);
+				double* z = _z.data + (static_cast<size_t>(i) * _z.row_stride);
+
+				if (contiguous)
+				{
+					for (int j = 0; j < columns; j++)
+					{
+						z[j] = x[j] + (_sign * y[j]);
+					}
+				}
+				else
+				{
+					for (int j = 0; j < columns; j++)
+					{
+						z[static_cast<size_t>(j) * _z.column_stride] = x[static_cast<size_t>(j) * _x.column_stride] + (_sign * y[static_cast<size_t>(j) * _y.column_stride]);
+					}
+				}
+			}
+		}, grain);
+}
+
+// Doubles of scratch for a Strassen product: each level needs X
+// (h_m x max(h_k, h_n)) and Y (h_k x h_n); the seven half-size products run
+// one after another and share the region behind them.
+size_t LinAlg::Gemm::StrassenWorkspace(const int& _rows, const int& _columns, const int& _depth, const int& _cutoff)
+{
+	if (std::min({ _rows, _columns, _depth }) <= _cutoff)
+	{
+		return 0;
+	}
+
+	size_t half_rows = static_cast<size_t>(_rows / 2);
+	size_t half_columns = static_cast<size_t>(_columns / 2);
+	size_t half_depth = static_cast<size_t>(_depth / 2);
+
+	return (half_rows * std::max(half_depth, half_columns)) + (half_depth * half_columns)
+		+ LinAlg::Gemm::StrassenWorkspace(_rows / 2, _columns / 2, _depth / 2, _cutoff);
+}
+
+// _c = _a * _b by the Strassen-Winograd recursion on the even-sized leading
+// blocks, in the two-temporary schedule of Douglas et al. (1994): the seven
+// products land in the quadrants of C and in X, the operand sums in X and Y.
+// Odd trailing rows, columns or depth are then added by dynamic peeling.
+void LinAlg::Gemm::Strassen(const View& _a, const View& _b, const Output& _c, const int& _cutoff, double* _workspace)
+{
+	const int rows = _a.rows;
+	const int depth = _a.columns;
+	const int columns = _b.columns;
+
+	if (std::min({ rows, depth, columns }) <= _cutoff)
+	{
+		LinAlg::Gemm::Multiply(_a, false, _b, false, _c);
+		return;
+	}
+
+	const int half_rows = rows / 2;
+	const int half_depth = depth / 2;
+	const int half_columns = columns / 2;
+
+	auto block = [](const View& _view, const int& _row, const int& _column, const int& _rows, const int& _columns) -> View
+		{
+			return { _view.data + (static_cast<size_t>(_row) * _view.row_stride) + (static_cast<size_t>(_column) * _view.column_stride), _rows, _columns, _view.row_stride, _view.column_stride };
+		};
+
+	auto output = [](const Output& _output, const int& _row, const int& _column) -> Output
+		{
+			return { _output.data + (static_cast<size_t>(_row) * _output.row_stride) + (static_cast<size_t>(_column) * _output.column_stride), _output.row_stride, _output.column_stride };
+		};
+
+	auto read = [&](const Output& _output) -> View
+		{
+			return { _output.data, half_rows, half_columns, _output.row_stride, _output.column_stride };
+		};
+
+	View a11 = block(_a, 0, 0, half_rows, half_depth);
+	View a12 = block(_a, 0, half_depth, half_rows, half_depth);
+	View a21 = block(_a, half_rows, 0, half_rows, half_depth);
+	View a22 = block(_a, half_rows, half_depth, half_rows, half_depth);
+
+	View b11 = block(_b, 0, 0, half_depth, half_columns);
+	View b12 = block(_b, 0, half_columns, half_depth, half_columns);
+	View b21 = block(_b, half_depth, 0, half_depth, half_columns);
+	View b22 = block(_b, half_depth, half_columns, half_depth, half_columns);
+
+	Output c11 = output(_c, 0, 0);
+	Output c12 = output(_c, 0, half_columns);
+	Output c21 = output(_c, half_rows, 0);
+	Output c22 = output(_c, half_rows, half_columns);
+
+	double* x_data = _workspace;
+	double* y_data = x_data + (static_cast<size_t>(half_rows) * std::max(half_depth, half_columns));
+	double* deeper = y_data + (static_cast<size_t>(half_depth) * half_columns);
+
+	// X holds an h_m x h_k operand sum, and later the h_m x h_n product M1.
+	View x_sum{ x_data, half_rows, half_depth, half_depth, 1 };
+	Output x_sum_out{ x_data, half_depth, 1 };
+	View x_product{ x_data, half_rows, half_columns, half_columns, 1 };
+	Output x_product_out{ x_data, half_columns, 1 };
+
+	View y{ y_data, half_depth, half_columns, half_columns, 1 };
+	Output y_out{ y_data, half_columns, 1 };
+
+	LinAlg::Gemm::Combine(a11, a21, -1.0, x_sum_out); // S3 = A11 - A21
+	LinAlg::Gemm::Combine(b22, b12, -1.0, y_out); // T3 = B22 - B12
+	LinAlg::Gemm::Strassen(x_sum, y, c21, _cutoff, deeper); // C21 = M7 = S3 T3
+	LinAlg::Gemm::Combine(a21, a22, 1.0, x_sum_out); // S1 = A21 + A22
+	LinAlg::Gemm::Combine(b12, b11, -1.0, y_out); // T1 = B12 - B11
+	LinAlg::Gemm::Strassen(x_sum, y, c22, _cutoff, deeper); // C22 = M5 = S1 T1
+	LinAlg::Gemm::Combine(x_sum, a11, -1.0, x_sum_out); // S2 = S1 - A11
+	LinAlg::Gemm::Combine(b22, y, -1.0, y_out); // T2 = B22 - T1
+	LinAlg::Gemm::Strassen(x_sum, y, c12, _cutoff, deeper); // C12 = M6 = S2 T2
+	LinAlg::Gemm::Combine(a12, x_sum, -1.0, x_sum_out); // S4 = A12 - S2
+	LinAlg::Gemm::Strassen(x_sum, b22, c11, _cutoff, deeper); // C11 = M3 = S4 B22
+	LinAlg::Gemm::Strassen(a11, b11, x_product_out, _cutoff, deeper); // X = M1 = A11 B11
+	LinAlg::Gemm::Combine(x_product, read(c12), 1.0, c12); // C12 = U2 = M1 + M6
+	LinAlg::Gemm::Combine(read(c12), read(c21), 1.0, c21); // C21 = U3 = U2 + M7
+	LinAlg::Gemm::Combine(read(c12), read(c22), 1.0, c12); // C12 = U4 = U2 + M5
+	LinAlg::Gemm::Combine(read(c21), read(c22), 1.0, c22); // C22 = U3 + M5
+	LinAlg::Gemm::Combine(read(c12), read(c11), 1.0, c12); // C12 = U4 + M3
+	LinAlg::Gemm::Combine(y, b21, -1.0, y_out); // T4 = T2 - B21
+	LinAlg::Gemm::Strassen(a22, y, c11, _cutoff, deeper); // C11 = M4 = A22 T4
+	LinAlg::Gemm::Combine(read(c21), read(c11), -1.0, c21); // C21 = U3 - M4
+	LinAlg::Gemm::Strassen(a12, b21, c11, _cutoff, deeper); // C11 = M2 = A12 B21
+	LinAlg::Gemm::Combine(x_product, read(c11), 1.0, c11); // C11 = M1 + M2
+
+	const int even_rows = 2 * half_rows;
+	const int even_columns = 2 * half_columns;
+
+	if (depth != 2 * half_depth)
+	{
+		LinAlg::Gemm::Multiply(block(_a, 0, depth - 1, even_rows, 1), false, block(_b, depth - 1, 0, 1, even_columns), false, _c, 1.0, 1.0);
+	}
+
+	if (columns != even_columns)
+	{
+		LinAlg::Gemm::Multiply(block(_a, 0, 0, even_rows, depth), false, block(_b, 0, columns - 1, depth, 1), false, output(_c, 0, columns - 1));
+	}
+
+	if (rows != even_rows)
+	{
+		LinAlg::Gemm::Multiply(block(_a, rows - 1, 0, 1, depth), false, _b, false, output(_c, rows - 1, 0));
+	}
+}
+
+// ========================================
+// [Private] Product Method(s)
+// ========================================
+template<typename Accumulator, typename Input, typename Result>
+void LinAlg::Gemm::Product(const BasicView<Input>& _a, const BasicView<Input>& _b, const BasicOutput<Result>& _c, const Batch& _batch, const Accumulator& _alpha, const Accumulator& _beta, const Blocking* _blocking)
+{
+	constexpr bool all_double = std::is_same_v<Accumulator, double> && std::is_same_v<Input, double> && std::is_same_v<Result, double>;
+
+	BasicView<Input> a = _a;
+	BasicView<Input> b = _b;
+
+	// A lone small product needs no batch bookkeeping, threads or buffers.
+	if (_batch.shape.empty() && a.rows > 1 && b.columns > 1 && a.columns > 0 && _alpha != Accumulator(0)
+		&& static_cast<long long>(a.rows) * b.columns * a.columns <= LinAlg::Gemm::SMALL_WORK)
+	{
+		if constexpr (all_double)
+		{
+			LinAlg::Gemm::SmallKernel(a, b, _c, _alpha, _beta);
+		}
+		else
+		{
+			LinAlg::Gemm::DirectKernel(a, b, _c, _alpha, _beta);
+		}
+
+		return;
+	}
+
+	std::vector<long long> a_offsets;
+	std::vector<long long> b_offsets;
+	std::vector<long long> c_offsets;
+
+	LinAlg::Gemm::Offsets(_batch, a_offsets, b_offsets, c_offsets);
+
+	int count = static_cast<int>(c_offsets.size());
+	int rows = a.rows;
+	int columns = b.columns;
+	int depth = a.columns;
+
+	if (count == 0 || rows <= 0 || columns <= 0)
+	{
+		return;
+	}
+
+	if (depth <= 0 || _alpha == Accumulator(0))
+	{
+		for (int entry = 0; entry < count; entry++)
+		{
+			LinAlg::Gemm::Scale(BasicOutput<Result>{ _c.data + c_offsets[entry], _c.row_stride, _c.column_stride }, rows, columns, _beta);
+		}
+
+		return;
+	}
+
+	bool shared_b = std::all_of(b_offsets.begin(), b_offsets.end(), [](long long _offset) { return _offset == 0; });
+
+	// [B, T, K] @ [K, N] with consecutive T-row blocks is one [B * T, K] @ [K, N].
+	if (shared_b && count > 1)
+	{
+		bool consecutive = true;
+
+		for (int entry = 0; entry < count && consecutive; entry++)
+		{
+			consecutive = (a_offsets[entry] == static_cast<long long>(entry) * rows * a.row_stride)
+				&& (c_offsets[entry] == static_cast<long long>(entry) * rows * _c.row_stride);
+		}
+
+		if (consecutive)
+		{
+			a.rows = rows * count;
+			rows = a.rows;
+			count = 1;
+		}
+	}
+
+	// Matrix-vector shapes: C = op(A) x for a single column, and a single
+	// row is the transposed product C^T = op(B)^T x.
+	if (rows == 1 || columns == 1)
+	{
+		const bool column = (columns == 1);
+
+		BasicView<Input> matrix = column ? a : LinAlg::Gemm::Apply(b, true);
+		const std::vector<long long>& matrix_offsets = column ? a_offsets : b_offsets;
+		const std::vector<long long>& vector_offsets = column ? b_offsets : a_offsets;
+
+		const Input* x = column ? b.data : a.data;
+		const int x_stride = column ? b.row_stride : a.column_stride;
+		const int y_stride = column ? _c.row_stride : _c.column_stride;
+
+		const int length = matrix.rows;
+
+		if (count == 1)
+		{
+			int grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / depth));
+
+			Utils::ParallelFor(0, length, [&](int begin, int end)
+				{
+					LinAlg::Gemm::Gemv(matrix, x, x_stride, _c.data, y_stride, begin, end, _alpha, _beta);
+				}, grain);
+
+			return;
+		}
+
+		int grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / (static_cast<long long>(length) * depth)));
+
+		Utils::ParallelFor(0, count, [&](int begin, int end)
+			{
+				for (int entry = begin; entry < end; entry++)
+				{
+					BasicView<Input> matrix_entry = matrix;
+					matrix_entry.data += matrix_offsets[entry];
+
+					LinAlg::Gemm::Gemv(matrix_entry, x + vector_offsets[entry], x_stride, _c.data + c_offsets[entry], y_stride, 0, length, _alpha, _beta);
+				}
+			}, grain);
+
+		return;
+	}
+
+	long long work = static_cast<long long>(rows) * columns * depth;
+
+	if (work <= LinAlg::Gemm::SMALL_WORK)
+	{
+		int grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / work));
+
+		Utils::ParallelFor(0, count, [&](int begin, int end)
+			{
+				for (int entry = begin; entry < end; entry++)
+				{
+					BasicView<Input> a_entry = a;
+					a_entry.data += a_offsets[entry];
+
+					BasicView<Input> b_entry = b;
+					b_entry.data += b_offsets[entry];
+
+					const BasicOutput<Result> c_entry{ _c.data + c_offsets[entry], _c.row_stride, _c.column_stride };
+
+					if constexpr (all_double)
+					{
+						LinAlg::Gemm::SmallKernel(a_entry, b_entry, c_entry, _alpha, _beta);
+					}
+					else
+					{
+						LinAlg::Gemm::DirectKernel(a_entry, b_entry, c_entry, _alpha, _beta);
+					}
+				}
+			}, grain);
+
+		return;
+	}
+
+	if constexpr (all_double)
+	{
+		const int cutoff = LinAlg::Gemm::strassen_cutoff.load(std::memory_order_relaxed);
+
+		if (cutoff > 0 && _blocking == nullptr && count == 1 && std::min({ rows, columns, depth }) > cutoff)
+		{
+			std::vector<double> workspace(LinAlg::Gemm::StrassenWorkspace(rows, columns, depth, cutoff));
+
+			if (_alpha == 1.0 && _beta == 0.0)
+			{
+				LinAlg::Gemm::Strassen(a, b, _c, cutoff, workspace.data());
+				return;
+			}
+
+			std::vector<double> product(static_cast<size_t>(rows) * columns);
+			LinAlg::Gemm::Strassen(a, b, { product.data(), columns, 1 }, cutoff, workspace.data());
+
+			LinAlg::Gemm::Scale(_c, rows, columns, _beta);
+			LinAlg::Gemm::Combine({ _c.data, rows, columns, _c.row_stride, _c.column_stride }, { product.data(), rows, columns, columns, 1 }, _alpha, _c);
+
+			return;
+		}
+	}
+
+	// A result narrower than the accumulator (float from double, 16-bit from
+	// float) is staged per tile in the accumulator type and rounded once,
+	// after the last depth block, instead of once per depth block.
+	constexpr bool staged = !std::is_same_v<Accumulator, Result>;
+	using Target = std::conditional_t<staged, Accumulator, Result>;
+
+	const Blocking blocking = (_blocking != nullptr) ? *_blocking : LinAlg::Gemm::GetBlocking(rows, columns, depth);
+	const Kernel<Accumulator, Target> kernel = LinAlg::Gemm::SelectKernel<Accumulator, Target>(blocking.mr, blocking.nr);
+
+	const int mr = blocking.mr;
+	const int nr = blocking.nr;
+	const int mc = blocking.mc;
+	const int kc = blocking.kc;
+	const int nc = blocking.nc;
+
+	int row_tiles = (rows + mc - 1) / mc;
+	int column_tiles = (columns + nc - 1) / nc;
+	int tiles = row_tiles * column_tiles;
+
+	// A shared op(B) used by more than one row tile is packed once, up front,
+	// as KC-deep blocks of NR-column strips; every task then reads its panel
+	// at [depth_begin * padded_columns + column_begin * block_depth].
+	bool prepacked = shared_b && (static_cast<long long>(count) * row_tiles > 1);
+
+	int padded_columns = ((columns + nr - 1) / nr) * nr;
+	int depth_blocks = (depth + kc - 1) / kc;
+
+	using Packed = PackedType<Accumulator>;
+
+	std::vector<Packed> panel;
+
+	if (prepacked)
+	{
+		panel.resize(static_cast<size_t>(depth) * padded_columns);
+
+		long long pack_work = static_cast<long long>(std::min(depth, kc)) * std::min(columns, nc);
+		int pack_grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / pack_work));
+
+		Utils::ParallelFor(0, depth_blocks * column_tiles, [&](int begin, int end)
+			{
+				for (int task = begin; task < end; task++)
+				{
+					int depth_begin = (task / column_tiles) * kc;
+					int column_begin = (task % column_tiles) * nc;
+
+					int block_depth = std::min(kc, depth - depth_begin);
+					int tile_columns = std::min(nc, columns - column_begin);
+
+					LinAlg::Gemm::PackB(b, depth_begin, column_begin, block_depth, tile_columns, nr,
+						panel.data() + (static_cast<size_t>(depth_begin) * padded_columns) + (static_cast<size_t>(column_begin) * block_depth));
+				}
+			}, pack_grain);
+	}
+
+	long long tile_work = static_cast<long long>(std::min(rows, mc)) * std::min(columns, nc) * depth;
+	int grain = static_cast<int>(std::max(1LL, LinAlg::Gemm::PARALLEL_WORK / tile_work));
+
+	// Packing buffers sized to the largest block this product actually uses.
+	const int panel_depth = std::min(depth, kc);
+	const int a_panel_rows = ((std::min(rows, mc) + mr - 1) / mr) * mr;
+	const int b_panel_columns = ((std::min(columns, nc) + nr - 1) / nr) * nr;
+
+	// Each task owns one MC x NC tile of one batch entry of C and packs its
+	// own A blocks; without a shared panel it also packs its B panel, which
+	// costs about 1 / MC of the tile's arithmetic.
+	Utils::ParallelFor(0, count * tiles, [&](int begin, int end)
+		{
+			std::vector<Packed> packed_a(static_cast<size_t>(a_panel_rows) * panel_depth);
+			std::vector<Packed> packed_b(prepacked ? 0 : static_cast<size_t>(panel_depth) * b_panel_columns);
+			std::vector<Target> staging(staged ? static_cast<size_t>(std::min(rows, mc)) * std::min(columns, nc) : 0);
+
+			for (int task = begin; task < end; task++)
+			{
+				int entry = task / tiles;
+				int tile = task % tiles;
+
+				int row_begin = (tile / column_tiles) * mc;
+				int column_begin = (tile % column_tiles) * nc;
+
+				int tile_rows = std::min(mc, rows - row_begin);
+				int tile_columns = std::min(nc, columns - column_begin);
+
+				BasicView<Input> a_entry = a;
+				a_entry.data += a_offsets[entry];
+
+				BasicView<Input> b_entry = b;
+				b_entry.data += b_offsets[entry];
+
+				Result* c_tile = _c.data + c_offsets[entry] + (static_cast<size_t>(row_begin) * _c.row_stride) + (static_cast<size_t>(column_begin) * _c.column_stride);
+
+				Target* target = nullptr;
+				int target_row_stride = 0;
+				int target_column_stride = 0;
+
+				if constexpr (staged)
+				{
+					target = staging.data();
+					target_row_stride = tile_columns;
+					target_column_stride = 1;
+
+					for (int i = 0; i < tile_rows; i++)
+					{
+						for (int j = 0; j < tile_columns; j++)
+						{
+							const Result& value = c_tile[(static_cast<size_t>(i) * _c.row_stride) + (static_cast<size_t>(j) * _c.column_stride)];
+							staging[(static_cast<size_t>(i) * tile_columns) + j] = (_beta == Accumulator(0)) ? Accumulator(0) : (_beta * static_cast<Accumulator>(value));
+						}
+					}
+				}
+				else
+				{
+					LinAlg::Gemm::Scale(BasicOutput<Result>{ c_tile, _c.row_stride, _c.column_stride }, tile_rows, tile_columns, _beta);
+
+					target = c_tile;
+					target_row_stride = _c.row_stride;
+					target_column_stride = _c.column_stride;
+				}
+
+				for (int depth_begin = 0; depth_begin < depth; depth_begin += kc)
+				{
+					int block_depth = std::min(kc, depth - depth_begin);
+
+					const Packed* b_block = packed_b.data();
+
+					if (prepacked)
+					{
+						b_block = panel.data() + (static_cast<size_t>(depth_begin) * padded_columns) + (static_cast<size_t>(column_begin) * block_depth);
+					}
+					else
+					{
+						LinAlg::Gemm::PackB(b_entry, depth_begin, column_begin, block_depth, tile_columns, nr, packed_b.data());
+					}
+
+					LinAlg::Gemm::PackA(a_entry, row_begin, depth_begin, tile_rows, block_depth, mr, packed_a.data());
+
+					for (int j = 0; j < tile_columns; j += nr)
+					{
+						const Packed* b_strip = b_block + (static_cast<size_t>(j) * block_depth);
+
+						for (int i = 0; i < tile_rows; i += mr)
+						{
+							const Packed* a_strip = packed_a.data() + (static_cast<size_t>(i) * block_depth);
+
+							kernel(block_depth, a_strip, b_strip, _alpha,
+								target + (static_cast<size_t>(i) * target_row_stride) + (static_cast<size_t>(j) * target_column_stride),
+								target_row_stride, target_column_stride,
+								std::min(mr, tile_rows - i), std::min(nr, tile_columns - j));
+						}
+					}
+				}
+
+				if constexpr (staged)
+				{
+					for (int i = 0; i < tile_rows; i++)
+					{
+						for (int j = 0; j < tile_columns; j++)
+						{
+							c_tile[(static_cast<size_t>(i) * _c.row_stride) + (static_cast<size_t>(j) * _c.column_stride)] = static_cast<Result>(staging[(static_cast<size_t>(i) * tile_columns) + j]);
+						}
+					}
+				}
+			}
+		}, grain);
+}
+
+// ========================================
+// Multiplication Method(s)
+// ========================================
+void LinAlg::Gemm::Multiply(const View& _a, const bool& _transpose_a, const View& _b, const bool& _transpose_b, const Output& _c, const double& _alpha, const double& _beta)
+{
+	LinAlg::Gemm::Multiply(_a, _transpose_a, _b, _transpose_b, _c, Batch(), _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const View& _a, const bool& _transpose_a, const View& _b, const bool& _transpose_b, const Output& _c, const Batch& _batch, const double& _alpha, const double& _beta)
+{
+	View a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	View b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<double>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Accumulation& _accumulation, const float& _alpha, const float& _beta)
+{
+	LinAlg::Gemm::Multiply(_a, _transpose_a, _b, _transpose_b, _c, Batch(), _accumulation, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch, const Accumulation& _accumulation, const float& _alpha, const float& _beta)
+{
+	BasicView<float> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<float> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	if (_accumulation == Accumulation::Double)
+	{
+		LinAlg::Gemm::Product<double>(a, b, _c, _batch, static_cast<double>(_alpha), static_cast<double>(_beta));
+	}
+	else
+	{
+		LinAlg::Gemm::Product<float>(a, b, _c, _batch, _alpha, _beta);
+	}
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const Output& _c, const double& _alpha, const double& _beta)
+{
+	LinAlg::Gemm::Multiply(_a, _transpose_a, _b, _transpose_b, _c, Batch(), _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const Output& _c, const Batch& _batch, const double& _alpha, const double& _beta)
+{
+	BasicView<float> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<float> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<double>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<BFloat16>& _a, const bool& _transpose_a, const BasicView<BFloat16>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch, const float& _alpha, const float& _beta)
+{
+	BasicView<BFloat16> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<BFloat16> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<float>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<BFloat16>& _a, const bool& _transpose_a, const BasicView<BFloat16>& _b, const bool& _transpose_b, const BasicOutput<BFloat16>& _c, const Batch& _batch, const float& _alpha, const float& _beta)
+{
+	BasicView<BFloat16> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<BFloat16> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<float>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<Float16>& _a, const bool& _transpose_a, const BasicView<Float16>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch, const float& _alpha, const float& _beta)
+{
+	BasicView<Float16> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<Float16> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<float>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<Float16>& _a, const bool& _transpose_a, const BasicView<Float16>& _b, const bool& _transpose_b, const BasicOutput<Float16>& _c, const Batch& _batch, const float& _alpha, const float& _beta)
+{
+	BasicView<Float16> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<Float16> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	LinAlg::Gemm::Product<float>(a, b, _c, _batch, _alpha, _beta);
+}
+
+void LinAlg::Gemm::Multiply(const BasicView<int8_t>& _a, const bool& _transpose_a, const BasicView<int8_t>& _b, const bool& _transpose_b, const BasicOutput<int32_t>& _c, const Batch& _batch, const int32_t& _alpha, const int32_t& _beta)
+{
+	BasicView<int8_t> a = LinAlg::Gemm::Apply(_a, _transpose_a);
+	BasicView<int8_t> b = LinAlg::Gemm::Apply(_b, _transpose_b);
+
+	if (a.columns != b.rows)
+	{
+		throw std::invalid_argument("[Gemm] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(a.columns) + " and " + std::to_string(b.rows) + ").");
+	}
+
+	if (a.columns > LinAlg::Gemm::INT8_MAX_DEPTH)
+	{
+		throw std::overflow_error("[Gemm] Multiplication failed: int8 product depth " + std::to_string(a.columns)
+			+ " exceeds " + std::to_string(LinAlg::Gemm::INT8_MAX_DEPTH) + ", the int32 accumulator could overflow.");
+	}
+
+	LinAlg::Gemm::Product<int32_t>(a, b, _c, _batch, _alpha, _beta);
+}
+
+// ========================================
+// Tuning Method(s)
+// ========================================
+void LinAlg::Gemm::Tune(const std::string& _path)
+{
+	LinAlg::Gemm::EnsureLoaded();
+
+	static constexpr int kernels[][2] = { { 4, 4 }, { 4, 8 }, { 8, 4 }, { 8, 8 } };
+	static constexpr int kc_candidates[] = { 128, 192, 256, 384, 512 };
+	static constexpr int mc_candidates[] = { 32, 48, 64, 96, 128, 192, 256 };
+	static constexpr int nc_candidates[] = { 256, 512, 1024, 2048, 4096 };
+
+	const int large_side = LinAlg::Gemm::TUNE_LARGE;
+	const int small_side = LinAlg::Gemm::TUNE_SMALL;
+
+	std::vector<double> a_data(static_cast<size_t>(large_side) * large_side);
+	std::vector<double> b_data(static_cast<size_t>(large_side) * large_side);
+	std::vector<double> c_data(static_cast<size_t>(large_side) * large_side);
+
+	for (size_t i = 0; i < a_data.size(); i++)
+	{
+		a_data[i] = static_cast<double>((i * 7) % 13) - 6.0;
+		b_data[i] = static_cast<double>((i * 5) % 11) - 5.0;
+	}
+
+	for (int bucket = 0; bucket < LinAlg::Gemm::BUCKETS; bucket++)
+	{
+		int rows = (bucket & 4) ? large_side : small_side;
+		int columns = (bucket & 2) ? large_side : small_side;
+		int depth = (bucket & 1) ? large_side : small_side;
+
+		View a{ a_data.data(), rows, depth, depth, 1 };
+		View b{ b_data.data(), depth, columns, columns, 1 };
+		Output c{ c_data.data(), columns, 1 };
+
+		Blocking best;
+		{
+			std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+			best = LinAlg::Gemm::tuned_blocking[bucket];
+		}
+
+		double best_time = LinAlg::Gemm::Benchmark(best, a, b, c);
+
+		auto consider = [&](const Blocking& _candidate)
+			{
+				if (!LinAlg::Gemm::IsValid(_candidate))
+				{
+					return;
+				}
+
+				double time = LinAlg::Gemm::Benchmark(_candidate, a, b, c);
+
+				if (time < best_time)
+				{
+					best = _candidate;
+					best_time = time;
+				}
+			};
+
+		// One parameter at a time, each search starting from the best so far.
+		for (const auto& kernel : kernels)
+		{
+			Blocking candidate = best;
+			candidate.mr = kernel[0];
+			candidate.nr = kernel[1];
+			candidate.mc = ((candidate.mc + candidate.mr - 1) / candidate.mr) * candidate.mr;
+			candidate.nc = ((candidate.nc + candidate.nr - 1) / candidate.nr) * candidate.nr;
+			consider(candidate);
+		}
+
+		for (int kc : kc_candidates)
+		{
+			Blocking candidate = best;
+			candidate.kc = kc;
+			consider(candidate);
+		}
+
+		for (int mc : mc_candidates)
+		{
+			Blocking candidate = best;
+			candidate.mc = mc;
+			consider(candidate);
+		}
+
+		for (int nc : nc_candidates)
+		{
+			Blocking candidate = best;
+			candidate.nc = nc;
+			consider(candidate);
+		}
+
+		std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+		LinAlg::Gemm::tuned_blocking[bucket] = best;
+	}
+
+	LinAlg::Gemm::SaveTuning(_path);
+}
+
+bool LinAlg::Gemm::LoadTuning(const std::string& _path)
+{
+	LinAlg::Gemm::EnsureLoaded();
+
+	return LinAlg::Gemm::ReadTuning(_path);
+}
+
+void LinAlg::Gemm::SaveTuning(const std::string& _path)
+{
+	LinAlg::Gemm::EnsureLoaded();
+
+	std::array<Blocking, LinAlg::Gemm::BUCKETS> table;
+	{
+		std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+		table = LinAlg::Gemm::tuned_blocking;
+	}
+
+	std::ofstream file(_path, std::ios::trunc);
+
+	if (!file)
+	{
+		throw std::runtime_error("[Gemm] Saving tuning failed: cannot write '" + _path + "'.");
+	}
+
+	file << LinAlg::Gemm::TUNING_HEADER << "\n";
+	file << "machine " << LinAlg::Gemm::MachineSignature() << "\n";
+
+	for (int bucket = 0; bucket < LinAlg::Gemm::BUCKETS; bucket++)
+	{
+		const Blocking& blocking = table[bucket];
+
+		file << "bucket " << bucket << " " << blocking.mr << " " << blocking.nr << " "
+			<< blocking.mc << " " << blocking.kc << " " << blocking.nc << "\n";
+	}
+
+	if (!file)
+	{
+		throw std::runtime_error("[Gemm] Saving tuning failed: cannot write '" + _path + "'.");
+	}
+}
+
+void LinAlg::Gemm::ResetTuning()
+{
+	LinAlg::Gemm::EnsureLoaded();
+
+	std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+	LinAlg::Gemm::tuned_blocking.fill(Blocking());
+}
+
+LinAlg::Gemm::Blocking LinAlg::Gemm::GetBlocking(const int& _rows, const int& _columns, const int& _depth)
+{
+	LinAlg::Gemm::EnsureLoaded();
+
+	std::lock_guard<std::mutex> lock(LinAlg::Gemm::tuning_mutex);
+	return LinAlg::Gemm::tuned_blocking[LinAlg::Gemm::Bucket(_rows, _columns, _depth)];
+}
+
+// ========================================
+// Strassen Method(s)
+// ========================================
+void LinAlg::Gemm::SetStrassenCutoff(const int& _cutoff)
+{
+	if (_cutoff < 0)
+	{
+		throw std::invalid_argument("[Gemm] Setting Strassen cutoff failed: cutoff must be >= 0.");
+	}
+
+	int cutoff = (_cutoff == 0) ? 0 : std::max(_cutoff, LinAlg::Gemm::STRASSEN_MIN_CUTOFF);
+	LinAlg::Gemm::strassen_cutoff.store(cutoff, std::memory_order_relaxed);
+}
+
+int LinAlg::Gemm::GetStrassenCutoff()
+{
+	return LinAlg::Gemm::strassen_cutoff.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,300 @@
+#pragma once
+
+#include "HalfPrecision.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace LinAlg
+{
+    // General matrix multiply C = alpha * op(A) * op(B) + beta * C with
+    // op(X) = X or X^T, on strided operands: element (i, j) of a view is
+    // data[i * row_stride + j * column_stride]. Transposed, sliced or
+    // column-major operands are therefore read in place; the transpose flags
+    // only swap a view's strides.
+    //
+    // The product is computed in cache blocks: a KC x NC panel of op(B) and
+    // an MC x KC block of op(A) are packed into contiguous, zero-padded
+    // buffers (which is where arbitrary strides are absorbed), and an
+    // MR x NR register tile of C is accumulated from them by the
+    // micro-kernel. Work is split across threads over MC x NC tiles of C.
+    //
+    // Products too small to amortize packing skip it: matrix-vector shapes
+    // run a GEMV that streams the matrix once (dot products when its rows
+    // are contiguous, column AXPYs when its columns are), square products of
+    // order 2 to FIXED_ORDER use kernels unrolled at compile time, and other
+    // products of at most SMALL_WORK multiply-adds accumulate straight from
+    // the strided operands.
+    //
+    // Batched products describe their batch with per-dimension element
+    // strides; a stride of 0 broadcasts an operand along that dimension, so
+    // shared operands (e.g. weights) are never replicated. A shared op(B) is
+    // packed once and reused by every batch entry, and when the entries of
+    // op(A) and C are consecutive row blocks the batch is folded into the
+    // rows of a single product.
+    //
+    // The micro-kernel shape and the MC / KC / NC blocking of packed
+    // products are chosen per shape bucket (each of rows, columns and depth
+    // up to BUCKET_EDGE or above). Tune benchmarks candidates on the local
+    // machine and saves the winners to a cache file; the default cache file
+    // in the working directory is loaded on the first packed product, and
+    // files written on a different machine are ignored.
+    //
+    // Optionally, single products whose sides all exceed the Strassen cutoff
+    // use the Winograd variant of Strassen's recursion (7 half-size products
+    // and 15 additions per level, so each level saves 1/8 of the
+    // multiply-adds); odd sides are peeled off and finished with rank-1 /
+    // GEMV updates, and the leaves run the blocked product. The recursion is
+    // only normwise stable: with u the unit round-off, n0 the leaf size and
+    // n the side, |C - fl(C)| <= [(n0^2 + 6 n0) (n / n0)^log2(18) - 6 n] u
+    // max|A| max|B| + O(u^2) (Higham, Accuracy and Stability of Numerical
+    // Algorithms, 2nd ed., Sec. 23.2.2), versus n u |A| |B| elementwise for
+    // the blocked product. Small entries of C next to large entries of A or
+    // B therefore lose relative accuracy; it is off (cutoff 0) by default.
+    //
+    // Besides double, float operands are supported with a float or double
+    // result and accumulator, and BFloat16 / Float16 operands with a float
+    // accumulator and a float or 16-bit result: the packed blocks and
+    // register tiles are kept in the accumulator type (elements are widened
+    // while packing, so the kernels never see 16-bit data) and the result is
+    // rounded once per update of C.
+    //
+    // int8_t operands (quantized inference) accumulate exactly in int32_t:
+    // they are packed as int16_t, and when the build targets AVX2 the
+    // micro-kernel multiplies two depth steps at a time with vpmaddwd
+    // (vpdpwssd with AVX-VNNI), the pairwise int16 multiply-add that
+    // quantized kernels are built on.
+    class Gemm
+    {
+    public:
+        // Element (i, j) is data[i * row_stride + j * column_stride].
+        template<typename T>
+        struct BasicView
+        {
+            const T* data = nullptr;
+            int rows = 0;
+            int columns = 0;
+            int row_stride = 0;
+            int column_stride = 1;
+        };
+
+        template<typename T>
+        struct BasicOutput
+        {
+            T* data = nullptr;
+            int row_stride = 0;
+            int column_stride = 1;
+        };
+
+        using View = BasicView<double>;
+        using Output = BasicOutput<double>;
+
+        // Accumulator type of products with float operands: Single keeps the
+        // packed blocks and register tiles in float (twice the vector width
+        // and half the packing traffic of double), Double widens each element
+        // as it is packed, for an error bound of about n * 2^-53 instead of
+        // n * 2^-24 relative to |A| |B|.
+        enum class Accumulation
+        {
+            Single,
+            Double
+        };
+
+        // Entry e of the batch (row-major over shape) starts at
+        // sum_d index_d(e) * strides[d] elements in each operand.
+        struct Batch
+        {
+            std::vector<int> shape;
+            std::vector<long long> a_strides;
+            std::vector<long long> b_strides;
+            std::vector<long long> c_strides;
+        };
+
+        // Register tile (mr x nr) and cache blocks of the packed path.
+        struct Blocking
+        {
+            int mr = Gemm::MR;
+            int nr = Gemm::NR;
+            int mc = Gemm::MC;
+            int kc = Gemm::KC;
+            int nc = Gemm::NC;
+        };
+
+    private:
+        // Element type of the packed blocks: the accumulator type, or int16_t
+        // for int8_t operands accumulated in int32_t.
+        template<typename Accumulator>
+        using PackedType = std::conditional_t<std::is_integral_v<Accumulator>, int16_t, Accumulator>;
+
+        template<typename Accumulator, typename Result>
+        using Kernel = void (*)(const int&, const PackedType<Accumulator>*, const PackedType<Accumulator>*, const Accumulator&, Result*, const int&, const int&, const int&, const int&);
+
+        // ========== Constants ==========
+        static constexpr int MR = 4;
+        static constexpr int NR = 8;
+
+        static constexpr int MC = 64;
+        static constexpr int KC = 256;
+        static constexpr int NC = 1024;
+
+        static constexpr int FIXED_ORDER = 8;
+        static constexpr long long SMALL_WORK = 1LL << 15;
+
+        // Longest int8_t product whose int32_t sum cannot overflow (each term
+        // is at most 128 * 128 = 2^14 in magnitude).
+        static constexpr int INT8_MAX_DEPTH = (1 << 17) - 1;
+
+        // Multiply-adds per thread chunk below which threads are not worth it.
+        static constexpr long long PARALLEL_WORK = 1LL << 20;
+
+        static constexpr int BUCKET_EDGE = 256;
+        static constexpr int BUCKETS = 8;
+
+        // Representative extents of the small and large sides of a bucket.
+        static constexpr int TUNE_SMALL = 128;
+        static constexpr int TUNE_LARGE = 512;
+        static constexpr int TUNE_REPEATS = 3;
+
+        // Strassen leaves never shrink below this side, whatever the cutoff.
+        static constexpr int STRASSEN_MIN_CUTOFF = 64;
+
+        static constexpr const char* TUNING_FILE = "gemm_tuning.cache";
+        static constexpr const char* TUNING_HEADER = "OpenTENet GEMM tuning v1";
+
+        static inline std::mutex tuning_mutex;
+        static inline std::once_flag tuning_loaded;
+        static std::array<Blocking, BUCKETS> tuned_blocking;
+
+        static inline std::atomic<int> strassen_cutoff{ 0 };
+
+    private:
+        template<typename T>
+        static BasicView<T> Apply(const BasicView<T>& _view, const bool& _transpose);
+
+        template<typename Packed, typename Input>
+        static void PackA(const BasicView<Input>& _a, const int& _row_begin, const int& _depth_begin, const int& _rows, const int& _depth, const int& _mr, Packed* _buffer);
+
+        template<typename Packed, typename Input>
+        static void PackB(const BasicView<Input>& _b, const int& _depth_begin, const int& _column_begin, const int& _depth, const int& _columns, const int& _nr, Packed* _buffer);
+
+        template<typename Accumulator, typename Result, int R, int C>
+        static void MicroKernel(const int& _depth, const PackedType<Accumulator>* _a, const PackedType<Accumulator>* _b, const Accumulator& _alpha, Result* _c, const int& _c_row_stride, const int& _c_column_stride, const int& _rows, const int& _columns);
+
+        template<typename Accumulator = double, typename Result = double>
+        static Kernel<Accumulator, Result> SelectKernel(const int& _mr, const int& _nr);
+
+        template<typename Result, typename Accumulator>
+        static void Scale(const BasicOutput<Result>& _c, const int& _rows, const int& _columns, const Accumulator& _beta);
+
+        template<typename Accumulator, typename Input, typename Result>
+        static void Gemv(const BasicView<Input>& _a, const Input* _x, const int& _x_stride, Result* _y, const int& _y_stride, const int& _row_begin, const int& _row_end, const Accumulator& _alpha, const Accumulator& _beta);
+
+        template<int N>
+        static void FixedKernel(const View& _a, const View& _b, const Output& _c, const double& _alpha, const double& _beta);
+
+        template<typename Accumulator, typename Input, typename Result>
+        static void DirectKernel(const BasicView<Input>& _a, const BasicView<Input>& _b, const BasicOutput<Result>& _c, const Accumulator& _alpha, const Accumulator& _beta);
+
+        static void SmallKernel(const View& _a, const View& _b, const Output& _c, const double& _alpha, const double& _beta);
+
+        static void Offsets(const Batch& _batch, std::vector<long long>& _a_offsets, std::vector<long long>& _b_offsets, std::vector<long long>& _c_offsets);
+
+        static int Bucket(const int& _rows, const int& _columns, const int& _depth);
+
+        static bool IsValid(const Blocking& _blocking);
+
+        static std::string MachineSignature();
+
+        static void EnsureLoaded();
+
+        static bool ReadTuning(const std::string& _path);
+
+        static double Benchmark(const Blocking& _blocking, const View& _a, const View& _b, const Output& _c);
+
+        static void Combine(const View& _x, const View& _y, const double& _sign, const Output& _z);
+
+        static size_t StrassenWorkspace(const int& _rows, const int& _columns, const int& _depth, const int& _cutoff);
+
+        static void Strassen(const View& _a, const View& _b, const Output& _c, const int& _cutoff, double* _workspace);
+
+        // Batched product of already transposed operands, accumulated in
+        // Accumulator and rounded once into Result. A given _blocking
+        // replaces the tuned one and bypasses the Strassen recursion, so Tune
+        // can time candidates without publishing them.
+        template<typename Accumulator, typename Input, typename Result>
+        static void Product(const BasicView<Input>& _a, const BasicView<Input>& _b, const BasicOutput<Result>& _c, const Batch& _batch, const Accumulator& _alpha, const Accumulator& _beta, const Blocking* _blocking = nullptr);
+
+    public:
+        static void Multiply(const View& _a, const bool& _transpose_a, const View& _b, const bool& _transpose_b, const Output& _c, const double& _alpha = 1.0, const double& _beta = 0.0);
+
+        // One product per batch entry; _a, _b and _c describe entry 0.
+        static void Multiply(const View& _a, const bool& _transpose_a, const View& _b, const bool& _transpose_b, const Output& _c, const Batch& _batch, const double& _alpha = 1.0, const double& _beta = 0.0);
+
+        // Single precision operands and result, accumulated as _accumulation
+        // selects. The Strassen recursion and the fixed-order kernels are
+        // double only.
+        static void Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Accumulation& _accumulation = Accumulation::Single, const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        static void Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch, const Accumulation& _accumulation = Accumulation::Single, const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        // Single precision operands, double accumulation and result.
+        static void Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const Output& _c, const double& _alpha = 1.0, const double& _beta = 0.0);
+
+        static void Multiply(const BasicView<float>& _a, const bool& _transpose_a, const BasicView<float>& _b, const bool& _transpose_b, const Output& _c, const Batch& _batch, const double& _alpha = 1.0, const double& _beta = 0.0);
+
+        // 16-bit operands, float accumulation, float or 16-bit result.
+        static void Multiply(const BasicView<BFloat16>& _a, const bool& _transpose_a, const BasicView<BFloat16>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch = Batch(), const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        static void Multiply(const BasicView<BFloat16>& _a, const bool& _transpose_a, const BasicView<BFloat16>& _b, const bool& _transpose_b, const BasicOutput<BFloat16>& _c, const Batch& _batch = Batch(), const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        static void Multiply(const BasicView<Float16>& _a, const bool& _transpose_a, const BasicView<Float16>& _b, const bool& _transpose_b, const BasicOutput<float>& _c, const Batch& _batch = Batch(), const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        static void Multiply(const BasicView<Float16>& _a, const bool& _transpose_a, const BasicView<Float16>& _b, const bool& _transpose_b, const BasicOutput<Float16>& _c, const Batch& _batch = Batch(), const float& _alpha = 1.0f, const float& _beta = 0.0f);
+
+        // int8_t operands, exact int32_t accumulation and result (the raw
+        // products of quantized values; zero points and scales are applied
+        // by the caller). Depth is limited to INT8_MAX_DEPTH; _alpha and
+        // _beta other than 1 and 0 may overflow.
+        static void Multiply(const BasicView<int8_t>& _a, const bool& _transpose_a, const BasicView<int8_t>& _b, const bool& _transpose_b, const BasicOutput<int32_t>& _c, const Batch& _batch = Batch(), const int32_t& _alpha = 1, const int32_t& _beta = 0);
+
+        // Benchmarks micro-kernel shapes and block sizes for every bucket on
+        // this machine (one parameter at a time, starting from the current
+        // choice), adopts the fastest and writes them to _path. Takes
+        // seconds. Candidates are timed on the packed path (never through
+        // Strassen) and only the winners are published.
+        static void Tune(const std::string& _path = TUNING_FILE);
+
+        // Adopts the blockings saved in _path. Returns false, keeping the
+        // current ones, when the file is missing, malformed or was written on
+        // another machine.
+        static bool LoadTuning(const std::string& _path = TUNING_FILE);
+
+        static void SaveTuning(const std::string& _path = TUNING_FILE);
+
+        static void ResetTuning();
+
+        static Blocking GetBlocking(const int& _rows, const int& _columns, const int& _depth);
+
+        // Single products with rows, columns and depth all above _cutoff use
+        // the Strassen-Winograd recursion (Matrix::MatMul and Tensor::MatMul
+        // included); 0 disables it. Process-wide. Cutoffs below
+        // STRASSEN_MIN_CUTOFF are raised to it.
+        static void SetStrassenCutoff(const int& _cutoff);
+
+        static int GetStrassenCutoff();
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+// ========================================
+// BFloat16 / Float16 Classes
+// ========================================
+// 16-bit floating point storage types. Neither does arithmetic of its own:
+// values widen implicitly to float, which is where kernels compute, and are
+// narrowed back explicitly with round-to-nearest-even.
+//
+//   BFloat16 - the upper half of a float: float's 8-bit exponent (same
+//              range) with 7 mantissa bits, about 2-3 significant digits.
+//   Float16  - IEEE 754 binary16: 5-bit exponent (largest finite 65504,
+//              subnormals below 2^-14) with 10 mantissa bits, about 3-4
+//              significant digits. Values beyond the range become +-Inf.
+//
+// NaN stays NaN (quiet) in both directions. The scalar conversions are
+// branch-free bit manipulations so loops over them vectorize; bulk
+// conversions go through Conversion, which uses F16C where the build
+// targets it.
+class BFloat16
+{
+private:
+    uint16_t bits = 0;
+
+public:
+    BFloat16() = default;
+
+    explicit BFloat16(const float& _value);
+
+    operator float() const;
+
+    static BFloat16 FromBits(const uint16_t& _bits);
+
+    uint16_t Bits() const;
+};
+
+class Float16
+{
+private:
+    uint16_t bits = 0;
+
+public:
+    Float16() = default;
+
+    explicit Float16(const float& _value);
+
+    operator float() const;
+
+    static Float16 FromBits(const uint16_t& _bits);
+
+    uint16_t Bits() const;
+};
+
+#include "HalfPrecision.inl"
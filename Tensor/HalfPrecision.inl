@@ -0,0 +1,101 @@
+#include "HalfPrecision.h"
+
+// ========================================
+// BFloat16 Method(s)
+// ========================================
+// Adding 0x7FFF plus the lowest kept bit carries into the kept half exactly
+// when the dropped half rounds up (ties to even); NaN only needs its quiet
+// bit, since truncating could clear every mantissa bit and leave Inf.
+inline BFloat16::BFloat16(const float& _value)
+{
+    const uint32_t f = std::bit_cast<uint32_t>(_value);
+
+    const uint32_t rounded = (f + 0x7FFFu + ((f >> 16) & 1u)) >> 16;
+    const uint32_t quiet = (f >> 16) | 0x0040u;
+
+    this->bits = static_cast<uint16_t>(((f & 0x7FFFFFFFu) > 0x7F800000u) ? quiet : rounded);
+}
+
+inline BFloat16::operator float() const
+{
+    return std::bit_cast<float>(static_cast<uint32_t>(this->bits) << 16);
+}
+
+inline BFloat16 BFloat16::FromBits(const uint16_t& _bits)
+{
+    BFloat16 value;
+    value.bits = _bits;
+
+    return value;
+}
+
+inline uint16_t BFloat16::Bits() const
+{
+    return this->bits;
+}
+
+// ========================================
+// Float16 Method(s)
+// ========================================
+// All three cases are computed and one is blended in with masks, which
+// keeps loops over the conversion free of branches (F. Giesen's
+// float_to_half_fast3_rtne):
+//   normal    - rebias the exponent by 15 - 127 and round the 13 dropped
+//               mantissa bits to nearest even, as for BFloat16; a carry out
+//               of the largest binade gives Inf
+//   subnormal - below 2^-14, adding 0.5f shifts the value onto the
+//               binary16 subnormal grid and the FPU does the rounding
+//   overflow  - 65536 and beyond become Inf, NaN a quiet NaN
+inline Float16::Float16(const float& _value)
+{
+    uint32_t f = std::bit_cast<uint32_t>(_value);
+
+    const uint32_t sign = f & 0x80000000u;
+    f ^= sign;
+
+    const uint32_t normal = (f + 0xC8000FFFu + ((f >> 13) & 1u)) >> 13;
+    const uint32_t subnormal = std::bit_cast<uint32_t>(std::bit_cast<float>(f) + 0.5f) - 0x3F000000u;
+    const uint32_t overflow = 0x7C00u | (0x0200u & (0u - static_cast<uint32_t>(f > 0x7F800000u)));
+
+    const uint32_t is_overflow = 0u - static_cast<uint32_t>(f >= 0x47800000u);
+    const uint32_t is_subnormal = 0u - static_cast<uint32_t>(f < 0x38800000u);
+
+    const uint32_t magnitude = (overflow & is_overflow) | (subnormal & is_subnormal) | (normal & ~(is_overflow | is_subnormal));
+
+    this->bits = static_cast<uint16_t>(magnitude | (sign >> 16));
+}
+
+// The exponent and mantissa move to float's positions and the exponent is
+// rebiased by 127 - 15; Inf / NaN get the maximum exponent, and subnormals
+// are renormalized by subtracting 2^-14 in float.
+inline Float16::operator float() const
+{
+    const uint32_t h = this->bits;
+
+    const uint32_t shifted = (h & 0x7FFFu) << 13;
+    const uint32_t exponent = shifted & 0x0F800000u;
+
+    const uint32_t normal = shifted + 0x38000000u;
+    const uint32_t special = shifted + 0x70000000u;
+    const uint32_t subnormal = std::bit_cast<uint32_t>(std::bit_cast<float>(shifted + 0x38800000u) - std::bit_cast<float>(0x38800000u));
+
+    const uint32_t is_special = 0u - static_cast<uint32_t>(exponent == 0x0F800000u);
+    const uint32_t is_subnormal = 0u - static_cast<uint32_t>(exponent == 0);
+
+    const uint32_t magnitude = (special & is_special) | (subnormal & is_subnormal) | (normal & ~(is_special | is_subnormal));
+
+    return std::bit_cast<float>(magnitude | ((h & 0x8000u) << 16));
+}
+
+inline Float16 Float16::FromBits(const uint16_t& _bits)
+{
+    Float16 value;
+    value.bits = _bits;
+
+    return value;
+}
+
+inline uint16_t Float16::Bits() const
+{
+    return this->bits;
+}
@@ -25,3 +25,5 @@ double Activation::HardShrink::df(double x) const
 {
     return (std::fabs(x) > this->threshold) ? 1.0 : 0.0;
 }
+
+template class Activation::ScalarActivationImpl<Activation::HardShrink>;
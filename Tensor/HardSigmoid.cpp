@@ -10,3 +10,5 @@ double Activation::HardSigmoid::df(double x) const
 {
 	return (x <= -3 || x >= 3) ? 0 : (1 / 6);
 }
+
+template class Activation::ScalarActivationImpl<Activation::HardSigmoid>;
@@ -10,3 +10,5 @@ double Activation::HardSwish::df(double x) const
 {
 	return (x <= -3) ? 0 : ((x >= 3) ? 1 : ((x / 3) + 0.5));
 }
+
+template class Activation::ScalarActivationImpl<Activation::HardSwish>;
@@ -10,3 +10,5 @@ double Activation::HardTanh::df(double x) const
 {
 	return (x < -1 || x > 1) ? 0 : 1;
 }
+
+template class Activation::ScalarActivationImpl<Activation::HardTanh>;
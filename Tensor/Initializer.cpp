@@ -231,8 +231,7 @@ Tensor Initializer::Orthogonal(const std::pair<int, int>& _axes, const double& _
 
     std::vector<int> permuted_shape = Utils::Permute(this->shape, permutation);
 
-    std::vector<double> tensor_data;
-    tensor_data.reserve(this->volume);
+    Tensor param_tensor(permuted_shape, 0.0);
 
     for (int i = 0; i < n_matrix; i++)
     {
@@ -244,11 +243,10 @@ Tensor Initializer::Orthogonal(const std::pair<int, int>& _axes, const double& _
         LinAlg::Matrix result = qr.Q * sign_values;
         result = result.MultiplyColumnwise(sign_values);
 
-        std::vector<double> flat_data = result.GetFlatData();
-        tensor_data.insert(tensor_data.end(), flat_data.begin(), flat_data.end());
+        // Write straight into the i-th matrix of the parameter Tensor.
+        param_tensor.MatrixView(i).Patch(result, { 0, 0 }, { rows, columns });
     }
 
-    Tensor param_tensor(permuted_shape, tensor_data);
     param_tensor *= _gain;
 
     std::vector<int> rev_permutation(this->rank);
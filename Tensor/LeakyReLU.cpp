@@ -25,3 +25,5 @@ double Activation::LeakyReLU::df(double x) const
 {
     return (x >= 0.0) ? 1.0 : this->alpha;
 }
+
+template class Activation::ScalarActivationImpl<Activation::LeakyReLU>;
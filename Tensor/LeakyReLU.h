@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class LeakyReLU : public ScalarActivation
+    class LeakyReLU : public ScalarActivationImpl<LeakyReLU>
     {
     private:
         double alpha;
@@ -20,4 +20,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<LeakyReLU>;
 };
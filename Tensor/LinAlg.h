@@ -1,5 +1,8 @@
 #pragma once
 
 #include "Matrix.h"
+#include "BandedMatrix.h"
 #include "MatrixDecompResult.h"
 #include "MatrixProperties.h"
+#include "PivotedQR.h"
+#include "Gemm.h"
@@ -10,3 +10,5 @@ double Activation::Linear::df(double x) const
 {
 	return 1.0;
 }
+
+template class Activation::ScalarActivationImpl<Activation::Linear>;
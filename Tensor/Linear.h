@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class Linear : public ScalarActivation
+	class Linear : public ScalarActivationImpl<Linear>
 	{
 	public:
 		using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
 		double df(double x) const override;
 	};
+
+	extern template class ScalarActivationImpl<Linear>;
 };
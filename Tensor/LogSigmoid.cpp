@@ -1,13 +1,24 @@
 #include "LogSigmoid.h"
 #include "Sigmoid.h"
+#include "FastMath.h"
 
 
 double Activation::LogSigmoid::f(double x) const
 {
-	return std::log(Activation::Sigmoid().f(x));
+	return FastMath::Log(Activation::Sigmoid().f(x));
 }
 
 double Activation::LogSigmoid::df(double x) const
 {
 	return 1 - Activation::Sigmoid().f(x);
 }
+
+void Activation::LogSigmoid::fdf(double x, double& value, double& derivative) const
+{
+	double s = Activation::Sigmoid().f(x);
+
+	value = FastMath::Log(s);
+	derivative = 1 - s;
+}
+
+template class Activation::ScalarActivationImpl<Activation::LogSigmoid>;
@@ -2,6 +2,7 @@
 #include "Math.h"
 #include "Matrix.h"
 #include "Tensor.h"
+#include "FastMath.h"
 
 
 Activation::LogSoftmax::LogSoftmax(int axis)
@@ -11,34 +12,53 @@ Activation::LogSoftmax::LogSoftmax(int axis)
 
 Tensor Activation::LogSoftmax::f(const Tensor& tensor) const
 {
-    if (tensor.IsEmpty())
-    {
-        throw std::runtime_error("[Activation] LogSoftmax failed: empty Tensor.");
-    }
+    TensorActivation::ResolveAxis(tensor, this->axis, "LogSoftmax");
 
-    if (tensor.IsScalar())
-    {
-        throw std::invalid_argument("[Activation] LogSoftmax failed: cannot apply LogSoftmax to scalar. LogSoftmax requires at least 2 elements.");
-    }
+    Tensor output(tensor.Shape(), 0.0);
+    this->f(tensor, output);
 
-    int actual_axis = (this->axis < 0) ? (tensor.Rank() + this->axis) : this->axis;
+    return output;
+}
 
-    if (actual_axis < 0 || actual_axis >= tensor.Rank())
-    {
-        throw std::out_of_range("[Activation] Softmax failed: axis out of range.");
-    }
+// Writes into a preallocated output (reshaped if needed); output may be tensor itself.
+void Activation::LogSoftmax::f(const Tensor& tensor, Tensor& output) const
+{
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "LogSoftmax");
+
+    TensorActivation::PrepareOutput(tensor, output);
+    TensorActivation::SoftmaxKernel(&*tensor.begin(), &*output.begin(), layout, true);
+}
 
-    Tensor max_vals = tensor.ReduceMax(actual_axis);
-    Tensor shifted = tensor - max_vals.ExpandRank(actual_axis);
-    Tensor exp_vals = Math::Exp(shifted);
-    Tensor sum_exp = exp_vals.ReduceSum(actual_axis);
+// The Jacobian I - 1 * s^T is fully determined by the probabilities s.
+Tensor Activation::LogSoftmax::df(const Tensor& tensor) const
+{
+    return Activation::Softmax(this->axis).f(tensor);
+}
 
-    Tensor log_sum = Math::Log(sum_exp);
+void Activation::LogSoftmax::df(const Tensor& tensor, Tensor& output) const
+{
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "LogSoftmax");
 
-    return (shifted - log_sum.ExpandRank(actual_axis));
+    TensorActivation::PrepareOutput(tensor, output);
+    TensorActivation::SoftmaxKernel(&*tensor.begin(), &*output.begin(), layout, false);
 }
 
-Tensor Activation::LogSoftmax::df(const Tensor& tensor) const
+// The probabilities are recovered as exp(log-probabilities), saving the
+// second max/sum sweep.
+std::pair<Tensor, Tensor> Activation::LogSoftmax::fdf(const Tensor& tensor) const
+{
+    Tensor log_probabilities = this->f(tensor);
+    Tensor probabilities = log_probabilities;
+
+    for (double& value : probabilities)
+    {
+        value = FastMath::Exp(value);
+    }
+
+    return { std::move(log_probabilities), std::move(probabilities) };
+}
+
+Tensor Activation::LogSoftmax::Jacobian(const Tensor& tensor) const
 {
     auto func = Activation::Softmax(this->axis);
     Tensor result = func.f(tensor);
@@ -53,7 +73,7 @@ Tensor Activation::LogSoftmax::df(const Tensor& tensor) const
 
     result = result.Broadcast(broadcast_shape);
 
-    Tensor identity_matrix(LinAlg::Matrix::Identity(size));
+    Tensor identity_matrix = Tensor::View(LinAlg::Matrix::Identity(size));
 
     std::vector<int> shape(result.Rank(), 1);
     shape[actual_axis] = size;
@@ -65,3 +85,19 @@ Tensor Activation::LogSoftmax::df(const Tensor& tensor) const
 
     return jacobian;
 }
+
+// grad - s * sum(grad) per row.
+Tensor Activation::LogSoftmax::VJP(const Tensor& tensor, const Tensor& grad) const
+{
+    Tensor probabilities = Activation::Softmax(this->axis).f(tensor);
+
+    return TensorActivation::Product(probabilities, grad, this->axis, ProductKind::LogSoftmaxVJP, "LogSoftmax VJP");
+}
+
+// tangent - <s, tangent> per row.
+Tensor Activation::LogSoftmax::JVP(const Tensor& tensor, const Tensor& tangent) const
+{
+    Tensor probabilities = Activation::Softmax(this->axis).f(tensor);
+
+    return TensorActivation::Product(probabilities, tangent, this->axis, ProductKind::LogSoftmaxJVP, "LogSoftmax JVP");
+}
@@ -14,6 +14,18 @@ namespace Activation
 
 		Tensor f(const Tensor& tensor) const override;
 
+		void f(const Tensor& tensor, Tensor& output) const override;
+
 		Tensor df(const Tensor& tensor) const override;
+
+		void df(const Tensor& tensor, Tensor& output) const override;
+
+		std::pair<Tensor, Tensor> fdf(const Tensor& tensor) const override;
+
+		Tensor Jacobian(const Tensor& tensor) const override;
+
+		Tensor VJP(const Tensor& tensor, const Tensor& grad) const override;
+
+		Tensor JVP(const Tensor& tensor, const Tensor& tangent) const override;
 	};
 };
@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 
+#include "FastMath.h"
+
 // Forward declarations
 class Tensor;
 class Matrix;
@@ -25,43 +27,107 @@ concept MathContainer = std::same_as<T, Tensor> || std::same_as<T, Matrix>;
 // ========================================
 class Math
 {
+public:
+    // How out-of-domain elements are handled by the checked functions:
+    //   Throw     - validate first, throw on the first offending element (default)
+    //   Propagate - no checks; IEEE results (NaN / Inf) flow through
+    //   Report    - like Propagate, plus the count and first flat index of
+    //               offending elements written to a DomainReport
+    enum class DomainPolicy
+    {
+        Throw,
+        Propagate,
+        Report
+    };
+
+    struct DomainReport
+    {
+        int count = 0;
+        int first_index = -1;
+    };
+
 private:
     static constexpr double EXP_BASE_LIMIT = 700.0;
     static constexpr double EPSILON_SCALE = 1e6;
 
+    // out[i] = func(x[i]), with out resized to x's shape (its storage is
+    // reused when the shape already matches). out may be x itself.
+    template <MathContainer T, typename Func>
+    static void Map(const T& x, T& out, Func func);
+
+    // Map under policy; is_invalid must be branch-free so the validation
+    // pass vectorizes, raise throws for a given value. Validation reads x
+    // before out is touched, so a throwing in-place call leaves x intact.
+    template <MathContainer T, typename Func, typename Predicate, typename Raise>
+    static void Evaluate(const T& x, T& out, Func func, Predicate is_invalid, Raise raise, DomainPolicy policy, DomainReport* report);
+
 public:
+    // Every function has an out-parameter overload, Fn(x, out, ...), which
+    // writes into a caller-owned Tensor and allocates only when out's shape
+    // differs from x's; Fn(x, x, ...) works in place.
+
     // ========================================
     // Elementary Methods
     // ========================================
     template <MathContainer T>
     static T Abs(const T& x);
 
+    template <MathContainer T>
+    static void Abs(const T& x, T& out);
+
     template <MathContainer T>
     static T Ceil(const T& x);
 
+    template <MathContainer T>
+    static void Ceil(const T& x, T& out);
+
     template <MathContainer T>
     static T Clip(const T& x, double min_value, double max_value);
 
     template <MathContainer T>
-    static T Exp(const T& x);
+    static void Clip(const T& x, T& out, double min_value, double max_value);
+
+    template <MathContainer T>
+    static T Exp(const T& x, FastMath::Precision precision = FastMath::GetPrecision(), DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Exp(const T& x, T& out, FastMath::Precision precision = FastMath::GetPrecision(), DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Floor(const T& x);
 
     template <MathContainer T>
-    static T Log(const T& x, double base = std::numbers::e);
+    static void Floor(const T& x, T& out);
+
+    template <MathContainer T>
+    static T Log(const T& x, double base = std::numbers::e, FastMath::Precision precision = FastMath::GetPrecision(), DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Log(const T& x, T& out, double base = std::numbers::e, FastMath::Precision precision = FastMath::GetPrecision(), DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Mod(const T& x, double mod_value);
 
     template <MathContainer T>
-    static T Power(const T& x, double exponent);
+    static void Mod(const T& x, T& out, double mod_value);
+
+    template <MathContainer T>
+    static T Power(const T& x, double exponent, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Power(const T& x, T& out, double exponent, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Round(const T& x, int decimal_place = 2);
 
     template <MathContainer T>
-    static T Sqrt(const T& x);
+    static void Round(const T& x, T& out, int decimal_place = 2);
+
+    template <MathContainer T>
+    static T Sqrt(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Sqrt(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     // ========================================
     // Trigonometric Methods
@@ -69,62 +135,116 @@ public:
     template <MathContainer T>
     static T Sin(const T& x);
 
+    template <MathContainer T>
+    static void Sin(const T& x, T& out);
+
     template <MathContainer T>
     static T Cos(const T& x);
 
     template <MathContainer T>
-    static T Tan(const T& x);
+    static void Cos(const T& x, T& out);
+
+    template <MathContainer T>
+    static T Tan(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Tan(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Csc(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Csc(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Sec(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Csc(const T& x);
+    static void Sec(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Sec(const T& x);
+    static T Cot(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Cot(const T& x);
+    static void Cot(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     // ========================================
     // Inverse Trigonometric Methods
     // ========================================
     template <MathContainer T>
-    static T Asin(const T& x);
+    static T Asin(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Asin(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Acos(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Acos(const T& x);
+    static void Acos(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Atan(const T& x);
 
     template <MathContainer T>
-    static T Acsc(const T& x);
+    static void Atan(const T& x, T& out);
 
     template <MathContainer T>
-    static T Asec(const T& x);
+    static T Acsc(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Acsc(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Asec(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Asec(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Acot(const T& x);
 
+    template <MathContainer T>
+    static void Acot(const T& x, T& out);
+
     // ========================================
     // Hyperbolic Methods
     // ========================================
     template <MathContainer T>
     static T Sinh(const T& x);
 
+    template <MathContainer T>
+    static void Sinh(const T& x, T& out);
+
     template <MathContainer T>
     static T Cosh(const T& x);
 
     template <MathContainer T>
-    static T Tanh(const T& x);
+    static void Cosh(const T& x, T& out);
+
+    template <MathContainer T>
+    static T Tanh(const T& x, FastMath::Precision precision = FastMath::GetPrecision());
+
+    template <MathContainer T>
+    static void Tanh(const T& x, T& out, FastMath::Precision precision = FastMath::GetPrecision());
 
     template <MathContainer T>
-    static T Csch(const T& x);
+    static T Csch(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Csch(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
     static T Sech(const T& x);
 
     template <MathContainer T>
-    static T Coth(const T& x);
+    static void Sech(const T& x, T& out);
+
+    template <MathContainer T>
+    static T Coth(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Coth(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     // ========================================
     // Inverse Hyperbolic Methods
@@ -133,19 +253,37 @@ public:
     static T Asinh(const T& x);
 
     template <MathContainer T>
-    static T Acosh(const T& x);
+    static void Asinh(const T& x, T& out);
+
+    template <MathContainer T>
+    static T Acosh(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Acosh(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Atanh(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Atanh(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static T Acsch(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
+
+    template <MathContainer T>
+    static void Acsch(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Atanh(const T& x);
+    static T Asech(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Acsch(const T& x);
+    static void Asech(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Asech(const T& x);
+    static T Acoth(const T& x, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 
     template <MathContainer T>
-    static T Acoth(const T& x);
+    static void Acoth(const T& x, T& out, DomainPolicy policy = DomainPolicy::Throw, DomainReport* report = nullptr);
 };
 
 #include "Math.inl"
\ No newline at end of file
@@ -1,10 +1,89 @@
+// ========================================
+// [Private] Domain Policy Method(s)
+// ========================================
+template <MathContainer T, typename Func>
+void Math::Map(const T& x, T& out, Func func)
+{
+    if (x.IsEmpty())
+    {
+        throw std::runtime_error("[Math] Evaluation failed: input is empty.");
+    }
+
+    out.Resize(x);
+
+    const double* input = &*x.begin();
+    double* output = &*out.begin();
+    const int count = x.Volume();
+
+    for (int i = 0; i < count; i++)
+    {
+        output[i] = func(input[i]);
+    }
+}
+
+template <MathContainer T, typename Func, typename Predicate, typename Raise>
+void Math::Evaluate(const T& x, T& out, Func func, Predicate is_invalid, Raise raise, DomainPolicy policy, DomainReport* report)
+{
+    if (policy == DomainPolicy::Report && report == nullptr)
+    {
+        throw std::invalid_argument("[Math] Evaluation failed: Report policy requires a DomainReport.");
+    }
+
+    if (x.IsEmpty())
+    {
+        throw std::runtime_error("[Math] Evaluation failed: input is empty.");
+    }
+
+    const double* data = &*x.begin();
+    const int count = x.Volume();
+
+    if (policy != DomainPolicy::Propagate)
+    {
+        // Branch-free count first; the first index is only searched for when
+        // something is actually out of domain.
+        int invalid_count = 0;
+        for (int i = 0; i < count; i++)
+        {
+            invalid_count += is_invalid(data[i]) ? 1 : 0;
+        }
+
+        int first_index = -1;
+        if (invalid_count > 0)
+        {
+            first_index = static_cast<int>(std::find_if(data, data + count, is_invalid) - data);
+        }
+
+        if (policy == DomainPolicy::Throw && invalid_count > 0)
+        {
+            raise(data[first_index]);
+        }
+
+        if (policy == DomainPolicy::Report)
+        {
+            report->count = invalid_count;
+            report->first_index = first_index;
+        }
+    }
+
+    Math::Map(x, out, func);
+}
+
 // ========================================
 // Elementary Methods
 // ========================================
 template <MathContainer T>
 T Math::Abs(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Abs(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Abs(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::abs(value);
         });
 }
@@ -12,13 +91,31 @@ T Math::Abs(const T& x)
 template <MathContainer T>
 T Math::Ceil(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Ceil(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Ceil(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::ceil(value);
         });
 }
 
 template <MathContainer T>
 T Math::Clip(const T& x, double min_value, double max_value)
+{
+    T result;
+    Math::Clip(x, result, min_value, max_value);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Clip(const T& x, T& out, double min_value, double max_value)
 {
     if (!std::isfinite(min_value))
     {
@@ -35,34 +132,58 @@ T Math::Clip(const T& x, double min_value, double max_value)
         throw std::invalid_argument("[Math] Clip Function failed: min_value cannot be greater than max_value.");
     }
 
-    return x.Apply([=](double value) {
+    Math::Map(x, out, [=](double value) {
         return std::clamp(value, min_value, max_value);
         });
 }
 
 template <MathContainer T>
-T Math::Exp(const T& x)
+T Math::Exp(const T& x, FastMath::Precision precision, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value > EXP_BASE_LIMIT)
-        {
-            throw std::invalid_argument("[Math] Exponent Function failed: detected large value, " + std::to_string(value) + " - may cause overflow.");
-        }
+    T result;
+    Math::Exp(x, result, precision, policy, report);
 
-        return std::exp(value);
-        });
+    return result;
+}
+
+template <MathContainer T>
+void Math::Exp(const T& x, T& out, FastMath::Precision precision, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return FastMath::Exp(value, precision); },
+        [](double value) { return value > Math::EXP_BASE_LIMIT; },
+        [](double value) { throw std::invalid_argument("[Math] Exponent Function failed: detected large value, " + std::to_string(value) + " - may cause overflow."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Floor(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Floor(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Floor(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::floor(value);
         });
 }
 
 template <MathContainer T>
-T Math::Log(const T& x, double base)
+T Math::Log(const T& x, double base, FastMath::Precision precision, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Log(x, result, base, precision, policy, report);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Log(const T& x, T& out, double base, FastMath::Precision precision, DomainPolicy policy, DomainReport* report)
 {
     if (base <= 0.0 || base < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
     {
@@ -76,66 +197,96 @@ T Math::Log(const T& x, double base)
 
     const double log_base = std::log(base);
 
-    return x.Apply([=](double value) {
-        if (value <= 0.0 || value < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
-        {
-            throw std::invalid_argument("[Math] Logarithm Function failed: detected non-positive value, " + std::to_string(value) + " - logarithm is undefined.");
-        }
-
-        return std::log(value) / log_base;
-        });
+    Math::Evaluate(x, out,
+        [=](double value) { return FastMath::Log(value, precision) / log_base; },
+        [](double value) { return (value <= 0.0) | (value < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE); },
+        [](double value) { throw std::invalid_argument("[Math] Logarithm Function failed: detected non-positive value, " + std::to_string(value) + " - logarithm is undefined."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Mod(const T& x, double mod_value)
+{
+    T result;
+    Math::Mod(x, result, mod_value);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Mod(const T& x, T& out, double mod_value)
 {
     if (std::abs(mod_value) < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
     {
         throw std::domain_error("[Math] Modulus Function failed: modulus value cannot be 0 or (~0).");
     }
 
-    return x.Apply([=](double value) {
+    Math::Map(x, out, [=](double value) {
         return std::fmod(value, mod_value);
         });
 }
 
 template <MathContainer T>
-T Math::Power(const T& x, double exponent)
+T Math::Power(const T& x, double exponent, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([=](double value) {
-        if (value < 0.0 && std::fmod(exponent, 1.0) != 0.0)
-        {
-            throw std::domain_error("[Math] Power Function failed: negative base detected with non-integer exponent -results non-real number.");
-        }
+    T result;
+    Math::Power(x, result, exponent, policy, report);
 
-        return std::pow(value, exponent);
-        });
+    return result;
+}
+
+template <MathContainer T>
+void Math::Power(const T& x, T& out, double exponent, DomainPolicy policy, DomainReport* report)
+{
+    // Negative bases are only a problem for non-integer exponents.
+    const bool fractional = (std::fmod(exponent, 1.0) != 0.0);
+
+    Math::Evaluate(x, out,
+        [=](double value) { return std::pow(value, exponent); },
+        [=](double value) { return fractional & (value < 0.0); },
+        [](double value) { throw std::domain_error("[Math] Power Function failed: negative base detected with non-integer exponent -results non-real number."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Round(const T& x, int decimal_place)
+{
+    T result;
+    Math::Round(x, result, decimal_place);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Round(const T& x, T& out, int decimal_place)
 {
     if (decimal_place < 0)
         throw std::invalid_argument("[Math] Round Function failed: decimal_place cannot be negative.");
 
     const double power_of_10 = std::pow(10.0, decimal_place);
 
-    return x.Apply([=](double value) {
+    Math::Map(x, out, [=](double value) {
         return std::round(value * power_of_10) / power_of_10;
         });
 }
 
 template <MathContainer T>
-T Math::Sqrt(const T& x)
+T Math::Sqrt(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value < 0.0)
-        {
-            throw std::domain_error("[Math] Sqrt Function failed: negative value found in input, " + std::to_string(value));
-        }
+    T result;
+    Math::Sqrt(x, result, policy, report);
 
-        return std::sqrt(value);
-        });
+    return result;
+}
+
+template <MathContainer T>
+void Math::Sqrt(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::sqrt(value); },
+        [](double value) { return value < 0.0; },
+        [](double value) { throw std::domain_error("[Math] Sqrt Function failed: negative value found in input, " + std::to_string(value)); },
+        policy, report);
 }
 
 // ========================================
@@ -144,7 +295,16 @@ T Math::Sqrt(const T& x)
 template <MathContainer T>
 T Math::Sin(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Sin(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Sin(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::sin(value);
         });
 }
@@ -152,138 +312,205 @@ T Math::Sin(const T& x)
 template <MathContainer T>
 T Math::Cos(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Cos(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Cos(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::cos(value);
         });
 }
 
 template <MathContainer T>
-T Math::Tan(const T& x)
+T Math::Tan(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double cos_value = std::cos(value);
+    T result;
+    Math::Tan(x, result, policy, report);
 
-        if (std::abs(cos_value) < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Tangent Function failed: undefined near odd multiples of pi/2.");
-        }
+    return result;
+}
 
-        return std::tan(value);
-        });
+template <MathContainer T>
+void Math::Tan(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::tan(value); },
+        [](double value) { return std::abs(std::cos(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Tangent Function failed: undefined near odd multiples of pi/2."); },
+        policy, report);
 }
 
 template <MathContainer T>
-T Math::Csc(const T& x)
+T Math::Csc(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double sin_value = std::sin(value);
+    T result;
+    Math::Csc(x, result, policy, report);
 
-        if (std::abs(sin_value) < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Cosecant Function failed: undefined near multiples of pi.");
-        }
+    return result;
+}
 
-        return 1.0 / sin_value;
-        });
+template <MathContainer T>
+void Math::Csc(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return 1.0 / std::sin(value); },
+        [](double value) { return std::abs(std::sin(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Cosecant Function failed: undefined near multiples of pi."); },
+        policy, report);
 }
 
 template <MathContainer T>
-T Math::Sec(const T& x)
+T Math::Sec(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double cos_value = std::cos(value);
+    T result;
+    Math::Sec(x, result, policy, report);
 
-        if (std::abs(cos_value) < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Secant Function failed: undefined near odd multiples of pi/2.");
-        }
+    return result;
+}
 
-        return 1.0 / cos_value;
-        });
+template <MathContainer T>
+void Math::Sec(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return 1.0 / std::cos(value); },
+        [](double value) { return std::abs(std::cos(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Secant Function failed: undefined near odd multiples of pi/2."); },
+        policy, report);
 }
 
 template <MathContainer T>
-T Math::Cot(const T& x)
+T Math::Cot(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double sin_value = std::sin(value);
+    T result;
+    Math::Cot(x, result, policy, report);
 
-        if (std::abs(sin_value) < std::numeric_limits<double>::epsilon() * EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Cotangent Function failed: undefined near multiples of pi.");
-        }
+    return result;
+}
 
-        return std::cos(value) / sin_value;
-        });
+template <MathContainer T>
+void Math::Cot(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::cos(value) / std::sin(value); },
+        [](double value) { return std::abs(std::sin(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Cotangent Function failed: undefined near multiples of pi."); },
+        policy, report);
 }
 
 // ========================================
 // Inverse Trigonometric Methods
 // ========================================
 template <MathContainer T>
-T Math::Asin(const T& x)
+T Math::Asin(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value < -1.0 || value > 1.0)
-        {
-            throw std::domain_error("[Math] Arc-sine Function failed: arcsine is only defined for values in [-1, 1].");
-        }
+    T result;
+    Math::Asin(x, result, policy, report);
 
-        return std::asin(value);
-        });
+    return result;
 }
 
 template <MathContainer T>
-T Math::Acos(const T& x)
+void Math::Asin(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value < -1.0 || value > 1.0)
-        {
-            throw std::domain_error("[Math] Arc-cosine Function failed: arccosine is only defined for values in [-1, 1].");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::asin(value); },
+        [](double value) { return (value < -1.0) | (value > 1.0); },
+        [](double value) { throw std::domain_error("[Math] Arc-sine Function failed: arcsine is only defined for values in [-1, 1]."); },
+        policy, report);
+}
 
-        return std::acos(value);
-        });
+template <MathContainer T>
+T Math::Acos(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Acos(x, result, policy, report);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Acos(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::acos(value); },
+        [](double value) { return (value < -1.0) | (value > 1.0); },
+        [](double value) { throw std::domain_error("[Math] Arc-cosine Function failed: arccosine is only defined for values in [-1, 1]."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Atan(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Atan(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Atan(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::atan(value);
         });
 }
 
 template <MathContainer T>
-T Math::Acsc(const T& x)
+T Math::Acsc(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value > -1.0 && value < 1.0)
-        {
-            throw std::domain_error("[Math] Arc-cosecant Function failed: arccosecant is not defined for values in (-1, 1).");
-        }
+    T result;
+    Math::Acsc(x, result, policy, report);
 
-        return std::asin(1.0 / value);
-        });
+    return result;
 }
 
 template <MathContainer T>
-T Math::Asec(const T& x)
+void Math::Acsc(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value > -1.0 && value < 1.0)
-        {
-            throw std::domain_error("[Math] Arc-secant Function failed: arcsecant is not defined for values in (-1, 1).");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::asin(1.0 / value); },
+        [](double value) { return (value > -1.0) & (value < 1.0); },
+        [](double value) { throw std::domain_error("[Math] Arc-cosecant Function failed: arccosecant is not defined for values in (-1, 1)."); },
+        policy, report);
+}
 
-        return std::acos(1.0 / value);
-        });
+template <MathContainer T>
+T Math::Asec(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Asec(x, result, policy, report);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Asec(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::acos(1.0 / value); },
+        [](double value) { return (value > -1.0) & (value < 1.0); },
+        [](double value) { throw std::domain_error("[Math] Arc-secant Function failed: arcsecant is not defined for values in (-1, 1)."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Acot(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Acot(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Acot(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         if (std::abs(value) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE)
         {
             return std::numbers::pi / 2.0;
@@ -303,7 +530,16 @@ T Math::Acot(const T& x)
 template <MathContainer T>
 T Math::Sinh(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Sinh(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Sinh(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::sinh(value);
         });
 }
@@ -311,55 +547,90 @@ T Math::Sinh(const T& x)
 template <MathContainer T>
 T Math::Cosh(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Cosh(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Cosh(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::cosh(value);
         });
 }
 
 template <MathContainer T>
-T Math::Tanh(const T& x)
+T Math::Tanh(const T& x, FastMath::Precision precision)
 {
-    return x.Apply([](double value) {
-        return std::tanh(value);
+    T result;
+    Math::Tanh(x, result, precision);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Tanh(const T& x, T& out, FastMath::Precision precision)
+{
+    Math::Map(x, out, [=](double value) {
+        return FastMath::Tanh(value, precision);
         });
 }
 
 template <MathContainer T>
-T Math::Csch(const T& x)
+T Math::Csch(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double sinh_value = std::sinh(value);
+    T result;
+    Math::Csch(x, result, policy, report);
 
-        if (std::abs(sinh_value) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Hyperbolic Cosecant Function failed: hyperbolic cosecant is undefined at ~ zero.");
-        }
+    return result;
+}
 
-        return 1.0 / sinh_value;
-        });
+template <MathContainer T>
+void Math::Csch(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return 1.0 / std::sinh(value); },
+        [](double value) { return std::abs(std::sinh(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Hyperbolic Cosecant Function failed: hyperbolic cosecant is undefined at ~ zero."); },
+        policy, report);
 }
 
 template <MathContainer T>
 T Math::Sech(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Sech(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Sech(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return 1.0 / std::cosh(value);
         });
 }
 
 template <MathContainer T>
-T Math::Coth(const T& x)
+T Math::Coth(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        double sinh_value = std::sinh(value);
+    T result;
+    Math::Coth(x, result, policy, report);
 
-        if (std::abs(sinh_value) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Hyperbolic Cotangent Function failed: hyperbolic cotangent is undefined at ~ zero.");
-        }
+    return result;
+}
 
-        return std::cosh(value) / sinh_value;
-        });
+template <MathContainer T>
+void Math::Coth(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::cosh(value) / std::sinh(value); },
+        [](double value) { return std::abs(std::sinh(value)) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Hyperbolic Cotangent Function failed: hyperbolic cotangent is undefined at ~ zero."); },
+        policy, report);
 }
 
 // ========================================
@@ -368,72 +639,111 @@ T Math::Coth(const T& x)
 template <MathContainer T>
 T Math::Asinh(const T& x)
 {
-    return x.Apply([](double value) {
+    T result;
+    Math::Asinh(x, result);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Asinh(const T& x, T& out)
+{
+    Math::Map(x, out, [](double value) {
         return std::asinh(value);
         });
 }
 
 template <MathContainer T>
-T Math::Acosh(const T& x)
+T Math::Acosh(const T& x, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value < 1.0)
-        {
-            throw std::domain_error("[Math] Inverse Hyperbolic Cosine Function failed: inverse hyperbolic cosine is only defined for values >= 1.");
-        }
+    T result;
+    Math::Acosh(x, result, policy, report);
 
-        return std::acosh(value);
-        });
+    return result;
 }
 
 template <MathContainer T>
-T Math::Atanh(const T& x)
+void Math::Acosh(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value <= -1.0 || value >= 1.0)
-        {
-            throw std::domain_error("[Math] Inverse Hyperbolic Tangent Function failed: inverse hyperbolic tangent is only defined for values in (-1, 1).");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::acosh(value); },
+        [](double value) { return value < 1.0; },
+        [](double value) { throw std::domain_error("[Math] Inverse Hyperbolic Cosine Function failed: inverse hyperbolic cosine is only defined for values >= 1."); },
+        policy, report);
+}
 
-        return std::atanh(value);
-        });
+template <MathContainer T>
+T Math::Atanh(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Atanh(x, result, policy, report);
+
+    return result;
 }
 
 template <MathContainer T>
-T Math::Acsch(const T& x)
+void Math::Atanh(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (std::abs(value) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE)
-        {
-            throw std::domain_error("[Math] Inverse Hyperbolic Cosecant Function failed: inverse hyperbolic cosecant is undefined at zero.");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::atanh(value); },
+        [](double value) { return (value <= -1.0) | (value >= 1.0); },
+        [](double value) { throw std::domain_error("[Math] Inverse Hyperbolic Tangent Function failed: inverse hyperbolic tangent is only defined for values in (-1, 1)."); },
+        policy, report);
+}
 
-        return std::asinh(1.0 / value);
-        });
+template <MathContainer T>
+T Math::Acsch(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Acsch(x, result, policy, report);
+
+    return result;
 }
 
 template <MathContainer T>
-T Math::Asech(const T& x)
+void Math::Acsch(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value <= 0.0 || value > 1.0)
-        {
-            throw std::domain_error("[Math] Inverse Hyperbolic Secant Function failed: inverse hyperbolic secant is only defined for values in (0, 1].");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::asinh(1.0 / value); },
+        [](double value) { return std::abs(value) < std::numeric_limits<double>::epsilon() * Math::EPSILON_SCALE; },
+        [](double value) { throw std::domain_error("[Math] Inverse Hyperbolic Cosecant Function failed: inverse hyperbolic cosecant is undefined at zero."); },
+        policy, report);
+}
 
-        return std::acosh(1.0 / value);
-        });
+template <MathContainer T>
+T Math::Asech(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Asech(x, result, policy, report);
+
+    return result;
 }
 
 template <MathContainer T>
-T Math::Acoth(const T& x)
+void Math::Asech(const T& x, T& out, DomainPolicy policy, DomainReport* report)
 {
-    return x.Apply([](double value) {
-        if (value >= -1.0 && value <= 1.0)
-        {
-            throw std::domain_error("[Math] Inverse Hyperbolic Cotangent Function failed: inverse hyperbolic cotangent is not defined for values in [-1, 1].");
-        }
+    Math::Evaluate(x, out,
+        [=](double value) { return std::acosh(1.0 / value); },
+        [](double value) { return (value <= 0.0) | (value > 1.0); },
+        [](double value) { throw std::domain_error("[Math] Inverse Hyperbolic Secant Function failed: inverse hyperbolic secant is only defined for values in (0, 1]."); },
+        policy, report);
+}
 
-        return std::atanh(1.0 / value);
-        });
+template <MathContainer T>
+T Math::Acoth(const T& x, DomainPolicy policy, DomainReport* report)
+{
+    T result;
+    Math::Acoth(x, result, policy, report);
+
+    return result;
+}
+
+template <MathContainer T>
+void Math::Acoth(const T& x, T& out, DomainPolicy policy, DomainReport* report)
+{
+    Math::Evaluate(x, out,
+        [=](double value) { return std::atanh(1.0 / value); },
+        [](double value) { return (value >= -1.0) & (value <= 1.0); },
+        [](double value) { throw std::domain_error("[Math] Inverse Hyperbolic Cotangent Function failed: inverse hyperbolic cotangent is not defined for values in [-1, 1]."); },
+        policy, report);
 }
@@ -1,5 +1,8 @@
 #include "Matrix.h"
+#include "Gemm.h"
 #include "MatrixDecompResult.h"
+#include "BandedMatrix.h"
+#include "PivotedQR.h"
 
 // ========================================
 // [Private] Full Row/Column Check Method(s)
@@ -20,18 +23,56 @@ bool LinAlg::Matrix::IsFullRowRank() const
 	return this->Rank() == this->shape.first;
 }
 
+// ========================================
+// [Private] Storage Method(s)
+// ========================================
+LinAlg::Matrix::Matrix(const std::shared_ptr<std::vector<double>>& _buffer, const int& _offset, const std::pair<int, int>& _shape, const int& _row_stride)
+{
+	this->shape = _shape;
+	this->volume = (_shape.first * _shape.second);
+
+	this->data.buffer = _buffer;
+	this->data.offset = _offset;
+	this->data.row_stride = _row_stride;
+	this->data.is_view = true;
+}
+
+void LinAlg::Matrix::Allocate(const std::pair<int, int>& _shape, const double& _value)
+{
+	this->shape = _shape;
+	this->volume = (_shape.first * _shape.second);
+
+	this->data.buffer = std::make_shared<std::vector<double>>(this->volume, _value);
+	this->data.offset = 0;
+	this->data.row_stride = _shape.second;
+}
+
+bool LinAlg::Matrix::IsContiguous() const
+{
+	return this->data.row_stride == this->shape.second || this->shape.first <= 1;
+}
+
+bool LinAlg::Matrix::IsCacheable() const
+{
+	return !this->data.is_view && this->data.buffer.use_count() <= 1;
+}
+
 // ========================================
 // [Private] Noise Clearing Method(s)
 // ========================================
 void LinAlg::Matrix::ClearNoise()
 {
-	for (auto& row : this->data)
+	this->properties.InvalidateAll();
+
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (double& value : row)
+		double* row = this->data[i];
+
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			if (std::abs(value) < LinAlg::Matrix::TOLERANCE)
+			if (std::abs(row[j]) < LinAlg::Matrix::TOLERANCE)
 			{
-				value = 0.0;
+				row[j] = 0.0;
 			}
 		}
 	}
@@ -180,8 +221,105 @@ LinAlg::Matrix LinAlg::Matrix::PartialMatMul(const LinAlg::Matrix& _sub_matrix,
 	return result;
 }
 
+bool LinAlg::Matrix::TryCholesky(LinAlg::Matrix& _L) const
+{
+	int n = this->shape.first;
+	_L = LinAlg::Matrix({ n, n }, 0.0);
+
+	for (int j = 0; j < n; j++)
+	{
+		double diag = this->data[j][j];
+		for (int k = 0; k < j; k++)
+		{
+			diag -= (_L.data[j][k] * _L.data[j][k]);
+		}
+
+		if (diag <= LinAlg::Matrix::TOLERANCE)
+		{
+			return false;
+		}
+
+		double l_jj = std::sqrt(diag);
+		_L.data[j][j] = l_jj;
+
+		for (int i = j + 1; i < n; i++)
+		{
+			double sum = this->data[i][j];
+			for (int k = 0; k < j; k++)
+			{
+				sum -= (_L.data[i][k] * _L.data[j][k]);
+			}
+			_L.data[i][j] = sum / l_jj;
+		}
+	}
+
+	_L.properties.is_lower_triangular.Set(true);
+
+	return true;
+}
+
+LinAlg::Matrix LinAlg::Matrix::TriangularInverse() const
+{
+	int n = this->shape.first;
+	bool upper = this->IsUpperTriangular();
+
+	for (int i = 0; i < n; i++)
+	{
+		if (std::abs(this->data[i][i]) < LinAlg::Matrix::TOLERANCE)
+		{
+			throw std::runtime_error("[Matrix] Matrix Inversion failed: matrix is singular (not full rank).");
+		}
+	}
+
+	LinAlg::Matrix inverse({ n, n }, 0.0);
+
+	// Solve T * X = I one column at a time; column j of X has the same triangular support as T.
+	for (int j = 0; j < n; j++)
+	{
+		if (upper)
+		{
+			for (int i = j; i >= 0; i--)
+			{
+				double sum = (i == j) ? 1.0 : 0.0;
+				for (int k = i + 1; k <= j; k++)
+				{
+					sum -= (this->data[i][k] * inverse.data[k][j]);
+				}
+				inverse.data[i][j] = sum / this->data[i][i];
+			}
+		}
+		else
+		{
+			for (int i = j; i < n; i++)
+			{
+				double sum = (i == j) ? 1.0 : 0.0;
+				for (int k = j; k < i; k++)
+				{
+					sum -= (this->data[i][k] * inverse.data[k][j]);
+				}
+				inverse.data[i][j] = sum / this->data[i][i];
+			}
+		}
+	}
+
+	inverse.ClearNoise();
+
+	if (upper)
+	{
+		inverse.properties.is_upper_triangular.Set(true);
+	}
+	else
+	{
+		inverse.properties.is_lower_triangular.Set(true);
+	}
+
+	return inverse;
+}
+
 void LinAlg::Matrix::PermuteRows(const std::vector<int>& _permutation)
 {
+	this->properties.InvalidateAll();
+
 	if (this->IsEmpty())
 	{
 		throw std::runtime_error("[Matrix] Row Permutation failed: empty Matrix for permutation.");
@@ -208,13 +346,13 @@ void LinAlg::Matrix::PermuteRows(const std::vector<int>& _permutation)
 		points[_permutation[p]] = p;
 	}
 
-	std::vector<double> temp = this->data[0];
+	std::vector<double> temp(this->data[0], this->data[0] + this->shape.second);
 	int from = 0;
 
 	do
 	{
 		int to = points[from];
-		std::swap(temp, this->data[to]);
+		std::swap_ranges(temp.begin(), temp.end(), this->data[to]);
 
 		from = to;
 	} while (from != 0);
@@ -222,6 +360,8 @@ void LinAlg::Matrix::PermuteRows(const std::vector<int>& _permutation)
 
 void LinAlg::Matrix::PermuteColumns(const std::vector<int>& _permutation)
 {
+	this->properties.InvalidateAll();
+
 	if (this->IsEmpty())
 	{
 		throw std::runtime_error("[Matrix] Column Permutation failed: empty Matrix for permutation.");
@@ -277,10 +417,7 @@ LinAlg::Matrix::Matrix(const std::pair<int, int>& _shape, const double& _value)
 		throw std::invalid_argument("[Matrix] Constructor failed: invalid value.");
 	}
 
-	this->shape = { _shape.first, _shape.second };
-	this->volume = (this->shape.first * this->shape.second);
-
-	this->data.assign(this->shape.first, std::vector<double>(this->shape.second, _value));
+	this->Allocate(_shape, _value);
 }
 
 LinAlg::Matrix::Matrix(const std::pair<int, int>& _shape, const std::vector<double>& _data)
@@ -303,15 +440,54 @@ LinAlg::Matrix::Matrix(const std::pair<int, int>& _shape, const std::vector<doub
 		throw std::runtime_error("[Matrix] Constructor failed: volume mismatch between data-array and shape.");
 	}
 
-	this->data.assign(this->shape.first, std::vector<double>(this->shape.second, 0.0));
+	this->data.buffer = std::make_shared<std::vector<double>>(_data);
+	this->data.offset = 0;
+	this->data.row_stride = this->shape.second;
+}
 
-	for (int i = 0, k = 0; i < this->shape.first; i++)
+// Copies are always compact and own their buffer; only moves (and the
+// Tensor bridge) keep sharing storage.
+LinAlg::Matrix::Matrix(const LinAlg::Matrix& _matrix)
+{
+	this->shape = _matrix.shape;
+	this->volume = _matrix.volume;
+	this->sparse_data = _matrix.sparse_data;
+
+	if (_matrix.IsEmpty())
+	{
+		return;
+	}
+
+	if (_matrix.IsContiguous())
 	{
-		for (int j = 0; j < this->shape.second; j++, k++)
+		auto start_ptr = _matrix.data.buffer->begin() + _matrix.data.offset;
+		this->data.buffer = std::make_shared<std::vector<double>>(start_ptr, start_ptr + this->volume);
+	}
+	else
+	{
+		this->data.buffer = std::make_shared<std::vector<double>>();
+		this->data.buffer->reserve(this->volume);
+
+		for (int i = 0; i < this->shape.first; i++)
 		{
-			this->data[i][j] = _data[k];
+			this->data.buffer->insert(this->data.buffer->end(), _matrix.data[i], _matrix.data[i] + this->shape.second);
 		}
 	}
+
+	this->data.offset = 0;
+	this->data.row_stride = this->shape.second;
+}
+
+LinAlg::Matrix::Matrix(LinAlg::Matrix&& _matrix) noexcept
+{
+	this->shape = _matrix.shape;
+	this->volume = _matrix.volume;
+	this->sparse_data = std::move(_matrix.sparse_data);
+	this->data = std::move(_matrix.data);
+
+	_matrix.shape = { 0, 0 };
+	_matrix.volume = 0;
+	_matrix.data = LinAlg::Matrix::Storage();
 }
 
 // ========================================
@@ -457,14 +633,9 @@ bool LinAlg::Matrix::IsEmpty() const
 }
 
 // ========================================
-// Matrix Type-Check Method(s)
+// [Private] Structure Scan Method(s)
 // ========================================
-bool LinAlg::Matrix::IsSquare() const
-{
-	return !this->IsEmpty() && (this->shape.first == this->shape.second);
-}
-
-bool LinAlg::Matrix::IsDiagonal(const double& _tolerance) const
+bool LinAlg::Matrix::CheckDiagonal(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -484,7 +655,7 @@ bool LinAlg::Matrix::IsDiagonal(const double& _tolerance) const
 	return true;
 }
 
-bool LinAlg::Matrix::IsBidiagonal(const std::string& _type, const double& _tolerance) const
+bool LinAlg::Matrix::CheckBidiagonal(const std::string& _type, const double& _tolerance) const
 {
 	if (this->IsEmpty())
 	{
@@ -553,7 +724,7 @@ bool LinAlg::Matrix::IsBidiagonal(const std::string& _type, const double& _toler
 	return true;
 }
 
-bool LinAlg::Matrix::IsTridiagonal(const double& _tolerance) const
+bool LinAlg::Matrix::CheckTridiagonal(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -575,7 +746,7 @@ bool LinAlg::Matrix::IsTridiagonal(const double& _tolerance) const
 	return true;
 }
 
-bool LinAlg::Matrix::IsUpperTriangular(const double& _tolerance) const
+bool LinAlg::Matrix::CheckUpperTriangular(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -595,7 +766,7 @@ bool LinAlg::Matrix::IsUpperTriangular(const double& _tolerance) const
 	return true;
 }
 
-bool LinAlg::Matrix::IsLowerTriangular(const double& _tolerance) const
+bool LinAlg::Matrix::CheckLowerTriangular(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -615,7 +786,7 @@ bool LinAlg::Matrix::IsLowerTriangular(const double& _tolerance) const
 	return true;
 }
 
-bool LinAlg::Matrix::IsSymmetric(const double& _tolerance) const
+bool LinAlg::Matrix::CheckSymmetric(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -635,7 +806,7 @@ bool LinAlg::Matrix::IsSymmetric(const double& _tolerance) const
 	return true;
 }
 
-bool LinAlg::Matrix::IsSkewSymmetric(const double& _tolerance) const
+bool LinAlg::Matrix::CheckSkewSymmetric(const double& _tolerance) const
 {
 	if (this->IsEmpty() || !this->IsSquare())
 	{
@@ -655,6 +826,183 @@ bool LinAlg::Matrix::IsSkewSymmetric(const double& _tolerance) const
 	return true;
 }
 
+// ========================================
+// Matrix Type-Check Method(s)
+// ========================================
+bool LinAlg::Matrix::IsSquare() const
+{
+	return !this->IsEmpty() && (this->shape.first == this->shape.second);
+}
+
+bool LinAlg::Matrix::IsDiagonal(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckDiagonal(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_diagonal.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_diagonal = this->CheckDiagonal(_tolerance);
+	this->properties.MarkDiagonal(is_diagonal);
+
+	return is_diagonal;
+}
+
+bool LinAlg::Matrix::IsBidiagonal(const std::string& _type, const double& _tolerance) const
+{
+	std::string type = _type;
+
+	std::transform(type.begin(), type.end(), type.begin(),
+		[](unsigned char c) { return std::tolower(c); });
+
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || this->IsEmpty() || !this->IsCacheable())
+	{
+		return this->CheckBidiagonal(type, _tolerance);
+	}
+
+	LinAlg::MatrixProperties& cache = this->properties;
+
+	auto lookup = [&](LinAlg::CachedProperty<bool>& _property, const std::string& _type)
+		{
+			std::optional<bool> cached = _property.Get();
+			if (cached.has_value())
+			{
+				return cached.value();
+			}
+
+			bool result = this->CheckBidiagonal(_type, _tolerance);
+			_property.Set(result);
+
+			return result;
+		};
+
+	if (type == "upper")
+	{
+		return lookup(cache.is_upper_bidiagonal, "upper");
+	}
+
+	if (type == "lower")
+	{
+		return lookup(cache.is_lower_bidiagonal, "lower");
+	}
+
+	if (type != "any")
+	{
+		throw std::invalid_argument("[Matrix] Is Bidiagonal Check failed: got invalid type for bidiagonal Matrix check.");
+	}
+
+	std::optional<bool> cached = cache.is_bidiagonal.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_bidiagonal = lookup(cache.is_upper_bidiagonal, "upper") || lookup(cache.is_lower_bidiagonal, "lower");
+	cache.is_bidiagonal.Set(is_bidiagonal);
+
+	return is_bidiagonal;
+}
+
+bool LinAlg::Matrix::IsTridiagonal(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckTridiagonal(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_tridiagonal.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_tridiagonal = this->CheckTridiagonal(_tolerance);
+	this->properties.is_tridiagonal.Set(is_tridiagonal);
+
+	return is_tridiagonal;
+}
+
+bool LinAlg::Matrix::IsUpperTriangular(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckUpperTriangular(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_upper_triangular.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_upper_triangular = this->CheckUpperTriangular(_tolerance);
+	this->properties.is_upper_triangular.Set(is_upper_triangular);
+
+	return is_upper_triangular;
+}
+
+bool LinAlg::Matrix::IsLowerTriangular(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckLowerTriangular(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_lower_triangular.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_lower_triangular = this->CheckLowerTriangular(_tolerance);
+	this->properties.is_lower_triangular.Set(is_lower_triangular);
+
+	return is_lower_triangular;
+}
+
+bool LinAlg::Matrix::IsSymmetric(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckSymmetric(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_symmetric.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_symmetric = this->CheckSymmetric(_tolerance);
+	this->properties.is_symmetric.Set(is_symmetric);
+
+	return is_symmetric;
+}
+
+bool LinAlg::Matrix::IsSkewSymmetric(const double& _tolerance) const
+{
+	if (_tolerance != LinAlg::Matrix::TOLERANCE || !this->IsCacheable())
+	{
+		return this->CheckSkewSymmetric(_tolerance);
+	}
+
+	std::optional<bool> cached = this->properties.is_skew_symmetric.Get();
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	bool is_skew_symmetric = this->CheckSkewSymmetric(_tolerance);
+	this->properties.is_skew_symmetric.Set(is_skew_symmetric);
+
+	return is_skew_symmetric;
+}
+
 bool LinAlg::Matrix::IsOrthogonal() const
 {
 	if (this->IsEmpty() || !this->IsSquare())
@@ -662,14 +1010,23 @@ bool LinAlg::Matrix::IsOrthogonal() const
 		return false;
 	}
 
-	// Optimize this later:
-	LinAlg::Matrix result = this->MatMul(this->Transpose());
+	std::optional<bool> cached = this->IsCacheable() ? this->properties.is_orthogonal.Get() : std::nullopt;
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	LinAlg::Matrix result;
+	LinAlg::Matrix::MatMul(*this, *this, result, false, true);
+
+	bool is_orthogonal = (result == LinAlg::Matrix::Identity(this->shape.first));
 
-	if (result == LinAlg::Matrix::Identity(this->shape.first))
+	if (this->IsCacheable())
 	{
-		return true;
+		this->properties.is_orthogonal.Set(is_orthogonal);
 	}
-	return false;
+
+	return is_orthogonal;
 }
 
 bool LinAlg::Matrix::IsSingular(const double& _tolerance) const
@@ -688,13 +1045,22 @@ bool LinAlg::Matrix::IsIdempotent() const
 		return false;
 	}
 
+	std::optional<bool> cached = this->IsCacheable() ? this->properties.is_idempotent.Get() : std::nullopt;
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
 	LinAlg::Matrix result = this->MatMul(*this);
 
-	if (result == *this)
+	bool is_idempotent = (result == *this);
+
+	if (this->IsCacheable())
 	{
-		return true;
+		this->properties.is_idempotent.Set(is_idempotent);
 	}
-	return false;
+
+	return is_idempotent;
 }
 
 bool LinAlg::Matrix::IsNilpotent(const int& max_power, const double& _tolerance) const
@@ -714,9 +1080,38 @@ bool LinAlg::Matrix::IsInvolutory(const double& _tolerance) const
 // ========================================
 void LinAlg::Matrix::operator=(const LinAlg::Matrix& _matrix)
 {
+	this->properties.InvalidateAll();
+
+	if (this == &_matrix)
+	{
+		return;
+	}
+
+	LinAlg::Matrix copy(_matrix);
+
+	this->shape = copy.shape;
+	this->volume = copy.volume;
+	this->sparse_data = std::move(copy.sparse_data);
+	this->data = std::move(copy.data);
+}
+
+void LinAlg::Matrix::operator=(LinAlg::Matrix&& _matrix) noexcept
+{
+	this->properties.InvalidateAll();
+
+	if (this == &_matrix)
+	{
+		return;
+	}
+
 	this->shape = _matrix.shape;
 	this->volume = _matrix.volume;
-	this->data = _matrix.data;
+	this->sparse_data = std::move(_matrix.sparse_data);
+	this->data = std::move(_matrix.data);
+
+	_matrix.shape = { 0, 0 };
+	_matrix.volume = 0;
+	_matrix.data = LinAlg::Matrix::Storage();
 }
 
 // ========================================
@@ -1040,6 +1435,8 @@ LinAlg::Matrix LinAlg::Matrix::operator/(const LinAlg::Matrix& _matrix) const
 // ========================================
 void LinAlg::Matrix::operator+=(const double& _scalar)
 {
+	this->properties.InvalidateAll();
+
 	if (!Utils::IsValidData<double>({ _scalar }))
 	{
 		throw std::invalid_argument("[Matrix] Addition failed: invalid value.");
@@ -1058,6 +1455,8 @@ void LinAlg::Matrix::operator+=(const double& _scalar)
 
 void LinAlg::Matrix::operator-=(const double& _scalar)
 {
+	this->properties.InvalidateAll();
+
 	if (!Utils::IsValidData<double>({ _scalar }))
 	{
 		throw std::invalid_argument("[Matrix] Subtraction failed: invalid value.");
@@ -1076,6 +1475,8 @@ void LinAlg::Matrix::operator-=(const double& _scalar)
 
 void LinAlg::Matrix::operator*=(const double& _scalar)
 {
+	this->properties.InvalidateAll();
+
 	if (!Utils::IsValidData<double>({ _scalar }))
 	{
 		throw std::invalid_argument("[Matrix] Multiplication (Hadamard) failed: invalid value.");
@@ -1094,6 +1495,8 @@ void LinAlg::Matrix::operator*=(const double& _scalar)
 
 void LinAlg::Matrix::operator/=(const double& _scalar)
 {
+	this->properties.InvalidateAll();
+
 	if (!Utils::IsValidData<double>({ _scalar }))
 	{
 		throw std::invalid_argument("[Matrix] Division failed: invalid value.");
@@ -1117,6 +1520,8 @@ void LinAlg::Matrix::operator/=(const double& _scalar)
 
 void LinAlg::Matrix::operator+=(const std::vector<double>& _vector)
 {
+	this->properties.InvalidateAll();
+
 	if (_vector.size() != this->shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Addition failed: column-size mismatch with input vector size.");
@@ -1140,6 +1545,8 @@ void LinAlg::Matrix::operator+=(const std::vector<double>& _vector)
 
 void LinAlg::Matrix::operator-=(const std::vector<double>& _vector)
 {
+	this->properties.InvalidateAll();
+
 	if (_vector.size() != this->shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Subtraction failed: column-size mismatch with input vector size.");
@@ -1163,6 +1570,8 @@ void LinAlg::Matrix::operator-=(const std::vector<double>& _vector)
 
 void LinAlg::Matrix::operator*=(const std::vector<double>& _vector)
 {
+	this->properties.InvalidateAll();
+
 	if (_vector.size() != this->shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Multiplication failed: column-size mismatch with input vector size.");
@@ -1186,6 +1595,8 @@ void LinAlg::Matrix::operator*=(const std::vector<double>& _vector)
 
 void LinAlg::Matrix::operator/=(const std::vector<double>& _vector)
 {
+	this->properties.InvalidateAll();
+
 	if (_vector.size() != this->shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Division failed: column-size mismatch with input vector size.");
@@ -1217,6 +1628,8 @@ void LinAlg::Matrix::operator/=(const std::vector<double>& _vector)
 
 void LinAlg::Matrix::operator+=(const LinAlg::Matrix& _matrix)
 {
+	this->properties.InvalidateAll();
+
 	if (this->shape.first != _matrix.shape.first || this->shape.second != _matrix.shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Addition failed: shape mismatch with input Matrix.");
@@ -1235,6 +1648,8 @@ void LinAlg::Matrix::operator+=(const LinAlg::Matrix& _matrix)
 
 void LinAlg::Matrix::operator-=(const LinAlg::Matrix& _matrix)
 {
+	this->properties.InvalidateAll();
+
 	if (this->shape.first != _matrix.shape.first || this->shape.second != _matrix.shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Subtraction failed: shape mismatch with input Matrix.");
@@ -1253,6 +1668,8 @@ void LinAlg::Matrix::operator-=(const LinAlg::Matrix& _matrix)
 
 void LinAlg::Matrix::operator*=(const LinAlg::Matrix& _matrix)
 {
+	this->properties.InvalidateAll();
+
 	if (this->shape.first != _matrix.shape.first || this->shape.second != _matrix.shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Multiplication failed: shape mismatch with input Matrix.");
@@ -1271,6 +1688,8 @@ void LinAlg::Matrix::operator*=(const LinAlg::Matrix& _matrix)
 
 void LinAlg::Matrix::operator/=(const LinAlg::Matrix& _matrix)
 {
+	this->properties.InvalidateAll();
+
 	if (this->shape.first != _matrix.shape.first || this->shape.second != _matrix.shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Division failed: shape mismatch with input Matrix.");
@@ -1427,14 +1846,125 @@ LinAlg::Matrix LinAlg::Matrix::MatMul(const std::vector<std::vector<double>>& _m
 	return result;
 }
 
-LinAlg::Matrix LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix) const
-{
-	return this->MatMul(_matrix.data);
-}
+LinAlg::Matrix LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix) const
+{
+	LinAlg::Matrix result;
+	LinAlg::Matrix::MatMul(*this, _matrix, result);
+
+	return result;
+}
+
+LinAlg::Matrix LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix_1, const LinAlg::Matrix& _matrix_2)
+{
+	return _matrix_1.MatMul(_matrix_2);
+}
+
+void LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix_1, const LinAlg::Matrix& _matrix_2, LinAlg::Matrix& _result)
+{
+	if (_matrix_2.IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Matrix Multiplication failed: input matrix is invalid.");
+	}
+
+	if (_matrix_1.shape.second != _matrix_2.shape.first)
+	{
+		throw std::invalid_argument("[Matrix] Matrix Multiplication failed: row number of input matrix mismatch with total columns of Matrix.");
+	}
+
+	if (_result.data.buffer && (_result.data.buffer == _matrix_1.data.buffer || _result.data.buffer == _matrix_2.data.buffer))
+	{
+		throw std::invalid_argument("[Matrix] Matrix Multiplication failed: result cannot share storage with an operand.");
+	}
+
+	int rows = _matrix_1.shape.first;
+	int inner = _matrix_1.shape.second;
+	int columns = _matrix_2.shape.second;
+
+	if (_result.shape != std::make_pair(rows, columns))
+	{
+		_result.Allocate({ rows, columns }, 0.0);
+	}
+
+	// Diagonal x dense is a row scaling, dense x diagonal a column scaling: O(n^2) instead of O(n^3).
+	if (_matrix_1.IsDiagonal())
+	{
+		for (int row = 0; row < rows; row++)
+		{
+			double scale = _matrix_1.data[row][row];
+			const double* rhs_row = _matrix_2.data[row];
+			double* out_row = _result.data[row];
+
+			for (int col = 0; col < columns; col++)
+			{
+				out_row[col] = rhs_row[col] * scale;
+			}
+		}
+
+		_result.ClearNoise();
+		return;
+	}
+
+	if (_matrix_2.IsDiagonal())
+	{
+		for (int row = 0; row < rows; row++)
+		{
+			const double* lhs_row = _matrix_1.data[row];
+			double* out_row = _result.data[row];
+
+			for (int col = 0; col < columns; col++)
+			{
+				out_row[col] = lhs_row[col] * _matrix_2.data[col][col];
+			}
+		}
+
+		_result.ClearNoise();
+		return;
+	}
+
+	LinAlg::Gemm::Multiply({ _matrix_1.data[0], rows, inner, _matrix_1.data.row_stride, 1 }, false,
+		{ _matrix_2.data[0], inner, columns, _matrix_2.data.row_stride, 1 }, false,
+		{ _result.data[0], _result.data.row_stride, 1 });
+
+	_result.ClearNoise();
+}
+
+void LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix_1, const LinAlg::Matrix& _matrix_2, LinAlg::Matrix& _result, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha, const double& _beta)
+{
+	if (_matrix_1.IsEmpty() || _matrix_2.IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Matrix Multiplication failed: input matrix is invalid.");
+	}
+
+	int rows = _transpose_1 ? _matrix_1.shape.second : _matrix_1.shape.first;
+	int inner = _transpose_1 ? _matrix_1.shape.first : _matrix_1.shape.second;
+	int inner_2 = _transpose_2 ? _matrix_2.shape.second : _matrix_2.shape.first;
+	int columns = _transpose_2 ? _matrix_2.shape.first : _matrix_2.shape.second;
+
+	if (inner != inner_2)
+	{
+		throw std::invalid_argument("[Matrix] Matrix Multiplication failed: inner dimensions of op(A) and op(B) must match.");
+	}
+
+	if (_result.data.buffer && (_result.data.buffer == _matrix_1.data.buffer || _result.data.buffer == _matrix_2.data.buffer))
+	{
+		throw std::invalid_argument("[Matrix] Matrix Multiplication failed: result cannot share storage with an operand.");
+	}
+
+	if (_result.shape != std::make_pair(rows, columns))
+	{
+		if (_beta != 0.0)
+		{
+			throw std::invalid_argument("[Matrix] Matrix Multiplication failed: result must match the product's shape when beta != 0.");
+		}
+
+		_result.Allocate({ rows, columns }, 0.0);
+	}
 
-LinAlg::Matrix LinAlg::Matrix::MatMul(const LinAlg::Matrix& _matrix_1, const LinAlg::Matrix& _matrix_2)
-{
-	return _matrix_1.MatMul(_matrix_2);
+	LinAlg::Gemm::Multiply({ _matrix_1.data[0], _matrix_1.shape.first, _matrix_1.shape.second, _matrix_1.data.row_stride, 1 }, _transpose_1,
+		{ _matrix_2.data[0], _matrix_2.shape.first, _matrix_2.shape.second, _matrix_2.data.row_stride, 1 }, _transpose_2,
+		{ _result.data[0], _result.data.row_stride, 1 }, _alpha, _beta);
+
+	_result.ClearNoise();
 }
 
 // ========================================
@@ -1475,6 +2005,24 @@ LinAlg::Matrix LinAlg::Matrix::Inverse() const
 		throw std::runtime_error("[Matrix] Matrix Inversion failed: matrix must be square.");
 	}
 
+	if (this->IsUpperTriangular() || this->IsLowerTriangular())
+	{
+		return this->TriangularInverse();
+	}
+
+	LinAlg::Matrix L;
+	if (this->IsSymmetric() && this->TryCholesky(L))
+	{
+		// A^-1 = L^-T * L^-1 for symmetric positive-definite A.
+		LinAlg::Matrix L_inv = L.TriangularInverse();
+		LinAlg::Matrix inverse;
+		LinAlg::Matrix::MatMul(L_inv, L_inv, inverse, true, false);
+
+		inverse.properties.is_symmetric.Set(true);
+
+		return inverse;
+	}
+
 	LinAlg::EliminationResult rref = this->GaussJordanElimination(Matrix::Identity(this->shape.first));
 
 	if (rref.rank < this->shape.first)
@@ -1508,6 +2056,135 @@ LinAlg::Matrix LinAlg::Matrix::PseudoInverse() const
 	return LinAlg::Matrix();
 }
 
+// ========================================
+// Matrix Linear Solve Method(s)
+// ========================================
+LinAlg::Matrix LinAlg::Matrix::Solve(const LinAlg::Matrix& _rhs) const
+{
+	if (this->IsEmpty() || _rhs.IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Linear Solve failed: empty Matrix.");
+	}
+
+	if (!this->IsSquare())
+	{
+		throw std::invalid_argument("[Matrix] Linear Solve failed: coefficient Matrix must be square.");
+	}
+
+	if (this->shape.first != _rhs.shape.first)
+	{
+		throw std::invalid_argument("[Matrix] Linear Solve failed: mismatch between no. of rows in coefficient and right-hand side Matrix.");
+	}
+
+	int n = this->shape.first;
+	int n_rhs = _rhs.shape.second;
+
+	// Triangular: O(n^2) substitution per right-hand side.
+	if (this->IsUpperTriangular() || this->IsLowerTriangular())
+	{
+		bool upper = this->IsUpperTriangular();
+
+		for (int i = 0; i < n; i++)
+		{
+			if (std::abs(this->data[i][i]) < LinAlg::Matrix::TOLERANCE)
+			{
+				throw std::runtime_error("[Matrix] Linear Solve failed: matrix is singular (not full rank).");
+			}
+		}
+
+		LinAlg::Matrix result = _rhs;
+
+		for (int c = 0; c < n_rhs; c++)
+		{
+			for (int step = 0; step < n; step++)
+			{
+				int i = upper ? (n - 1 - step) : step;
+
+				double sum = result.data[i][c];
+				if (upper)
+				{
+					for (int k = i + 1; k < n; k++)
+					{
+						sum -= this->data[i][k] * result.data[k][c];
+					}
+				}
+				else
+				{
+					for (int k = 0; k < i; k++)
+					{
+						sum -= this->data[i][k] * result.data[k][c];
+					}
+				}
+
+				result.data[i][c] = sum / this->data[i][i];
+			}
+		}
+
+		result.properties.InvalidateAll();
+		return result;
+	}
+
+	// Tridiagonal: O(n) banded LU with partial pivoting.
+	if (this->IsTridiagonal())
+	{
+		try
+		{
+			return LinAlg::BandedMatrix(*this, 1, 1).Solve(_rhs);
+		}
+		catch (const std::runtime_error&)
+		{
+			throw std::runtime_error("[Matrix] Linear Solve failed: matrix is singular (not full rank).");
+		}
+	}
+
+	LinAlg::EliminationResult rref = this->GaussJordanElimination(_rhs);
+
+	if (rref.rank < n)
+	{
+		throw std::runtime_error("[Matrix] Linear Solve failed: matrix is singular (not full rank).");
+	}
+
+	return rref.B;
+}
+
+LinAlg::Matrix LinAlg::Matrix::LeastSquares(const LinAlg::Matrix& _rhs) const
+{
+	if (this->IsEmpty() || _rhs.IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Least-Squares failed: empty Matrix.");
+	}
+
+	if (this->shape.first != _rhs.shape.first)
+	{
+		throw std::invalid_argument("[Matrix] Least-Squares failed: mismatch between no. of rows in coefficient and right-hand side Matrix.");
+	}
+
+	return LinAlg::PivotedQR(*this).LeastSquares(_rhs);
+}
+
+// ========================================
+// Matrix Subspace Method(s)
+// ========================================
+LinAlg::Matrix LinAlg::Matrix::Range() const
+{
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Range failed: empty Matrix.");
+	}
+
+	return LinAlg::PivotedQR(*this).Range();
+}
+
+LinAlg::Matrix LinAlg::Matrix::NullSpace() const
+{
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Null-Space failed: empty Matrix.");
+	}
+
+	return LinAlg::PivotedQR(*this).NullSpace();
+}
+
 // ========================================
 // Matrix Row-Elimination Method(s)
 // ========================================
@@ -1681,18 +2358,56 @@ double LinAlg::Matrix::Determinant() const
 		throw std::runtime_error("[Matrix] Determinant Computation failed: determinant is not defined for non-square matrix.");
 	}
 
-	LinAlg::EliminationResult row_echelon_form = this->GaussianElimination();
+	std::optional<double> cached = this->IsCacheable() ? this->properties.determinant.Get() : std::nullopt;
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	double det = 1.0;
+	LinAlg::Matrix L;
 
-	if (row_echelon_form.rank < this->shape.first)
+	if (this->IsUpperTriangular() || this->IsLowerTriangular())
+	{
+		for (int i = 0; i < this->shape.first; i++)
+		{
+			if (std::abs(this->data[i][i]) < LinAlg::Matrix::TOLERANCE)
+			{
+				det = 0.0;
+				break;
+			}
+			det *= this->data[i][i];
+		}
+	}
+	else if (this->IsSymmetric() && this->TryCholesky(L))
 	{
-		return 0.0;
+		for (int i = 0; i < this->shape.first; i++)
+		{
+			det *= (L.data[i][i] * L.data[i][i]);
+		}
 	}
+	else
+	{
+		LinAlg::EliminationResult row_echelon_form = this->GaussianElimination();
+
+		if (row_echelon_form.rank < this->shape.first)
+		{
+			det = 0.0;
+		}
+		else
+		{
+			det = (row_echelon_form.swapCount % 2) ? -1.0 : 1.0;
 
-	double det = (row_echelon_form.swapCount % 2) ? -1.0 : 1.0;
+			for (int i = 0; i < row_echelon_form.A.shape.first; i++)
+			{
+				det *= row_echelon_form.A.data[i][i];
+			}
+		}
+	}
 
-	for (int i = 0; i < row_echelon_form.A.shape.first; i++)
+	if (this->IsCacheable())
 	{
-		det *= row_echelon_form.A.data[i][i];
+		this->properties.determinant.Set(det);
 	}
 
 	return det;
@@ -1705,19 +2420,57 @@ double LinAlg::Matrix::Trace() const
 		throw std::runtime_error("[Matrix] Trace Computation failed: trace is not defined for non-square matrix.");
 	}
 
+	std::optional<double> cached = this->IsCacheable() ? this->properties.trace.Get() : std::nullopt;
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
 	double trace = 0.0;
 	for (int i = 0; i < this->shape.first; i++)
 	{
 		trace += this->data[i][i];
 	}
 
+	if (this->IsCacheable())
+	{
+		this->properties.trace.Set(trace);
+	}
+
 	return trace;
 }
 
 int LinAlg::Matrix::Rank() const
 {
-	LinAlg::EliminationResult row_echelon_form = this->GaussianElimination();
-	return row_echelon_form.rank;
+	std::optional<int> cached = this->IsCacheable() ? this->properties.rank.Get() : std::nullopt;
+	if (cached.has_value())
+	{
+		return cached.value();
+	}
+
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Rank Computation failed: empty Matrix.");
+	}
+
+	int rank = LinAlg::PivotedQR(*this).Rank();
+
+	if (this->IsCacheable())
+	{
+		this->properties.rank.Set(rank);
+	}
+
+	return rank;
+}
+
+int LinAlg::Matrix::Rank(const double& _tolerance) const
+{
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Rank Computation failed: empty Matrix.");
+	}
+
+	return LinAlg::PivotedQR(*this).Rank(_tolerance);
 }
 
 std::vector<double> LinAlg::Matrix::Diag(const bool& _sign) const
@@ -1895,11 +2648,13 @@ double LinAlg::Matrix::Sum() const
 	}
 
 	double sum = 0.0;
-	for (const auto& row : this->data)
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (const double& value : row)
+		const double* row = this->data[i];
+
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			sum += value;
+			sum += row[j];
 		}
 	}
 
@@ -1927,11 +2682,13 @@ double LinAlg::Matrix::Var(const bool& _inference) const
 	double mean = this->Mean();
 	double var = 0.0;
 
-	for (const auto& row : this->data)
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (const double& value : row)
+		const double* row = this->data[i];
+
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			double diff = value - mean;
+			double diff = row[j] - mean;
 			var += (diff * diff);
 		}
 	}
@@ -1948,11 +2705,13 @@ double LinAlg::Matrix::Max() const
 	}
 
 	double max_value = this->data[0][0];
-	for (const auto& row : this->data)
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (const double& value : row)
+		const double* row = this->data[i];
+
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			max_value = std::max(max_value, value);
+			max_value = std::max(max_value, row[j]);
 		}
 	}
 
@@ -1967,11 +2726,13 @@ double LinAlg::Matrix::Min() const
 	}
 
 	double min_value = this->data[0][0];
-	for (const auto& row : this->data)
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (const double& value : row)
+		const double* row = this->data[i];
+
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			min_value = std::min(min_value, value);
+			min_value = std::min(min_value, row[j]);
 		}
 	}
 
@@ -2019,6 +2780,8 @@ LinAlg::Matrix LinAlg::Matrix::Reshape(const std::pair<int, int> _shape) const
 // ========================================
 void LinAlg::Matrix::SwapRows(const int& _row_1, const int& _row_2)
 {
+	this->properties.InvalidateAll();
+
 	if (_row_1 < 0 || _row_1 >= this->shape.first)
 	{
 		throw std::out_of_range("[Matrix] Swap Rows failed: first row-number is out of bounds.");
@@ -2037,6 +2800,8 @@ void LinAlg::Matrix::SwapRows(const int& _row_1, const int& _row_2)
 
 void LinAlg::Matrix::SwapColumns(const int& _col_1, const int& _col_2)
 {
+	this->properties.InvalidateAll();
+
 	if (_col_1 < 0 || _col_1 >= this->shape.second)
 	{
 		throw std::out_of_range("[Matrix] Swap Columns failed: first column-number is out of bounds.");
@@ -2058,6 +2823,8 @@ void LinAlg::Matrix::SwapColumns(const int& _col_1, const int& _col_2)
 // ========================================
 void LinAlg::Matrix::Patch(const LinAlg::Matrix& _matrix, const std::pair<int, int>& _start, const std::pair<int, int>& _end)
 {
+	this->properties.InvalidateAll();
+
 	if (_start.first < 0 || _start.second < 0)
 	{
 		throw std::invalid_argument("[Matrix] Patching failed: co-ordinate(s) contains negative value.");
@@ -2137,7 +2904,7 @@ std::vector<double> LinAlg::Matrix::GetRow(const int& _row_index) const
 		throw std::out_of_range("[Matrix] Get Row failed: row index is out of bounds.");
 	}
 
-	return this->data[_row_index];
+	return std::vector<double>(this->data[_row_index], this->data[_row_index] + this->shape.second);
 }
 
 std::vector<double> LinAlg::Matrix::GetColumn(const int& _column_index) const
@@ -2232,7 +2999,7 @@ std::vector<double> LinAlg::Matrix::GetFlatData() const
 
 	for (int i = 0; i < this->shape.first; i++)
 	{
-		flat_data.insert(flat_data.end(), this->data[i].begin(), this->data[i].end());
+		flat_data.insert(flat_data.end(), this->data[i], this->data[i] + this->shape.second);
 	}
 
 	return flat_data;
@@ -2243,6 +3010,8 @@ std::vector<double> LinAlg::Matrix::GetFlatData() const
 // ========================================
 void LinAlg::Matrix::PushRow(const std::vector<double>& _row_data)
 {
+	this->properties.InvalidateAll();
+
 	if (!this->IsEmpty() && _row_data.size() != this->shape.second)
 	{
 		throw std::invalid_argument("[Matrix] Row Appending failed: row array-size mismatch with Matrix column-size.");
@@ -2253,41 +3022,47 @@ void LinAlg::Matrix::PushRow(const std::vector<double>& _row_data)
 		throw std::invalid_argument("[Matrix] Row Appending failed: invalid value found in row-data.");
 	}
 
-	this->shape.first++;
-	this->volume += _row_data.size();
-	this->data.push_back(_row_data);
+	std::vector<double> flat_data = this->GetFlatData();
+	flat_data.insert(flat_data.end(), _row_data.begin(), _row_data.end());
+
+	int columns = static_cast<int>(_row_data.size());
+	int rows = this->shape.first + 1;
+
+	this->Allocate({ rows, columns }, 0.0);
+	*this->data.buffer = std::move(flat_data);
 }
 
 void LinAlg::Matrix::PushColumn(const std::vector<double>& _column_data)
 {
-	if (!this->IsEmpty() && _column_data.size() != this->shape.second)
+	this->properties.InvalidateAll();
+
+	if (!this->IsEmpty() && _column_data.size() != this->shape.first)
 	{
-		throw std::invalid_argument("[Matrix] Row Appending failed: row array-size mismatch with Matrix column-size.");
+		throw std::invalid_argument("[Matrix] Column Appending failed: column array-size mismatch with Matrix row-size.");
 	}
 
 	if (!Utils::IsValidData(_column_data))
 	{
-		throw std::invalid_argument("[Matrix] Row Appending failed: invalid value found in row-data.");
+		throw std::invalid_argument("[Matrix] Column Appending failed: invalid value found in column-data.");
 	}
 
-	this->shape.second++;
-	this->volume += _column_data.size();
+	int rows = static_cast<int>(_column_data.size());
+	int columns = this->shape.second + 1;
 
-	if (this->data.empty())
-	{
-		this->data.resize(_column_data.size());
-		for (const double& value : _column_data)
-		{
-			this->data.push_back({ value });
-		}
-	}
-	else
+	std::vector<double> flat_data;
+	flat_data.reserve(static_cast<size_t>(rows) * columns);
+
+	for (int row = 0; row < rows; row++)
 	{
-		for (int row = 0; row < _column_data.size(); row++)
+		if (columns > 1)
 		{
-			this->data[row].push_back(_column_data[row]);
+			flat_data.insert(flat_data.end(), this->data[row], this->data[row] + this->shape.second);
 		}
+		flat_data.push_back(_column_data[row]);
 	}
+
+	this->Allocate({ rows, columns }, 0.0);
+	*this->data.buffer = std::move(flat_data);
 }
 
 // ========================================
@@ -2295,6 +3070,8 @@ void LinAlg::Matrix::PushColumn(const std::vector<double>& _column_data)
 // ========================================
 void LinAlg::Matrix::PopRow(const int& _index)
 {
+	this->properties.InvalidateAll();
+
 	if (this->IsEmpty())
 	{
 		throw std::runtime_error("[Matrix] Pop Row failed: empty Matrix.");
@@ -2307,23 +3084,36 @@ void LinAlg::Matrix::PopRow(const int& _index)
 		throw std::out_of_range("[Matrix] Pop Row failed: index: " + std::to_string(index) + " out of bounds: [0, rows).");
 	}
 
-	this->data.erase(this->data.begin() + index);
+	int rows = this->shape.first - 1;
+	int columns = this->shape.second;
 
-	if (this->data.empty() || this->data[0].empty())
+	if (rows == 0)
 	{
-		this->data.clear();
+		this->data = LinAlg::Matrix::Storage();
 		this->shape = { 0, 0 };
 		this->volume = 0;
+		return;
 	}
-	else
+
+	std::vector<double> flat_data;
+	flat_data.reserve(static_cast<size_t>(rows) * columns);
+
+	for (int row = 0; row < this->shape.first; row++)
 	{
-		this->shape = { this->data.size(), this->data[0].size() };
-		this->volume = this->shape.first * this->shape.second;
+		if (row != index)
+		{
+			flat_data.insert(flat_data.end(), this->data[row], this->data[row] + columns);
+		}
 	}
+
+	this->Allocate({ rows, columns }, 0.0);
+	*this->data.buffer = std::move(flat_data);
 }
 
 void LinAlg::Matrix::PopColumn(const int& _index)
 {
+	this->properties.InvalidateAll();
+
 	if (this->IsEmpty())
 	{
 		throw std::runtime_error("[Matrix] Pop Row failed: empty Matrix.");
@@ -2336,22 +3126,30 @@ void LinAlg::Matrix::PopColumn(const int& _index)
 		throw std::out_of_range("[Matrix] Pop Column failed: index: " + std::to_string(index) + " out of bounds: [0, columns).");
 	}
 
-	for (int i = 0; i < this->shape.first; i++)
-	{
-		this->data[i].erase(this->data[i].begin() + index);
-	}
+	int rows = this->shape.first;
+	int columns = this->shape.second - 1;
 
-	if (this->data.size() == 0 || this->data[0].size() == 0)
+	if (columns == 0)
 	{
-		this->data.clear();
+		this->data = LinAlg::Matrix::Storage();
 		this->shape = { 0, 0 };
 		this->volume = 0;
+		return;
 	}
-	else
+
+	std::vector<double> flat_data;
+	flat_data.reserve(static_cast<size_t>(rows) * columns);
+
+	for (int row = 0; row < rows; row++)
 	{
-		this->shape = { this->data.size(), this->data[0].size() };
-		this->volume = this->shape.first * this->shape.second;
+		const double* source = this->data[row];
+
+		flat_data.insert(flat_data.end(), source, source + index);
+		flat_data.insert(flat_data.end(), source + index + 1, source + this->shape.second);
 	}
+
+	this->Allocate({ rows, columns }, 0.0);
+	*this->data.buffer = std::move(flat_data);
 }
 
 void LinAlg::Matrix::PopRows(const std::vector<int>& _indices)
@@ -2723,8 +3521,8 @@ LinAlg::QRResult LinAlg::Matrix::HQRDecomposition(const bool& _full) const
 		}
 
 		LinAlg::Matrix v_col({ vsize, 1 }, x);
-		LinAlg::Matrix v_row = v_col.Transpose();
-		LinAlg::Matrix vvt = v_col.MatMul(v_row);
+		LinAlg::Matrix vvt;
+		LinAlg::Matrix::MatMul(v_col, v_col, vvt, false, true);
 		LinAlg::Matrix h_sub = LinAlg::Matrix::Identity(vsize) - (vvt * 2);
 
 		LinAlg::Matrix Qi = LinAlg::Matrix::Identity(rows);
@@ -2776,17 +3574,139 @@ LinAlg::SVDResult LinAlg::Matrix::SVDecomposition() const
 
 LinAlg::CholeskyResult LinAlg::Matrix::CholeskyDecomposition() const
 {
-	return LinAlg::CholeskyResult();
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Cholesky Decomposition failed: empty Matrix.");
+	}
+
+	if (!this->IsSymmetric())
+	{
+		throw std::runtime_error("[Matrix] Cholesky Decomposition failed: requires a symmetric Matrix.");
+	}
+
+	LinAlg::Matrix L;
+	if (!this->TryCholesky(L))
+	{
+		throw std::runtime_error("[Matrix] Cholesky Decomposition failed: Matrix is not positive-definite.");
+	}
+
+	return LinAlg::CholeskyResult(L);
 }
 
 LinAlg::EigenResult LinAlg::Matrix::EigenDecomposition() const
 {
+	if (this->IsSymmetric())
+	{
+		return this->SpectralDecomposition();
+	}
+
+	// General (non-symmetric) eigen solver: implement later.
 	return LinAlg::EigenResult();
 }
 
 LinAlg::EigenResult LinAlg::Matrix::SpectralDecomposition() const
 {
-	return LinAlg::EigenResult();
+	if (this->IsEmpty())
+	{
+		throw std::runtime_error("[Matrix] Spectral Decomposition failed: empty Matrix.");
+	}
+
+	if (!this->IsSymmetric())
+	{
+		throw std::runtime_error("[Matrix] Spectral Decomposition failed: requires a symmetric Matrix.");
+	}
+
+	int n = this->shape.first;
+
+	LinAlg::Matrix A = *this;
+	LinAlg::Matrix V = LinAlg::Matrix::Identity(n);
+
+	// Cyclic Jacobi rotations: each sweep annihilates every off-diagonal pair once.
+	// A diagonal matrix needs none, but still goes through the ordering below.
+	const int max_sweeps = this->IsDiagonal() ? 0 : 100;
+
+	for (int sweep = 0; sweep < max_sweeps; sweep++)
+	{
+		double off_diagonal = 0.0;
+
+		for (int p = 0; p < n; p++)
+		{
+			for (int q = p + 1; q < n; q++)
+			{
+				off_diagonal += (A.data[p][q] * A.data[p][q]);
+			}
+		}
+
+		if (std::sqrt(off_diagonal) < LinAlg::Matrix::TOLERANCE)
+		{
+			break;
+		}
+
+		for (int p = 0; p < n; p++)
+		{
+			for (int q = p + 1; q < n; q++)
+			{
+				if (std::abs(A.data[p][q]) < std::numeric_limits<double>::min())
+				{
+					continue;
+				}
+
+				double theta = (A.data[q][q] - A.data[p][p]) / (2.0 * A.data[p][q]);
+				double t = ((theta >= 0.0) ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt((theta * theta) + 1.0));
+				double c = 1.0 / std::sqrt((t * t) + 1.0);
+				double s = t * c;
+
+				for (int k = 0; k < n; k++)
+				{
+					double a_kp = A.data[k][p];
+					double a_kq = A.data[k][q];
+					A.data[k][p] = (c * a_kp) - (s * a_kq);
+					A.data[k][q] = (s * a_kp) + (c * a_kq);
+				}
+
+				for (int k = 0; k < n; k++)
+				{
+					double a_pk = A.data[p][k];
+					double a_qk = A.data[q][k];
+					A.data[p][k] = (c * a_pk) - (s * a_qk);
+					A.data[q][k] = (s * a_pk) + (c * a_qk);
+				}
+
+				for (int k = 0; k < n; k++)
+				{
+					double v_kp = V.data[k][p];
+					double v_kq = V.data[k][q];
+					V.data[k][p] = (c * v_kp) - (s * v_kq);
+					V.data[k][q] = (s * v_kp) + (c * v_kq);
+				}
+			}
+		}
+	}
+
+	std::vector<int> order(n);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(),
+		[&A](const int& a, const int& b)
+		{
+			return A.data[a][a] > A.data[b][b];
+		});
+
+	std::vector<double> eigenvalues(n);
+	LinAlg::Matrix eigenvectors({ n, n }, 0.0);
+
+	for (int i = 0; i < n; i++)
+	{
+		eigenvalues[i] = A.data[order[i]][order[i]];
+
+		for (int row = 0; row < n; row++)
+		{
+			eigenvectors.data[row][i] = V.data[row][order[i]];
+		}
+	}
+
+	eigenvectors.ClearNoise();
+
+	return LinAlg::EigenResult(eigenvalues, eigenvectors);
 }
 
 LinAlg::GKBResult LinAlg::Matrix::GKBidiagonalize() const
@@ -2835,8 +3755,8 @@ LinAlg::GKBResult LinAlg::Matrix::GKBidiagonalize() const
 			}
 
 			LinAlg::Matrix v_col({ vsize, 1 }, x);
-			LinAlg::Matrix v_row = v_col.Transpose();
-			LinAlg::Matrix vvt = v_col.MatMul(v_row);
+			LinAlg::Matrix vvt;
+			LinAlg::Matrix::MatMul(v_col, v_col, vvt, false, true);
 			LinAlg::Matrix h_sub = LinAlg::Matrix::Identity(vsize) - (vvt * 2);
 
 			LinAlg::Matrix Ui = LinAlg::Matrix::Identity(rows);
@@ -2883,8 +3803,8 @@ LinAlg::GKBResult LinAlg::Matrix::GKBidiagonalize() const
 			}
 
 			LinAlg::Matrix v_col({ vsize, 1 }, x);
-			LinAlg::Matrix v_row = v_col.Transpose();
-			LinAlg::Matrix vvt = v_col.MatMul(v_row);
+			LinAlg::Matrix vvt;
+			LinAlg::Matrix::MatMul(v_col, v_col, vvt, false, true);
 			LinAlg::Matrix h_sub = LinAlg::Matrix::Identity(vsize) - (vvt * 2);
 
 			LinAlg::Matrix Vi = LinAlg::Matrix::Identity(columns);
@@ -3072,11 +3992,11 @@ LinAlg::SVDResult LinAlg::Matrix::GRDiagonalize() const
 // ========================================
 void LinAlg::Matrix::Print() const
 {
-	for (const auto& row : this->data)
+	for (int i = 0; i < this->shape.first; i++)
 	{
-		for (const double& value : row)
+		for (int j = 0; j < this->shape.second; j++)
 		{
-			std::cout << value << "\t";
+			std::cout << this->data[i][j] << "\t";
 		}
 		std::cout << std::endl;
 	}
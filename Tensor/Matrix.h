@@ -1,5 +1,6 @@
 #pragma once
 
+#include "MatrixProperties.h"
 #include "Utils.h"
 
 #include <algorithm>
@@ -7,6 +8,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <numbers>
 #include <numeric>
 #include <optional>
@@ -17,6 +19,7 @@
 #include <vector>
 
 class Math;
+class Tensor;
 
 namespace LinAlg
 {
@@ -32,9 +35,31 @@ namespace LinAlg
     class Matrix
     {
         friend class Math;
+        friend class ::Tensor;
+        friend class PivotedQR;
 
     private:
-        std::vector<std::vector<double>> data;
+        // Row-major buffer that may be shared with a Tensor. Row i starts at
+        // offset + i * row_stride, so data[i][j] addresses element (i, j)
+        // whether the Matrix owns its buffer or views a Tensor's.
+        struct Storage
+        {
+            std::shared_ptr<std::vector<double>> buffer;
+
+            int offset = 0;
+
+            int row_stride = 0;
+
+            // Set by the view constructor: the buffer belongs to a Tensor that
+            // can be written without going through this Matrix.
+            bool is_view = false;
+
+            double* operator[](const int& _row) { return this->buffer->data() + this->offset + _row * this->row_stride; }
+
+            const double* operator[](const int& _row) const { return this->buffer->data() + this->offset + _row * this->row_stride; }
+        };
+
+        Storage data;
 
         std::vector<std::pair<double, int>> sparse_data;
 
@@ -42,6 +67,8 @@ namespace LinAlg
 
         int volume = 0;
 
+        mutable LinAlg::MatrixProperties properties;
+
         // ========== Constants ==========
         static constexpr double TOLERANCE = 1e-9;
 
@@ -50,6 +77,32 @@ namespace LinAlg
 
         bool IsFullRowRank() const;
 
+        bool CheckDiagonal(const double& _tolerance) const;
+
+        bool CheckBidiagonal(const std::string& _type, const double& _tolerance) const;
+
+        bool CheckTridiagonal(const double& _tolerance) const;
+
+        bool CheckUpperTriangular(const double& _tolerance) const;
+
+        bool CheckLowerTriangular(const double& _tolerance) const;
+
+        bool CheckSymmetric(const double& _tolerance) const;
+
+        bool CheckSkewSymmetric(const double& _tolerance) const;
+
+        Matrix(const std::shared_ptr<std::vector<double>>& _buffer, const int& _offset, const std::pair<int, int>& _shape, const int& _row_stride);
+
+        void Allocate(const std::pair<int, int>& _shape, const double& _value);
+
+        bool IsContiguous() const;
+
+        // False for views (Tensor::MatrixView) and while the buffer is shared
+        // (Tensor::View): writes through the other owner bypass this Matrix's
+        // mutators, so cached properties could go stale and are neither read
+        // nor stored.
+        bool IsCacheable() const;
+
         void ClearNoise();
 
         LinAlg::Matrix Apply(const std::function<double(double)>& _func) const;
@@ -58,6 +111,10 @@ namespace LinAlg
 
         double WilkinsonShift() const;
 
+        bool TryCholesky(Matrix& _L) const;
+
+        Matrix TriangularInverse() const;
+
         Matrix PartialMatMul(const Matrix& _sub_matrix, const std::pair<int, int>& _start, const std::pair<int, int>& _end, const bool& _left_multiply = false) const;
 
         void PermuteRows(const std::vector<int>& _permutation);
@@ -71,6 +128,10 @@ namespace LinAlg
 
         Matrix(const std::pair<int, int>& _shape, const std::vector<double>& _data);
 
+        Matrix(const Matrix& _matrix);
+
+        Matrix(Matrix&& _matrix) noexcept;
+
         static Matrix Identity(const int& _n, const double& _scale = 1.0);
 
         static Matrix RandomUniform(const int& _rows, const int& _cols, const double& _min_value = -1.0, const double& _max_value = 1.0, std::optional<unsigned int> seed = std::nullopt);
@@ -117,6 +178,8 @@ namespace LinAlg
 
         void operator=(const Matrix& _matrix);
 
+        void operator=(Matrix&& _matrix) noexcept;
+
         bool operator==(const Matrix& _matrix) const;
 
         bool operator!=(const Matrix& _matrix) const;
@@ -183,12 +246,24 @@ namespace LinAlg
 
         static Matrix MatMul(const Matrix& _matrix_1, const Matrix& _matrix_2);
 
+        // Writes the product into _result, reusing its buffer (or the Tensor
+        // slot it views) when the shape already matches.
+        static void MatMul(const Matrix& _matrix_1, const Matrix& _matrix_2, Matrix& _result);
+
+        // _result = _alpha * op(_matrix_1) * op(_matrix_2) + _beta * _result,
+        // where op transposes when its flag is set. Transposed operands are
+        // read in place, not copied. With _beta != 0, _result must already
+        // have the product's shape.
+        static void MatMul(const Matrix& _matrix_1, const Matrix& _matrix_2, Matrix& _result, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha = 1.0, const double& _beta = 0.0);
+
         Matrix Transpose() const;
 
         Matrix Inverse() const;
 
         Matrix PseudoInverse() const;  // Moore-Penrose: Modify later after SVD
 
+        Matrix Solve(const Matrix& _rhs) const;
+
         LinAlg::EliminationResult GaussianElimination(const Matrix& _aug_matrix = Matrix()) const;
 
         LinAlg::EliminationResult GaussJordanElimination(const Matrix& _aug_matrix = Matrix()) const;
@@ -199,6 +274,14 @@ namespace LinAlg
 
         int Rank() const;
 
+        int Rank(const double& _tolerance) const;
+
+        Matrix LeastSquares(const Matrix& _rhs) const;
+
+        Matrix Range() const;
+
+        Matrix NullSpace() const;
+
         std::vector<double> Diag(const bool& _sign = false) const;
 
         Matrix ReduceSum(const bool& _row_wise = true) const;
@@ -1,5 +1,63 @@
 #include "MatrixProperties.h"
 
+// ========================================
+// MatrixProperties Constructor(s)
+// ========================================
+LinAlg::MatrixProperties::MatrixProperties(const LinAlg::MatrixProperties&)
+{
+	this->InvalidateAll();
+}
+
+LinAlg::MatrixProperties& LinAlg::MatrixProperties::operator=(const LinAlg::MatrixProperties&)
+{
+	this->InvalidateAll();
+	return *this;
+}
+
+// ========================================
+// [Private] Cache Maintenance Method(s)
+// ========================================
 void LinAlg::MatrixProperties::InvalidateAll()
 {
+	this->is_square.Reset();
+	this->is_diagonal.Reset();
+	this->is_bidiagonal.Reset();
+	this->is_upper_bidiagonal.Reset();
+	this->is_lower_bidiagonal.Reset();
+	this->is_tridiagonal.Reset();
+	this->is_upper_triangular.Reset();
+	this->is_lower_triangular.Reset();
+	this->is_symmetric.Reset();
+	this->is_skew_symmetric.Reset();
+	this->is_orthogonal.Reset();
+	this->is_singular.Reset();
+	this->is_idempotent.Reset();
+	this->is_nilpotent.Reset();
+	this->is_involutory.Reset();
+
+	this->determinant.Reset();
+	this->rank.Reset();
+	this->trace.Reset();
+}
+
+void LinAlg::MatrixProperties::MarkDiagonal(const bool& _value)
+{
+	this->is_diagonal.Set(_value);
+
+	if (!_value)
+	{
+		return;
+	}
+
+	// A diagonal matrix is every banded/triangular/symmetric shape at once.
+	this->is_bidiagonal.Set(true);
+	this->is_upper_bidiagonal.Set(true);
+	this->is_lower_bidiagonal.Set(true);
+
+	this->is_tridiagonal.Set(true);
+
+	this->is_upper_triangular.Set(true);
+	this->is_lower_triangular.Set(true);
+
+	this->is_symmetric.Set(true);
 }
@@ -1,62 +1,91 @@
 #pragma once
 
+#include <atomic>
 #include <optional>
 #include <vector>
 
 namespace LinAlg
 {
+    class Matrix;
+
+    // One lazily computed property. Const queries on a Matrix shared between
+    // threads may fill it concurrently; they all compute the same value, so
+    // each store publishes the value through a release store of the synced
+    // flag and readers take it only after an acquire load of that flag.
+    template <typename T>
+    class CachedProperty
+    {
+    private:
+        std::atomic<T> value{};
+
+        std::atomic<bool> synced{ false };
+
+    public:
+        std::optional<T> Get() const;
+
+        void Set(const T& _value);
+
+        void Reset();
+    };
+
+    // Lazily computed structural facts about a Matrix, valid for the default
+    // Matrix::TOLERANCE only. The owning Matrix invalidates the cache on every
+    // mutation and bypasses it for views and while its buffer is shared;
+    // copies start unsynced because internal algorithms write into copied
+    // storage directly. Filling the cache from const queries is thread-safe,
+    // so a Matrix may be queried from several threads at once.
     class MatrixProperties
     {
+        friend class Matrix;
+
     private:
-        bool is_square = false;
-        bool is_square_synced = false;
+        CachedProperty<bool> is_square;
+
+        CachedProperty<bool> is_diagonal;
 
-        bool is_diagonal = false;
-        bool is_diagonal_synced = false;
+        CachedProperty<bool> is_bidiagonal;
 
-        bool is_bidiagonal = false;
-        bool is_bidiagonal_synced = false;
+        CachedProperty<bool> is_upper_bidiagonal;
 
-        bool is_upper_bidiagonal = false;
-        bool is_upper_bidiagonal_synced = false;
+        CachedProperty<bool> is_lower_bidiagonal;
 
-        bool is_lower_bidiagonal = false;
-        bool is_lower_bidiagonal_synced = false;
+        CachedProperty<bool> is_tridiagonal;
 
-        bool is_tridiagonal = false;
-        bool is_tridiagonal_synced = false;
+        CachedProperty<bool> is_upper_triangular;
 
-        bool is_upper_triangular = false;
-        bool upper_triangular_synced = false;
+        CachedProperty<bool> is_lower_triangular;
 
-        bool is_lower_triangular = false;
-        bool lower_triangular_synced = false;
+        CachedProperty<bool> is_symmetric;
 
-        bool is_symmetric = false;
-        bool is_symmetric_synced = false;
+        CachedProperty<bool> is_skew_symmetric;
 
-        bool is_skew_symmetric = false;
-        bool is_skew_symmetric_synced = false;
+        CachedProperty<bool> is_orthogonal;
 
-        bool is_orthogonal = false;
-        bool is_orthogonal_synced = false;
+        CachedProperty<bool> is_singular;
 
-        bool is_singular = false;
-        bool singular_synced = false;
+        CachedProperty<bool> is_idempotent;
 
-        bool is_idempotent = false;
-        bool is_idempotent_synced = false;
+        CachedProperty<bool> is_nilpotent;
 
-        bool is_nilpotent = false;
-        bool is_nilpotent_synced = false;
+        CachedProperty<bool> is_involutory;
 
-        bool is_involutory = false;
-        bool is_involutory_synced = false;
+        CachedProperty<double> determinant;
 
-        std::optional<double> determinant;
-        std::optional<int> rank;
-        std::optional<double> trace;
+        CachedProperty<int> rank;
+
+        CachedProperty<double> trace;
 
         void InvalidateAll();
+
+        void MarkDiagonal(const bool& _value);
+
+    public:
+        MatrixProperties() {}
+
+        MatrixProperties(const MatrixProperties&);
+
+        MatrixProperties& operator=(const MatrixProperties&);
     };
 }
+
+#include "MatrixProperties.inl"
@@ -0,0 +1,28 @@
+#include "MatrixProperties.h"
+
+// ========================================
+// CachedProperty Method(s)
+// ========================================
+template <typename T>
+std::optional<T> LinAlg::CachedProperty<T>::Get() const
+{
+    if (!this->synced.load(std::memory_order_acquire))
+    {
+        return std::nullopt;
+    }
+
+    return this->value.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void LinAlg::CachedProperty<T>::Set(const T& _value)
+{
+    this->value.store(_value, std::memory_order_relaxed);
+    this->synced.store(true, std::memory_order_release);
+}
+
+template <typename T>
+void LinAlg::CachedProperty<T>::Reset()
+{
+    this->synced.store(false, std::memory_order_release);
+}
@@ -1,19 +1,32 @@
 #include "Mish.h"
 #include "Softplus.h"
 #include "Swish.h"
+#include "FastMath.h"
 
 
 double Activation::Mish::f(double x) const
 {
 	double softplus = Activation::Softplus().f(x);
-	return (x * std::tanh(softplus));
+	return (x * FastMath::Tanh(softplus));
 }
 
 double Activation::Mish::df(double x) const
 {
 	double softplus = Activation::Softplus().f(x);
 	double swish = Activation::Swish().f(x);
-	double t = std::tanh(softplus);
+	double t = FastMath::Tanh(softplus);
 
 	return t + swish * (1 - (t * t));
 }
+
+void Activation::Mish::fdf(double x, double& value, double& derivative) const
+{
+	double softplus = Activation::Softplus().f(x);
+	double swish = Activation::Swish().f(x);
+	double t = FastMath::Tanh(softplus);
+
+	value = x * t;
+	derivative = t + swish * (1 - (t * t));
+}
+
+template class Activation::ScalarActivationImpl<Activation::Mish>;
@@ -0,0 +1,574 @@
+#include "Normalization.h"
+
+// ========================================
+// [Private] Layout & Validation Method(s)
+// ========================================
+Normalization::Layout Normalization::ResolveAxis(const Tensor& _tensor, const int& _axis, const std::string& _operation)
+{
+	if (_tensor.IsEmpty() || _tensor.Rank() == 0)
+	{
+		throw std::runtime_error("[Normalization] " + _operation + " failed: invalid operation on scalar or empty Tensor.");
+	}
+
+	int rank = _tensor.Rank();
+	int actual_axis = (_axis < 0) ? (rank + _axis) : _axis;
+
+	if (actual_axis < 0 || actual_axis >= rank)
+	{
+		throw std::out_of_range("[Normalization] " + _operation + " failed: axis out of bounds.");
+	}
+
+	std::vector<int> shape = _tensor.Shape();
+	Layout layout;
+
+	for (int i = 0; i < actual_axis; i++)
+	{
+		layout.outer *= shape[i];
+	}
+
+	layout.size = shape[actual_axis];
+
+	for (int i = actual_axis + 1; i < rank; i++)
+	{
+		layout.inner *= shape[i];
+	}
+
+	return layout;
+}
+
+void Normalization::CheckParameter(const Tensor& _parameter, const Layout& _layout, const std::string& _operation, const std::string& _name)
+{
+	if (_parameter.Volume() != _layout.size)
+	{
+		throw std::invalid_argument("[Normalization] " + _operation + " failed: " + _name + " must hold one value per index of the normalized axis ("
+			+ std::to_string(_layout.size) + "), got " + std::to_string(_parameter.Volume()) + ".");
+	}
+}
+
+void Normalization::CheckGradient(const Tensor& _grad, const Tensor& _input, const std::string& _operation)
+{
+	if (_grad.Shape() != _input.Shape())
+	{
+		throw std::invalid_argument("[Normalization] " + _operation + " failed: gradient shape must match the input shape.");
+	}
+}
+
+void Normalization::PrepareStatistics(Statistics& _statistics, const int& _groups)
+{
+	if (_statistics.mean.Rank() != 1 || _statistics.mean.Volume() != _groups)
+	{
+		_statistics.mean.Resize(std::vector<int>{ _groups });
+	}
+
+	if (_statistics.inv_std.Rank() != 1 || _statistics.inv_std.Volume() != _groups)
+	{
+		_statistics.inv_std.Resize(std::vector<int>{ _groups });
+	}
+}
+
+void Normalization::PrepareParameterGradient(Tensor& _gradient, const Tensor& _parameter)
+{
+	_gradient.Resize(_parameter);
+	std::fill(_gradient.begin(), _gradient.end(), 0.0);
+}
+
+// ========================================
+// [Private] Group Kernel Method(s)
+// ========================================
+// LayerNorm (_center) and RMSNorm over groups of size elements strided by
+// inner. All inner positions of an outer block are processed together, so
+// the loops run over contiguous memory whatever the axis; the statistics
+// buffers double as the Welford accumulators (mean, M2 or sum of squares).
+// Every element is read before it is written, so _output may be _input.
+void Normalization::GroupForward(const Tensor& _input, const Tensor& _gamma, const Tensor* _beta, Tensor& _output, Statistics& _statistics, const Layout& _layout, const double& _epsilon, const bool& _center)
+{
+	_output.Resize(_input);
+	Normalization::PrepareStatistics(_statistics, _layout.outer * _layout.inner);
+
+	const double* input = &*_input.begin();
+	const double* gamma = &*_gamma.begin();
+	const double* beta = (_beta != nullptr) ? &*_beta->begin() : nullptr;
+
+	double* output = &*_output.begin();
+	double* mean = &*_statistics.mean.begin();
+	double* inv_std = &*_statistics.inv_std.begin();
+
+	const int size = _layout.size;
+	const int inner = _layout.inner;
+	const int block = size * inner;
+
+	Utils::ParallelFor(0, _layout.outer, [&](int begin, int end)
+		{
+			for (int o = begin; o < end; o++)
+			{
+				const double* x = input + (static_cast<size_t>(o) * block);
+				double* y = output + (static_cast<size_t>(o) * block);
+				double* m = mean + (static_cast<size_t>(o) * inner);
+				double* s = inv_std + (static_cast<size_t>(o) * inner);
+
+				std::fill(m, m + inner, 0.0);
+				std::fill(s, s + inner, 0.0);
+
+				for (int k = 0; k < size; k++)
+				{
+					const double* x_k = x + (k * inner);
+
+					if (_center)
+					{
+						double weight = 1.0 / (k + 1);
+						for (int j = 0; j < inner; j++)
+						{
+							double delta = x_k[j] - m[j];
+							m[j] += delta * weight;
+							s[j] += delta * (x_k[j] - m[j]);
+						}
+					}
+					else
+					{
+						for (int j = 0; j < inner; j++)
+						{
+							s[j] += x_k[j] * x_k[j];
+						}
+					}
+				}
+
+				for (int j = 0; j < inner; j++)
+				{
+					s[j] = 1.0 / std::sqrt((s[j] / size) + _epsilon);
+				}
+
+				for (int k = 0; k < size; k++)
+				{
+					const double* x_k = x + (k * inner);
+					double* y_k = y + (k * inner);
+
+					double g = gamma[k];
+					double b = (beta != nullptr) ? beta[k] : 0.0;
+
+					for (int j = 0; j < inner; j++)
+					{
+						y_k[j] = ((x_k[j] - m[j]) * s[j] * g) + b;
+					}
+				}
+			}
+		}, std::max(1, Normalization::GRAIN / block));
+}
+
+// dx = inv_std * (dx_hat - mean(dx_hat) - x_hat * mean(dx_hat * x_hat)) with
+// dx_hat = grad * gamma (the mean(dx_hat) term vanishes for RMSNorm). The
+// first sweep gathers both row sums and the gamma / beta gradients, the
+// second writes dx; each worker accumulates the parameter gradients of its
+// rows privately and merges them once.
+void Normalization::GroupBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const Layout& _layout, const bool& _center)
+{
+	const int groups = _layout.outer * _layout.inner;
+
+	if (_statistics.mean.Volume() != groups || _statistics.inv_std.Volume() != groups)
+	{
+		throw std::invalid_argument("[Normalization] Backward pass failed: statistics do not match the input.");
+	}
+
+	_gradients.input.Resize(_input);
+	Normalization::PrepareParameterGradient(_gradients.gamma, _gamma);
+
+	if (_center)
+	{
+		Normalization::PrepareParameterGradient(_gradients.beta, _gamma);
+	}
+	else
+	{
+		_gradients.beta.Clear();
+	}
+
+	const double* grad = &*_grad.begin();
+	const double* input = &*_input.begin();
+	const double* gamma = &*_gamma.begin();
+	const double* mean = &*_statistics.mean.begin();
+	const double* inv_std = &*_statistics.inv_std.begin();
+
+	double* grad_input = &*_gradients.input.begin();
+	double* grad_gamma = &*_gradients.gamma.begin();
+	double* grad_beta = _center ? &*_gradients.beta.begin() : nullptr;
+
+	const int size = _layout.size;
+	const int inner = _layout.inner;
+	const int block = size * inner;
+
+	std::mutex merge_mutex;
+
+	Utils::ParallelFor(0, _layout.outer, [&](int begin, int end)
+		{
+			std::vector<double> scratch((2 * static_cast<size_t>(size)) + (2 * static_cast<size_t>(inner)), 0.0);
+
+			double* local_gamma = scratch.data();
+			double* local_beta = local_gamma + size;
+			double* sum_dx_hat = local_beta + size;
+			double* sum_dx_hat_x_hat = sum_dx_hat + inner;
+
+			for (int o = begin; o < end; o++)
+			{
+				const double* g = grad + (static_cast<size_t>(o) * block);
+				const double* x = input + (static_cast<size_t>(o) * block);
+				const double* m = mean + (static_cast<size_t>(o) * inner);
+				const double* s = inv_std + (static_cast<size_t>(o) * inner);
+				double* dx = grad_input + (static_cast<size_t>(o) * block);
+
+				std::fill(sum_dx_hat, sum_dx_hat + (2 * inner), 0.0);
+
+				for (int k = 0; k < size; k++)
+				{
+					const double* g_k = g + (k * inner);
+					const double* x_k = x + (k * inner);
+
+					double gamma_k = gamma[k];
+					double gamma_sum = 0.0;
+					double beta_sum = 0.0;
+
+					for (int j = 0; j < inner; j++)
+					{
+						double x_hat = (x_k[j] - m[j]) * s[j];
+						double dx_hat = g_k[j] * gamma_k;
+
+						sum_dx_hat[j] += dx_hat;
+						sum_dx_hat_x_hat[j] += dx_hat * x_hat;
+
+						gamma_sum += g_k[j] * x_hat;
+						beta_sum += g_k[j];
+					}
+
+					local_gamma[k] += gamma_sum;
+					local_beta[k] += beta_sum;
+				}
+
+				for (int j = 0; j < inner; j++)
+				{
+					sum_dx_hat[j] = _center ? (sum_dx_hat[j] / size) : 0.0;
+					sum_dx_hat_x_hat[j] /= size;
+				}
+
+				for (int k = 0; k < size; k++)
+				{
+					const double* g_k = g + (k * inner);
+					const double* x_k = x + (k * inner);
+					double* dx_k = dx + (k * inner);
+
+					double gamma_k = gamma[k];
+
+					for (int j = 0; j < inner; j++)
+					{
+						double x_hat = (x_k[j] - m[j]) * s[j];
+						dx_k[j] = s[j] * ((g_k[j] * gamma_k) - sum_dx_hat[j] - (x_hat * sum_dx_hat_x_hat[j]));
+					}
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(merge_mutex);
+
+			for (int k = 0; k < size; k++)
+			{
+				grad_gamma[k] += local_gamma[k];
+
+				if (grad_beta != nullptr)
+				{
+					grad_beta[k] += local_beta[k];
+				}
+			}
+		}, std::max(1, Normalization::GRAIN / block));
+}
+
+// ========================================
+// [Private] Channel Kernel Method(s)
+// ========================================
+// y = (x - mean) * scale + shift over every element of one channel.
+void Normalization::NormalizeChannel(const double* _input, double* _output, const Layout& _layout, const int& _channel, const double& _mean, const double& _scale, const double& _shift)
+{
+	for (int o = 0; o < _layout.outer; o++)
+	{
+		size_t offset = ((static_cast<size_t>(o) * _layout.size) + _channel) * _layout.inner;
+
+		const double* x = _input + offset;
+		double* y = _output + offset;
+
+		for (int j = 0; j < _layout.inner; j++)
+		{
+			y[j] = ((x[j] - _mean) * _scale) + _shift;
+		}
+	}
+}
+
+// ========================================
+// Layer Normalization Method(s)
+// ========================================
+Tensor Normalization::LayerNorm(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const int& _axis, const double& _epsilon)
+{
+	Tensor output;
+	Statistics statistics;
+
+	Normalization::LayerNorm(_input, _gamma, _beta, output, statistics, _axis, _epsilon);
+
+	return output;
+}
+
+void Normalization::LayerNorm(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, Tensor& _output, Statistics& _statistics, const int& _axis, const double& _epsilon)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "Layer Normalization");
+
+	Normalization::CheckParameter(_gamma, layout, "Layer Normalization", "gamma");
+	Normalization::CheckParameter(_beta, layout, "Layer Normalization", "beta");
+
+	Normalization::GroupForward(_input, _gamma, &_beta, _output, _statistics, layout, _epsilon, true);
+}
+
+Normalization::Gradients Normalization::LayerNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis)
+{
+	Gradients gradients;
+	Normalization::LayerNormBackward(_grad, _input, _gamma, _statistics, gradients, _axis);
+
+	return gradients;
+}
+
+void Normalization::LayerNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "Layer Normalization Backward");
+
+	Normalization::CheckParameter(_gamma, layout, "Layer Normalization Backward", "gamma");
+	Normalization::CheckGradient(_grad, _input, "Layer Normalization Backward");
+
+	Normalization::GroupBackward(_grad, _input, _gamma, _statistics, _gradients, layout, true);
+}
+
+// ========================================
+// RMS Normalization Method(s)
+// ========================================
+Tensor Normalization::RMSNorm(const Tensor& _input, const Tensor& _gamma, const int& _axis, const double& _epsilon)
+{
+	Tensor output;
+	Statistics statistics;
+
+	Normalization::RMSNorm(_input, _gamma, output, statistics, _axis, _epsilon);
+
+	return output;
+}
+
+void Normalization::RMSNorm(const Tensor& _input, const Tensor& _gamma, Tensor& _output, Statistics& _statistics, const int& _axis, const double& _epsilon)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "RMS Normalization");
+
+	Normalization::CheckParameter(_gamma, layout, "RMS Normalization", "gamma");
+
+	Normalization::GroupForward(_input, _gamma, nullptr, _output, _statistics, layout, _epsilon, false);
+}
+
+Normalization::Gradients Normalization::RMSNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis)
+{
+	Gradients gradients;
+	Normalization::RMSNormBackward(_grad, _input, _gamma, _statistics, gradients, _axis);
+
+	return gradients;
+}
+
+void Normalization::RMSNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "RMS Normalization Backward");
+
+	Normalization::CheckParameter(_gamma, layout, "RMS Normalization Backward", "gamma");
+	Normalization::CheckGradient(_grad, _input, "RMS Normalization Backward");
+
+	Normalization::GroupBackward(_grad, _input, _gamma, _statistics, _gradients, layout, false);
+}
+
+// ========================================
+// Batch Normalization Method(s)
+// ========================================
+Tensor Normalization::BatchNormInference(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const Tensor& _running_mean, const Tensor& _running_var, const int& _axis, const double& _epsilon)
+{
+	Tensor output;
+	Normalization::BatchNormInference(_input, _gamma, _beta, _running_mean, _running_var, output, _axis, _epsilon);
+
+	return output;
+}
+
+void Normalization::BatchNormInference(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const Tensor& _running_mean, const Tensor& _running_var, Tensor& _output, const int& _axis, const double& _epsilon)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "Batch Normalization");
+
+	Normalization::CheckParameter(_gamma, layout, "Batch Normalization", "gamma");
+	Normalization::CheckParameter(_beta, layout, "Batch Normalization", "beta");
+	Normalization::CheckParameter(_running_mean, layout, "Batch Normalization", "running_mean");
+	Normalization::CheckParameter(_running_var, layout, "Batch Normalization", "running_var");
+
+	_output.Resize(_input);
+
+	const double* input = &*_input.begin();
+	const double* gamma = &*_gamma.begin();
+	const double* beta = &*_beta.begin();
+	const double* running_mean = &*_running_mean.begin();
+	const double* running_var = &*_running_var.begin();
+
+	double* output = &*_output.begin();
+
+	int channel_volume = layout.outer * layout.inner;
+
+	Utils::ParallelFor(0, layout.size, [&](int begin, int end)
+		{
+			for (int k = begin; k < end; k++)
+			{
+				double scale = gamma[k] / std::sqrt(running_var[k] + _epsilon);
+
+				Normalization::NormalizeChannel(input, output, layout, k, running_mean[k], scale, beta[k]);
+			}
+		}, std::max(1, Normalization::GRAIN / channel_volume));
+}
+
+// Per channel: one Welford sweep for the batch mean / variance, the running
+// statistics update, then one normalize-and-affine sweep.
+void Normalization::BatchNormTraining(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, Tensor& _running_mean, Tensor& _running_var, Tensor& _output, Statistics& _statistics, const double& _momentum, const int& _axis, const double& _epsilon)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "Batch Normalization");
+
+	Normalization::CheckParameter(_gamma, layout, "Batch Normalization", "gamma");
+	Normalization::CheckParameter(_beta, layout, "Batch Normalization", "beta");
+	Normalization::CheckParameter(_running_mean, layout, "Batch Normalization", "running_mean");
+	Normalization::CheckParameter(_running_var, layout, "Batch Normalization", "running_var");
+
+	if (!(_momentum >= 0.0 && _momentum <= 1.0))
+	{
+		throw std::invalid_argument("[Normalization] Batch Normalization failed: momentum must be in [0, 1].");
+	}
+
+	_output.Resize(_input);
+	Normalization::PrepareStatistics(_statistics, layout.size);
+
+	const double* input = &*_input.begin();
+	const double* gamma = &*_gamma.begin();
+	const double* beta = &*_beta.begin();
+
+	double* output = &*_output.begin();
+	double* running_mean = &*_running_mean.begin();
+	double* running_var = &*_running_var.begin();
+	double* mean = &*_statistics.mean.begin();
+	double* inv_std = &*_statistics.inv_std.begin();
+
+	int channel_volume = layout.outer * layout.inner;
+
+	Utils::ParallelFor(0, layout.size, [&](int begin, int end)
+		{
+			for (int k = begin; k < end; k++)
+			{
+				double m = 0.0;
+				double m2 = 0.0;
+				int count = 0;
+
+				for (int o = 0; o < layout.outer; o++)
+				{
+					const double* x = input + (((static_cast<size_t>(o) * layout.size) + k) * layout.inner);
+
+					for (int j = 0; j < layout.inner; j++)
+					{
+						count++;
+
+						double delta = x[j] - m;
+						m += delta / count;
+						m2 += delta * (x[j] - m);
+					}
+				}
+
+				double variance = m2 / channel_volume;
+				double unbiased_variance = (channel_volume > 1) ? (m2 / (channel_volume - 1)) : variance;
+
+				mean[k] = m;
+				inv_std[k] = 1.0 / std::sqrt(variance + _epsilon);
+
+				running_mean[k] = ((1.0 - _momentum) * running_mean[k]) + (_momentum * m);
+				running_var[k] = ((1.0 - _momentum) * running_var[k]) + (_momentum * unbiased_variance);
+
+				Normalization::NormalizeChannel(input, output, layout, k, m, gamma[k] * inv_std[k], beta[k]);
+			}
+		}, std::max(1, Normalization::GRAIN / channel_volume));
+}
+
+Normalization::Gradients Normalization::BatchNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis)
+{
+	Gradients gradients;
+	Normalization::BatchNormBackward(_grad, _input, _gamma, _statistics, gradients, _axis);
+
+	return gradients;
+}
+
+// dx = gamma * inv_std / N * (N * grad - sum(grad) - x_hat * sum(grad * x_hat))
+// over the N elements of a channel; the two sums are also the beta / gamma
+// gradients. Channels are independent, so no merging is needed.
+void Normalization::BatchNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis)
+{
+	Layout layout = Normalization::ResolveAxis(_input, _axis, "Batch Normalization Backward");
+
+	Normalization::CheckParameter(_gamma, layout, "Batch Normalization Backward", "gamma");
+	Normalization::CheckGradient(_grad, _input, "Batch Normalization Backward");
+
+	if (_statistics.mean.Volume() != layout.size || _statistics.inv_std.Volume() != layout.size)
+	{
+		throw std::invalid_argument("[Normalization] Batch Normalization Backward failed: statistics do not match the input.");
+	}
+
+	_gradients.input.Resize(_input);
+	Normalization::PrepareParameterGradient(_gradients.gamma, _gamma);
+	Normalization::PrepareParameterGradient(_gradients.beta, _gamma);
+
+	const double* grad = &*_grad.begin();
+	const double* input = &*_input.begin();
+	const double* gamma = &*_gamma.begin();
+	const double* mean = &*_statistics.mean.begin();
+	const double* inv_std = &*_statistics.inv_std.begin();
+
+	double* grad_input = &*_gradients.input.begin();
+	double* grad_gamma = &*_gradients.gamma.begin();
+	double* grad_beta = &*_gradients.beta.begin();
+
+	int channel_volume = layout.outer * layout.inner;
+
+	Utils::ParallelFor(0, layout.size, [&](int begin, int end)
+		{
+			for (int k = begin; k < end; k++)
+			{
+				double m = mean[k];
+				double s = inv_std[k];
+
+				double sum_grad = 0.0;
+				double sum_grad_x_hat = 0.0;
+
+				for (int o = 0; o < layout.outer; o++)
+				{
+					size_t offset = ((static_cast<size_t>(o) * layout.size) + k) * layout.inner;
+
+					const double* g = grad + offset;
+					const double* x = input + offset;
+
+					for (int j = 0; j < layout.inner; j++)
+					{
+						sum_grad += g[j];
+						sum_grad_x_hat += g[j] * ((x[j] - m) * s);
+					}
+				}
+
+				grad_gamma[k] = sum_grad_x_hat;
+				grad_beta[k] = sum_grad;
+
+				double scale = gamma[k] * s / channel_volume;
+
+				for (int o = 0; o < layout.outer; o++)
+				{
+					size_t offset = ((static_cast<size_t>(o) * layout.size) + k) * layout.inner;
+
+					const double* g = grad + offset;
+					const double* x = input + offset;
+					double* dx = grad_input + offset;
+
+					for (int j = 0; j < layout.inner; j++)
+					{
+						double x_hat = (x[j] - m) * s;
+						dx[j] = scale * ((channel_volume * g[j]) - sum_grad - (x_hat * sum_grad_x_hat));
+					}
+				}
+			}
+		}, std::max(1, Normalization::GRAIN / channel_volume));
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Tensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ========================================
+// Normalization Class
+// ========================================
+// Fused normalization layers over one axis of a Tensor viewed as
+// [outer, size, inner] around that axis:
+//   LayerNorm / RMSNorm - one group per (outer, inner) position, normalized
+//                         across the size elements of the axis
+//   BatchNorm           - one group per index of the axis (the channel),
+//                         normalized across all outer * inner positions
+// gamma / beta hold one value per index of the axis. Statistics come from a
+// single Welford pass and the affine transform is applied in the same sweep
+// that normalizes, so a forward pass reads the input twice and writes the
+// output once; the backward passes are fused the same way.
+class Normalization
+{
+public:
+    // Saved by a training forward pass for the backward pass, one entry per
+    // group (flat, rank 1). RMSNorm leaves mean at zero.
+    struct Statistics
+    {
+        Tensor mean;
+        Tensor inv_std;
+    };
+
+    struct Gradients
+    {
+        Tensor input;
+        Tensor gamma;
+        Tensor beta;
+    };
+
+private:
+    struct Layout
+    {
+        int outer = 1;
+        int size = 1;
+        int inner = 1;
+    };
+
+    // ========== Constants ==========
+    static constexpr double EPSILON = 1e-5;
+    static constexpr double MOMENTUM = 0.1;
+    static constexpr int GRAIN = 1 << 14;
+
+private:
+    static Layout ResolveAxis(const Tensor& _tensor, const int& _axis, const std::string& _operation);
+
+    static void CheckParameter(const Tensor& _parameter, const Layout& _layout, const std::string& _operation, const std::string& _name);
+
+    static void CheckGradient(const Tensor& _grad, const Tensor& _input, const std::string& _operation);
+
+    static void PrepareStatistics(Statistics& _statistics, const int& _groups);
+
+    static void PrepareParameterGradient(Tensor& _gradient, const Tensor& _parameter);
+
+    static void GroupForward(const Tensor& _input, const Tensor& _gamma, const Tensor* _beta, Tensor& _output, Statistics& _statistics, const Layout& _layout, const double& _epsilon, const bool& _center);
+
+    static void GroupBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const Layout& _layout, const bool& _center);
+
+    static void NormalizeChannel(const double* _input, double* _output, const Layout& _layout, const int& _channel, const double& _mean, const double& _scale, const double& _shift);
+
+public:
+    // ========================================
+    // Layer Normalization Methods
+    // ========================================
+    static Tensor LayerNorm(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const int& _axis = -1, const double& _epsilon = Normalization::EPSILON);
+
+    static void LayerNorm(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, Tensor& _output, Statistics& _statistics, const int& _axis = -1, const double& _epsilon = Normalization::EPSILON);
+
+    static Gradients LayerNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis = -1);
+
+    static void LayerNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis = -1);
+
+    // ========================================
+    // RMS Normalization Methods
+    // ========================================
+    // x / sqrt(mean(x^2) + epsilon) * gamma; there is no beta (its gradient
+    // is left empty).
+    static Tensor RMSNorm(const Tensor& _input, const Tensor& _gamma, const int& _axis = -1, const double& _epsilon = Normalization::EPSILON);
+
+    static void RMSNorm(const Tensor& _input, const Tensor& _gamma, Tensor& _output, Statistics& _statistics, const int& _axis = -1, const double& _epsilon = Normalization::EPSILON);
+
+    static Gradients RMSNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis = -1);
+
+    static void RMSNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis = -1);
+
+    // ========================================
+    // Batch Normalization Methods
+    // ========================================
+    // Inference normalizes with the running statistics, folded into one
+    // scale and shift per channel.
+    static Tensor BatchNormInference(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const Tensor& _running_mean, const Tensor& _running_var, const int& _axis = 1, const double& _epsilon = Normalization::EPSILON);
+
+    static void BatchNormInference(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, const Tensor& _running_mean, const Tensor& _running_var, Tensor& _output, const int& _axis = 1, const double& _epsilon = Normalization::EPSILON);
+
+    // Training normalizes with the batch statistics (biased variance) and
+    // updates the running ones in place: running = (1 - momentum) * running
+    // + momentum * batch, with the unbiased variance.
+    static void BatchNormTraining(const Tensor& _input, const Tensor& _gamma, const Tensor& _beta, Tensor& _running_mean, Tensor& _running_var, Tensor& _output, Statistics& _statistics, const double& _momentum = Normalization::MOMENTUM, const int& _axis = 1, const double& _epsilon = Normalization::EPSILON);
+
+    static Gradients BatchNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, const int& _axis = 1);
+
+    static void BatchNormBackward(const Tensor& _grad, const Tensor& _input, const Tensor& _gamma, const Statistics& _statistics, Gradients& _gradients, const int& _axis = 1);
+};
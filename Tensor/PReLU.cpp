@@ -25,3 +25,5 @@ double Activation::PReLU::df(double x) const
 {
     return (x >= 0.0) ? 1.0 : this->alpha;
 }
+
+template class Activation::ScalarActivationImpl<Activation::PReLU>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class PReLU : public ScalarActivation
+	class PReLU : public ScalarActivationImpl<PReLU>
 	{
     private:
         double alpha;
@@ -20,4 +20,6 @@ namespace Activation
 
         double df(double x) const override;
 	};
+
+	extern template class ScalarActivationImpl<PReLU>;
 }
@@ -0,0 +1,540 @@
+#include "PivotedQR.h"
+
+// ========================================
+// [Private] Tolerance Method(s)
+// ========================================
+double LinAlg::PivotedQR::DefaultTolerance() const
+{
+	// Relative cut-off on |R_ii|, scaled by the largest pivot |R_00|.
+	int m = this->shape.first;
+	int n = this->shape.second;
+
+	return std::max(m, n) * std::numeric_limits<double>::epsilon() * std::abs(this->qr[0]);
+}
+
+int LinAlg::PivotedQR::RankFor(const std::optional<double>& _tolerance) const
+{
+	double tolerance = _tolerance.has_value() ? _tolerance.value() : this->DefaultTolerance();
+
+	int n = this->shape.second;
+	int k = std::min(this->shape.first, n);
+
+	int rank = 0;
+	while (rank < k && std::abs(this->qr[rank * n + rank]) > tolerance)
+	{
+		rank++;
+	}
+
+	return rank;
+}
+
+// ========================================
+// [Private] Reflector Application Method(s)
+// ========================================
+void LinAlg::PivotedQR::ApplyQT(double* _vector) const
+{
+	int m = this->shape.first;
+	int n = this->shape.second;
+	int k = std::min(m, n);
+
+	for (int i = 0; i < k; i++)
+	{
+		if (this->tau[i] == 0.0)
+		{
+			continue;
+		}
+
+		double s = _vector[i];
+		for (int r = i + 1; r < m; r++)
+		{
+			s += this->qr[r * n + i] * _vector[r];
+		}
+
+		s *= this->tau[i];
+
+		_vector[i] -= s;
+		for (int r = i + 1; r < m; r++)
+		{
+			_vector[r] -= s * this->qr[r * n + i];
+		}
+	}
+}
+
+void LinAlg::PivotedQR::ApplyQ(double* _vector) const
+{
+	int m = this->shape.first;
+	int n = this->shape.second;
+	int k = std::min(m, n);
+
+	for (int i = k - 1; i >= 0; i--)
+	{
+		if (this->tau[i] == 0.0)
+		{
+			continue;
+		}
+
+		double s = _vector[i];
+		for (int r = i + 1; r < m; r++)
+		{
+			s += this->qr[r * n + i] * _vector[r];
+		}
+
+		s *= this->tau[i];
+
+		_vector[i] -= s;
+		for (int r = i + 1; r < m; r++)
+		{
+			_vector[r] -= s * this->qr[r * n + i];
+		}
+	}
+}
+
+// ========================================
+// [Private] Triangular Solve Method(s)
+// ========================================
+void LinAlg::PivotedQR::SolveBasic(double* _work, double* _solution, const int& _rank) const
+{
+	int n = this->shape.second;
+
+	// _work holds Q^T * b; back-substitute R11 * z = c and scatter z through P.
+	for (int i = _rank - 1; i >= 0; i--)
+	{
+		double value = _work[i];
+		for (int j = i + 1; j < _rank; j++)
+		{
+			value -= this->qr[i * n + j] * _work[j];
+		}
+
+		_work[i] = value / this->qr[i * n + i];
+	}
+
+	std::fill(_solution, _solution + n, 0.0);
+
+	for (int j = 0; j < _rank; j++)
+	{
+		_solution[this->permutation[j]] = _work[j];
+	}
+}
+
+// ========================================
+// PivotedQR Constructor(s)
+// ========================================
+LinAlg::PivotedQR::PivotedQR(const LinAlg::Matrix& _matrix)
+{
+	this->Factorize(_matrix);
+}
+
+// ========================================
+// PivotedQR Factorization Method(s)
+// ========================================
+void LinAlg::PivotedQR::Factorize(const LinAlg::Matrix& _matrix)
+{
+	if (_matrix.IsEmpty())
+	{
+		throw std::runtime_error("[PivotedQR] Factorization failed: empty Matrix.");
+	}
+
+	int m = _matrix.shape.first;
+	int n = _matrix.shape.second;
+	int k = std::min(m, n);
+
+	this->shape = { m, n };
+
+	this->qr.resize(static_cast<size_t>(m) * n);
+	for (int i = 0; i < m; i++)
+	{
+		std::copy(_matrix.data[i], _matrix.data[i] + n, this->qr.begin() + static_cast<size_t>(i) * n);
+	}
+
+	this->tau.assign(k, 0.0);
+
+	this->permutation.resize(n);
+	std::iota(this->permutation.begin(), this->permutation.end(), 0);
+
+	this->norms.assign(n, 0.0);
+	for (int i = 0; i < m; i++)
+	{
+		for (int j = 0; j < n; j++)
+		{
+			this->norms[j] += this->qr[i * n + j] * this->qr[i * n + j];
+		}
+	}
+	for (double& value : this->norms)
+	{
+		value = std::sqrt(value);
+	}
+	this->norms_ref = this->norms;
+
+	this->work.resize(n);
+
+	double* a = this->qr.data();
+	const double downdate_limit = std::sqrt(std::numeric_limits<double>::epsilon());
+
+	for (int i = 0; i < k; i++)
+	{
+		// Bring the column with the largest remaining norm to position i.
+		int pivot = i + static_cast<int>(std::max_element(this->norms.begin() + i, this->norms.end()) - (this->norms.begin() + i));
+
+		if (pivot != i)
+		{
+			for (int r = 0; r < m; r++)
+			{
+				std::swap(a[r * n + i], a[r * n + pivot]);
+			}
+
+			std::swap(this->permutation[i], this->permutation[pivot]);
+			std::swap(this->norms[i], this->norms[pivot]);
+			std::swap(this->norms_ref[i], this->norms_ref[pivot]);
+		}
+
+		// Householder reflector H = I - tau * v * v^T with v_0 = 1 annihilating A[i+1:, i].
+		double alpha = a[i * n + i];
+		double x_norm = 0.0;
+		for (int r = i + 1; r < m; r++)
+		{
+			x_norm += a[r * n + i] * a[r * n + i];
+		}
+		x_norm = std::sqrt(x_norm);
+
+		if (x_norm == 0.0)
+		{
+			this->tau[i] = 0.0;
+		}
+		else
+		{
+			double beta = -std::copysign(std::hypot(alpha, x_norm), alpha);
+			double scale = 1.0 / (alpha - beta);
+
+			for (int r = i + 1; r < m; r++)
+			{
+				a[r * n + i] *= scale;
+			}
+
+			this->tau[i] = (beta - alpha) / beta;
+			a[i * n + i] = beta;
+		}
+
+		// Apply H to the trailing columns row by row: w = v^T * A, A -= tau * v * w.
+		if (this->tau[i] != 0.0 && i + 1 < n)
+		{
+			double* w = this->work.data();
+
+			for (int j = i + 1; j < n; j++)
+			{
+				w[j] = a[i * n + j];
+			}
+
+			for (int r = i + 1; r < m; r++)
+			{
+				double v = a[r * n + i];
+				const double* row = a + static_cast<size_t>(r) * n;
+
+				for (int j = i + 1; j < n; j++)
+				{
+					w[j] += v * row[j];
+				}
+			}
+
+			for (int j = i + 1; j < n; j++)
+			{
+				w[j] *= this->tau[i];
+				a[i * n + j] -= w[j];
+			}
+
+			for (int r = i + 1; r < m; r++)
+			{
+				double v = a[r * n + i];
+				double* row = a + static_cast<size_t>(r) * n;
+
+				for (int j = i + 1; j < n; j++)
+				{
+					row[j] -= v * w[j];
+				}
+			}
+		}
+
+		// Downdate the remaining column norms; recompute when cancellation makes them unreliable.
+		for (int j = i + 1; j < n; j++)
+		{
+			if (this->norms[j] == 0.0)
+			{
+				continue;
+			}
+
+			double ratio = std::abs(a[i * n + j]) / this->norms[j];
+			double temp = std::max(0.0, 1.0 - ratio * ratio);
+			double check = temp * (this->norms[j] / this->norms_ref[j]) * (this->norms[j] / this->norms_ref[j]);
+
+			if (check <= downdate_limit)
+			{
+				double value = 0.0;
+				for (int r = i + 1; r < m; r++)
+				{
+					value += a[r * n + j] * a[r * n + j];
+				}
+
+				this->norms[j] = std::sqrt(value);
+				this->norms_ref[j] = this->norms[j];
+			}
+			else
+			{
+				this->norms[j] *= std::sqrt(temp);
+			}
+		}
+	}
+}
+
+// ========================================
+// PivotedQR Getter Method(s)
+// ========================================
+std::pair<int, int> LinAlg::PivotedQR::Shape() const
+{
+	return this->shape;
+}
+
+std::vector<int> LinAlg::PivotedQR::Permutation() const
+{
+	return this->permutation;
+}
+
+int LinAlg::PivotedQR::Rank(const std::optional<double>& _tolerance) const
+{
+	if (this->qr.empty())
+	{
+		throw std::runtime_error("[PivotedQR] Rank failed: no factorization available.");
+	}
+
+	return this->RankFor(_tolerance);
+}
+
+LinAlg::Matrix LinAlg::PivotedQR::Q() const
+{
+	int m = this->shape.first;
+	int k = std::min(m, this->shape.second);
+
+	LinAlg::Matrix result({ m, k }, 0.0);
+	std::vector<double> column(m);
+
+	for (int j = 0; j < k; j++)
+	{
+		std::fill(column.begin(), column.end(), 0.0);
+		column[j] = 1.0;
+
+		this->ApplyQ(column.data());
+
+		for (int i = 0; i < m; i++)
+		{
+			result.data[i][j] = column[i];
+		}
+	}
+
+	return result;
+}
+
+LinAlg::Matrix LinAlg::PivotedQR::R() const
+{
+	int n = this->shape.second;
+	int k = std::min(this->shape.first, n);
+
+	LinAlg::Matrix result({ k, n }, 0.0);
+
+	for (int i = 0; i < k; i++)
+	{
+		for (int j = i; j < n; j++)
+		{
+			result.data[i][j] = this->qr[i * n + j];
+		}
+	}
+
+	return result;
+}
+
+// ========================================
+// PivotedQR Least-Squares Method(s)
+// ========================================
+std::vector<double> LinAlg::PivotedQR::LeastSquares(const std::vector<double>& _rhs, const std::optional<double>& _tolerance) const
+{
+	std::vector<double> solution;
+	std::vector<double> work;
+
+	this->LeastSquares(_rhs, solution, work, _tolerance);
+
+	return solution;
+}
+
+void LinAlg::PivotedQR::LeastSquares(const std::vector<double>& _rhs, std::vector<double>& _solution, std::vector<double>& _work, const std::optional<double>& _tolerance) const
+{
+	if (this->qr.empty())
+	{
+		throw std::runtime_error("[PivotedQR] Least-Squares failed: no factorization available.");
+	}
+
+	if (static_cast<int>(_rhs.size()) != this->shape.first)
+	{
+		throw std::invalid_argument("[PivotedQR] Least-Squares failed: right-hand side size mismatch with Matrix row-count.");
+	}
+
+	// Caller-owned buffers keep repeated solves allocation-free once sized.
+	_work.assign(_rhs.begin(), _rhs.end());
+	_solution.resize(this->shape.second);
+
+	this->ApplyQT(_work.data());
+	this->SolveBasic(_work.data(), _solution.data(), this->RankFor(_tolerance));
+}
+
+LinAlg::Matrix LinAlg::PivotedQR::LeastSquares(const LinAlg::Matrix& _rhs, const std::optional<double>& _tolerance) const
+{
+	if (this->qr.empty())
+	{
+		throw std::runtime_error("[PivotedQR] Least-Squares failed: no factorization available.");
+	}
+
+	if (_rhs.Row() != this->shape.first)
+	{
+		throw std::invalid_argument("[PivotedQR] Least-Squares failed: right-hand side row-count mismatch with Matrix row-count.");
+	}
+
+	int m = this->shape.first;
+	int n = this->shape.second;
+	int n_rhs = _rhs.Column();
+	int rank = this->RankFor(_tolerance);
+
+	LinAlg::Matrix result({ n, n_rhs }, 0.0);
+
+	std::vector<double> work(m);
+	std::vector<double> solution(n);
+
+	for (int c = 0; c < n_rhs; c++)
+	{
+		for (int i = 0; i < m; i++)
+		{
+			work[i] = _rhs.data[i][c];
+		}
+
+		this->ApplyQT(work.data());
+		this->SolveBasic(work.data(), solution.data(), rank);
+
+		for (int i = 0; i < n; i++)
+		{
+			result.data[i][c] = solution[i];
+		}
+	}
+
+	return result;
+}
+
+// ========================================
+// PivotedQR Subspace Method(s)
+// ========================================
+LinAlg::Matrix LinAlg::PivotedQR::Range(const std::optional<double>& _tolerance) const
+{
+	if (this->qr.empty())
+	{
+		throw std::runtime_error("[PivotedQR] Range failed: no factorization available.");
+	}
+
+	int m = this->shape.first;
+	int rank = this->RankFor(_tolerance);
+
+	if (rank == 0)
+	{
+		return LinAlg::Matrix();
+	}
+
+	// The first rank columns of Q span the column space of A.
+	LinAlg::Matrix result({ m, rank }, 0.0);
+	std::vector<double> column(m);
+
+	for (int j = 0; j < rank; j++)
+	{
+		std::fill(column.begin(), column.end(), 0.0);
+		column[j] = 1.0;
+
+		this->ApplyQ(column.data());
+
+		for (int i = 0; i < m; i++)
+		{
+			result.data[i][j] = column[i];
+		}
+	}
+
+	return result;
+}
+
+LinAlg::Matrix LinAlg::PivotedQR::NullSpace(const std::optional<double>& _tolerance) const
+{
+	if (this->qr.empty())
+	{
+		throw std::runtime_error("[PivotedQR] Null-Space failed: no factorization available.");
+	}
+
+	int n = this->shape.second;
+	int rank = this->RankFor(_tolerance);
+	int nullity = n - rank;
+
+	if (nullity == 0)
+	{
+		return LinAlg::Matrix();
+	}
+
+	// With A * P = Q * [R11 R12], each free column j gives a null vector
+	// P * [-R11^-1 * R12(:, j); e_j]; the set is then orthonormalized.
+	LinAlg::Matrix result({ n, nullity }, 0.0);
+	std::vector<double> y(rank);
+	std::vector<double> basis(static_cast<size_t>(nullity) * n, 0.0);
+
+	for (int f = 0; f < nullity; f++)
+	{
+		int j = rank + f;
+		double* vector = basis.data() + static_cast<size_t>(f) * n;
+
+		for (int i = rank - 1; i >= 0; i--)
+		{
+			double value = this->qr[i * n + j];
+			for (int c = i + 1; c < rank; c++)
+			{
+				value -= this->qr[i * n + c] * y[c];
+			}
+
+			y[i] = value / this->qr[i * n + i];
+		}
+
+		for (int c = 0; c < rank; c++)
+		{
+			vector[this->permutation[c]] = -y[c];
+		}
+		vector[this->permutation[j]] = 1.0;
+
+		// Modified Gram-Schmidt against the previous basis vectors.
+		for (int p = 0; p < f; p++)
+		{
+			const double* previous = basis.data() + static_cast<size_t>(p) * n;
+
+			double dot = 0.0;
+			for (int i = 0; i < n; i++)
+			{
+				dot += previous[i] * vector[i];
+			}
+
+			for (int i = 0; i < n; i++)
+			{
+				vector[i] -= dot * previous[i];
+			}
+		}
+
+		double norm = 0.0;
+		for (int i = 0; i < n; i++)
+		{
+			norm += vector[i] * vector[i];
+		}
+		norm = std::sqrt(norm);
+
+		for (int i = 0; i < n; i++)
+		{
+			vector[i] /= norm;
+			result.data[i][f] = vector[i];
+		}
+	}
+
+	return result;
+}
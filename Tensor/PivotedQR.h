@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace LinAlg
+{
+    // Householder QR with column pivoting, A * P = Q * R, kept in compact
+    // form (reflectors below the diagonal of R) so one factorization serves
+    // every rank, least-squares, range and null-space query. Factorize()
+    // reuses the internal buffers when called again on a same-sized Matrix.
+    class PivotedQR
+    {
+    private:
+        std::vector<double> qr;
+
+        std::vector<double> tau;
+
+        std::vector<int> permutation;
+
+        std::vector<double> norms;
+
+        std::vector<double> norms_ref;
+
+        std::vector<double> work;
+
+        std::pair<int, int> shape = { 0, 0 };
+
+    private:
+        double DefaultTolerance() const;
+
+        int RankFor(const std::optional<double>& _tolerance) const;
+
+        void ApplyQT(double* _vector) const;
+
+        void ApplyQ(double* _vector) const;
+
+        void SolveBasic(double* _work, double* _solution, const int& _rank) const;
+
+    public:
+        PivotedQR() {}
+
+        PivotedQR(const Matrix& _matrix);
+
+        void Factorize(const Matrix& _matrix);
+
+        std::pair<int, int> Shape() const;
+
+        std::vector<int> Permutation() const;
+
+        int Rank(const std::optional<double>& _tolerance = std::nullopt) const;
+
+        Matrix Q() const;
+
+        Matrix R() const;
+
+        std::vector<double> LeastSquares(const std::vector<double>& _rhs, const std::optional<double>& _tolerance = std::nullopt) const;
+
+        void LeastSquares(const std::vector<double>& _rhs, std::vector<double>& _solution, std::vector<double>& _work, const std::optional<double>& _tolerance = std::nullopt) const;
+
+        Matrix LeastSquares(const Matrix& _rhs, const std::optional<double>& _tolerance = std::nullopt) const;
+
+        Matrix Range(const std::optional<double>& _tolerance = std::nullopt) const;
+
+        Matrix NullSpace(const std::optional<double>& _tolerance = std::nullopt) const;
+    };
+}
@@ -0,0 +1,908 @@
+#include "QuantizedTensor.h"
+
+// ========================================
+// [Private] Helper Method(s)
+// ========================================
+void QuantizedTensor::Validate(const Parameters& _parameters, const std::vector<int>& _shape)
+{
+	const int rank = static_cast<int>(_shape.size());
+
+	if (_parameters.axis < -1 || _parameters.axis >= rank)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Invalid parameters: axis " + std::to_string(_parameters.axis)
+			+ " is out of range for rank " + std::to_string(rank) + ".");
+	}
+
+	const size_t count = (_parameters.axis == -1) ? 1 : static_cast<size_t>(_shape[_parameters.axis]);
+
+	if (_parameters.scales.size() != count || _parameters.zero_points.size() != count)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Invalid parameters: expected " + std::to_string(count) + " scale(s) and zero point(s).");
+	}
+
+	for (size_t c = 0; c < count; c++)
+	{
+		if (!(_parameters.scales[c] > 0.0f) || !std::isfinite(_parameters.scales[c]))
+		{
+			throw std::invalid_argument("[QuantizedTensor] Invalid parameters: scales must be positive and finite.");
+		}
+
+		if (_parameters.zero_points[c] < -128 || _parameters.zero_points[c] > 127)
+		{
+			throw std::invalid_argument("[QuantizedTensor] Invalid parameters: zero points must lie in [-128, 127].");
+		}
+	}
+}
+
+void QuantizedTensor::ChannelLayout(const std::vector<int>& _shape, const int& _axis, int& _outer, int& _channels, int& _inner)
+{
+	_outer = 1;
+	_channels = 1;
+	_inner = 1;
+
+	for (int d = 0; d < static_cast<int>(_shape.size()); d++)
+	{
+		if (d < _axis)
+		{
+			_outer *= _shape[d];
+		}
+		else if (d == _axis)
+		{
+			_channels = _shape[d];
+		}
+		else
+		{
+			_inner *= _shape[d];
+		}
+	}
+}
+
+int64_t QuantizedTensor::Magnitude(const Parameters& _parameters)
+{
+	int64_t magnitude = 0;
+
+	for (const int32_t& zero_point : _parameters.zero_points)
+	{
+		magnitude = std::max(magnitude, static_cast<int64_t>(std::max(127 - zero_point, zero_point + 128)));
+	}
+
+	return magnitude;
+}
+
+// ========================================
+// [Private] Kernel Method(s)
+// ========================================
+// Row by row of the [outer, channels, inner] layout, so each row has one
+// scale and zero point. x / scale is computed as x * (1 / scale); NaN maps
+// to the zero point (0.0), as Conversion maps it to 0.
+template <typename T>
+void QuantizedTensor::QuantizeValues(const T* _source, const std::vector<int>& _shape, const Parameters& _parameters, int8_t* _destination)
+{
+	using Compute = std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+	int outer = 0, channels = 0, inner = 0;
+	QuantizedTensor::ChannelLayout(_shape, _parameters.axis, outer, channels, inner);
+
+	if (inner == 0)
+	{
+		return;
+	}
+
+	Utils::ParallelFor(0, outer * channels, [&](int begin, int end)
+		{
+			for (int row = begin; row < end; row++)
+			{
+				const int channel = row % channels;
+
+				const Compute inverse = Compute(1) / static_cast<Compute>(_parameters.scales[channel]);
+				const Compute zero_point = static_cast<Compute>(_parameters.zero_points[channel]);
+
+				const T* source = _source + (static_cast<size_t>(row) * inner);
+				int8_t* destination = _destination + (static_cast<size_t>(row) * inner);
+
+				for (int i = 0; i < inner; i++)
+				{
+					Compute value = std::nearbyint(static_cast<Compute>(source[i]) * inverse) + zero_point;
+					Compute clamped = std::min(std::max(value, Compute(-128)), Compute(127));
+
+					destination[i] = static_cast<int8_t>((value == value) ? clamped : zero_point);
+				}
+			}
+		}, std::max(1, QuantizedTensor::PARALLEL_COUNT / inner));
+}
+
+template <typename T>
+void QuantizedTensor::DequantizeValues(T* _destination) const
+{
+	int outer = 0, channels = 0, inner = 0;
+	QuantizedTensor::ChannelLayout(this->values.Shape(), this->parameters.axis, outer, channels, inner);
+
+	if (inner == 0)
+	{
+		return;
+	}
+
+	const int8_t* source = this->values.Data();
+
+	Utils::ParallelFor(0, outer * channels, [&](int begin, int end)
+		{
+			for (int row = begin; row < end; row++)
+			{
+				const int channel = row % channels;
+
+				const T scale = static_cast<T>(this->parameters.scales[channel]);
+				const int32_t zero_point = this->parameters.zero_points[channel];
+
+				for (size_t i = static_cast<size_t>(row) * inner; i < static_cast<size_t>(row + 1) * inner; i++)
+				{
+					_destination[i] = static_cast<T>(static_cast<int32_t>(source[i]) - zero_point) * scale;
+				}
+			}
+		}, std::max(1, QuantizedTensor::PARALLEL_COUNT / inner));
+}
+
+// acc * _scales[j] + _bias[j] per column, as float or requantized to the
+// (per-tensor) _output parameters with the division by its scale folded
+// into the column multipliers.
+template <typename Result>
+void QuantizedTensor::Epilogue(const TypedTensor<int32_t>& _accumulators, const std::vector<float>& _scales, const std::vector<float>& _bias, const Parameters* _output, Result* _out)
+{
+	const int columns = static_cast<int>(_scales.size());
+	const int rows = _accumulators.Volume() / columns;
+
+	std::vector<float> multipliers(columns);
+	std::vector<float> offsets(columns);
+
+	for (int j = 0; j < columns; j++)
+	{
+		const float bias = _bias.empty() ? 0.0f : _bias[j];
+
+		if constexpr (std::is_same_v<Result, int8_t>)
+		{
+			const float inverse = 1.0f / _output->scales[0];
+
+			multipliers[j] = _scales[j] * inverse;
+			offsets[j] = (bias * inverse) + static_cast<float>(_output->zero_points[0]);
+		}
+		else
+		{
+			multipliers[j] = _scales[j];
+			offsets[j] = bias;
+		}
+	}
+
+	const int32_t* source = _accumulators.Data();
+
+	Utils::ParallelFor(0, rows, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				const int32_t* row = source + (static_cast<size_t>(i) * columns);
+				Result* destination = _out + (static_cast<size_t>(i) * columns);
+
+				for (int j = 0; j < columns; j++)
+				{
+					const float value = (static_cast<float>(row[j]) * multipliers[j]) + offsets[j];
+
+					if constexpr (std::is_same_v<Result, int8_t>)
+					{
+						destination[j] = static_cast<int8_t>(std::min(std::max(std::nearbyint(value), -128.0f), 127.0f));
+					}
+					else
+					{
+						destination[j] = value;
+					}
+				}
+			}
+		}, std::max(1, QuantizedTensor::PARALLEL_COUNT / columns));
+}
+
+// ========================================
+// [Private] Product Method(s)
+// ========================================
+// The raw int8 product comes from Gemm; the zero points are then removed
+// with the row sums of _tensor_1 and the column sums of _tensor_2, in
+// 64-bit so only the corrected value has to fit in int32_t.
+void QuantizedTensor::MatrixProduct(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<int32_t>& _out)
+{
+	if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty() || _tensor_1.Volume() == 0 || _tensor_2.Volume() == 0)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: cannot multiply empty tensors.");
+	}
+
+	if (_tensor_1.Rank() == 0)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: first operand must have rank >= 1.");
+	}
+
+	if (_tensor_2.Rank() != 2)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: second operand must be a [K, N] matrix.");
+	}
+
+	const std::vector<int> shape_1 = _tensor_1.Shape();
+	const std::vector<int> shape_2 = _tensor_2.Shape();
+
+	const int depth = shape_1.back();
+	const int columns = shape_2[1];
+	const int rows = _tensor_1.Volume() / depth;
+
+	if (depth != shape_2[0])
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(depth) + " and " + std::to_string(shape_2[0]) + ").");
+	}
+
+	if (_tensor_1.parameters.axis != -1)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: first operand must be quantized per tensor.");
+	}
+
+	if (_tensor_2.parameters.axis == 0)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: second operand must be quantized per tensor or per column (axis 1).");
+	}
+
+	if (depth * QuantizedTensor::Magnitude(_tensor_1.parameters) * QuantizedTensor::Magnitude(_tensor_2.parameters) > std::numeric_limits<int32_t>::max())
+	{
+		throw std::overflow_error("[QuantizedTensor] Multiplication failed: depth " + std::to_string(depth) + " could overflow the int32 accumulators.");
+	}
+
+	std::vector<int> shape = shape_1;
+	shape.back() = columns;
+
+	_out.Resize(shape);
+
+	const int8_t* a = _tensor_1.values.Data();
+	const int8_t* b = _tensor_2.values.Data();
+	int32_t* c = _out.Data();
+
+	LinAlg::Gemm::Multiply(LinAlg::Gemm::BasicView<int8_t>{ a, rows, depth, depth, 1 }, false,
+		LinAlg::Gemm::BasicView<int8_t>{ b, depth, columns, columns, 1 }, false,
+		LinAlg::Gemm::BasicOutput<int32_t>{ c, columns, 1 });
+
+	const int64_t a_zero = _tensor_1.parameters.zero_points[0];
+
+	std::vector<int64_t> b_zero(columns);
+
+	for (int j = 0; j < columns; j++)
+	{
+		b_zero[j] = _tensor_2.parameters.zero_points[(_tensor_2.parameters.axis == -1) ? 0 : j];
+	}
+
+	const bool b_offset = std::any_of(b_zero.begin(), b_zero.end(), [](int64_t _zero) { return _zero != 0; });
+
+	if (a_zero == 0 && !b_offset)
+	{
+		return;
+	}
+
+	std::vector<int64_t> column_sums(columns, 0);
+
+	if (a_zero != 0)
+	{
+		for (int p = 0; p < depth; p++)
+		{
+			const int8_t* b_row = b + (static_cast<size_t>(p) * columns);
+
+			for (int j = 0; j < columns; j++)
+			{
+				column_sums[j] += b_row[j];
+			}
+		}
+
+		for (int j = 0; j < columns; j++)
+		{
+			column_sums[j] = (a_zero * column_sums[j]) - (static_cast<int64_t>(depth) * a_zero * b_zero[j]);
+		}
+	}
+
+	Utils::ParallelFor(0, rows, [&](int begin, int end)
+		{
+			for (int i = begin; i < end; i++)
+			{
+				int64_t row_sum = 0;
+
+				if (b_offset)
+				{
+					const int8_t* a_row = a + (static_cast<size_t>(i) * depth);
+
+					for (int p = 0; p < depth; p++)
+					{
+						row_sum += a_row[p];
+					}
+				}
+
+				int32_t* c_row = c + (static_cast<size_t>(i) * columns);
+
+				for (int j = 0; j < columns; j++)
+				{
+					c_row[j] = static_cast<int32_t>(c_row[j] - (b_zero[j] * row_sum) - column_sums[j]);
+				}
+			}
+		}, std::max(1, QuantizedTensor::PARALLEL_COUNT / std::max(depth, columns)));
+}
+
+// ========================================
+// [Private] Convolution Method(s)
+// ========================================
+// As Tensor::Convolve, in int32_t on the centered values: the filter is
+// centered once, and interior windows subtract the input zero point times
+// the filter sum instead of centering every input element. Output elements
+// are split across threads.
+void QuantizedTensor::Correlate(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<int32_t>& _out) const
+{
+	const std::vector<int> shape = this->Shape();
+	const int rank = this->Rank();
+
+	if (this->IsEmpty() || _filter.IsEmpty() || this->Volume() == 0 || _filter.Volume() == 0)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: cannot convolve empty tensors.");
+	}
+
+	if (static_cast<int>(_strides.size()) != rank)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: stride size mismatch with Tensor's rank.");
+	}
+
+	if (static_cast<int>(_padding.size()) != rank)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: padding size mismatch with Tensor's rank.");
+	}
+
+	if (!Utils::IsAllPositive(_strides))
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: stride values must be positive.");
+	}
+
+	if (Utils::IsAnyNegative(_padding))
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: found negative padding value. padding value(s) should be >= 0.");
+	}
+
+	if (this->parameters.axis != -1 || _filter.parameters.axis != -1)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: input and kernel must be quantized per tensor.");
+	}
+
+	std::vector<int> padded_shape(rank);
+
+	for (int i = 0; i < rank; i++)
+	{
+		padded_shape[i] = shape[i] + (2 * _padding[i]);
+	}
+
+	if (Utils::IsVolumeOverflow(padded_shape))
+	{
+		throw std::overflow_error("[QuantizedTensor] Convolution failed: shape too large, potential overflow.");
+	}
+
+	const std::vector<int> kernel_shape = _filter.Shape();
+
+	if (!Utils::IsConvolveCompatible(padded_shape, kernel_shape))
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: kernel shape is not compatible with Tensor for convolution.");
+	}
+
+	const int filter_volume = _filter.Volume();
+
+	if (filter_volume * QuantizedTensor::Magnitude(this->parameters) * QuantizedTensor::Magnitude(_filter.parameters) > std::numeric_limits<int32_t>::max())
+	{
+		throw std::overflow_error("[QuantizedTensor] Convolution failed: kernel volume " + std::to_string(filter_volume) + " could overflow the int32 accumulators.");
+	}
+
+	std::vector<int> filter_shape((rank - _filter.Rank()), 1);
+	filter_shape.insert(filter_shape.end(), kernel_shape.begin(), kernel_shape.end());
+
+	const std::vector<int> out_shape = Utils::ConvolvedFeatureShape(padded_shape, filter_shape, _strides);
+
+	_out.Resize(out_shape);
+
+	std::vector<int> strides(rank, 1);
+
+	for (int d = rank - 2; d >= 0; d--)
+	{
+		strides[d] = strides[d + 1] * shape[d + 1];
+	}
+
+	std::vector<int> window_offsets;
+	Tensor::WindowOffsets(filter_shape, strides, window_offsets);
+
+	const int32_t input_zero = this->parameters.zero_points[0];
+	const int32_t filter_zero = _filter.parameters.zero_points[0];
+
+	std::vector<int32_t> weights(filter_volume);
+	int32_t weight_sum = 0;
+
+	for (int k = 0; k < filter_volume; k++)
+	{
+		weights[k] = static_cast<int32_t>(_filter.values.Data()[k]) - filter_zero;
+		weight_sum += weights[k];
+	}
+
+	const int8_t* input = this->values.Data();
+	int32_t* output = _out.Data();
+
+	Utils::ParallelFor(0, _out.Volume(), [&](int begin, int end)
+		{
+			std::vector<int> position(rank, 0);
+			std::vector<int> window_index(rank, 0);
+
+			for (int d = rank - 1, index = begin; d >= 0; d--)
+			{
+				position[d] = index % out_shape[d];
+				index /= out_shape[d];
+			}
+
+			for (int i = begin; i < end; i++)
+			{
+				bool interior = true;
+				int origin = 0;
+
+				for (int d = 0; d < rank; d++)
+				{
+					int start = (position[d] * _strides[d]) - _padding[d];
+
+					interior = interior && (start >= 0) && (start + filter_shape[d] <= shape[d]);
+					origin += start * strides[d];
+				}
+
+				int32_t sum = 0;
+
+				if (interior)
+				{
+					for (int k = 0; k < filter_volume; k++)
+					{
+						sum += static_cast<int32_t>(input[origin + window_offsets[k]]) * weights[k];
+					}
+
+					sum -= input_zero * weight_sum;
+				}
+				else
+				{
+					std::fill(window_index.begin(), window_index.end(), 0);
+
+					for (int k = 0; k < filter_volume; k++)
+					{
+						bool inside = true;
+						for (int d = 0; d < rank; d++)
+						{
+							int coordinate = (position[d] * _strides[d]) - _padding[d] + window_index[d];
+							inside = inside && (coordinate >= 0) && (coordinate < shape[d]);
+						}
+
+						if (inside)
+						{
+							sum += (static_cast<int32_t>(input[origin + window_offsets[k]]) - input_zero) * weights[k];
+						}
+
+						for (int d = rank - 1; d >= 0; d--)
+						{
+							if (++window_index[d] < filter_shape[d])
+							{
+								break;
+							}
+							window_index[d] = 0;
+						}
+					}
+				}
+
+				output[i] = sum;
+
+				for (int d = rank - 1; d >= 0; d--)
+				{
+					if (++position[d] < out_shape[d])
+					{
+						break;
+					}
+					position[d] = 0;
+				}
+			}
+		}, std::max(1, QuantizedTensor::PARALLEL_COUNT / filter_volume));
+}
+
+// ========================================
+// Constructor(s)
+// ========================================
+QuantizedTensor::QuantizedTensor(const TypedTensor<int8_t>& _values, const Parameters& _parameters)
+{
+	QuantizedTensor::Validate(_parameters, _values.Shape());
+
+	this->values = _values;
+	this->parameters = _parameters;
+}
+
+// ========================================
+// Calibration Method(s)
+// ========================================
+// Symmetric: scale = max|x| / 127. Asymmetric: scale = (max - min) / 255
+// and min maps to -128. A zero range gets scale 1.
+QuantizedTensor::Parameters QuantizedTensor::ChooseParameters(const double& _min, const double& _max, const bool& _symmetric)
+{
+	if (!std::isfinite(_min) || !std::isfinite(_max) || _min > _max)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Calibration failed: range must be finite with min <= max.");
+	}
+
+	const double low = std::min(_min, 0.0);
+	const double high = std::max(_max, 0.0);
+
+	double scale = _symmetric ? (std::max(-low, high) / 127.0) : ((high - low) / 255.0);
+	int32_t zero_point = 0;
+
+	if (!(static_cast<float>(scale) > 0.0f))
+	{
+		scale = 1.0;
+	}
+	else if (!_symmetric)
+	{
+		zero_point = static_cast<int32_t>(std::min(std::max(std::nearbyint(-128.0 - (low / scale)), -128.0), 127.0));
+	}
+
+	if (!std::isfinite(static_cast<float>(scale)))
+	{
+		throw std::overflow_error("[QuantizedTensor] Calibration failed: range too large for a float scale.");
+	}
+
+	Parameters parameters;
+	parameters.scales = { static_cast<float>(scale) };
+	parameters.zero_points = { zero_point };
+
+	return parameters;
+}
+
+QuantizedTensor::Parameters QuantizedTensor::CalibrateMinMax(const Tensor& _tensor, const bool& _symmetric, const int& _axis)
+{
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[QuantizedTensor] Calibration failed: empty Tensor.");
+	}
+
+	if (_axis == -1)
+	{
+		return QuantizedTensor::ChooseParameters(_tensor.Min(), _tensor.Max(), _symmetric);
+	}
+
+	const std::vector<int> shape = _tensor.Shape();
+
+	if (_axis < 0 || _axis >= _tensor.Rank())
+	{
+		throw std::invalid_argument("[QuantizedTensor] Calibration failed: axis " + std::to_string(_axis)
+			+ " is out of range for rank " + std::to_string(_tensor.Rank()) + ".");
+	}
+
+	int outer = 0, channels = 0, inner = 0;
+	QuantizedTensor::ChannelLayout(shape, _axis, outer, channels, inner);
+
+	std::vector<double> minimums(channels, std::numeric_limits<double>::infinity());
+	std::vector<double> maximums(channels, -std::numeric_limits<double>::infinity());
+
+	const double* source = &*_tensor.begin();
+
+	for (int row = 0; row < outer * channels; row++)
+	{
+		const int channel = row % channels;
+		const double* values = source + (static_cast<size_t>(row) * inner);
+
+		for (int i = 0; i < inner; i++)
+		{
+			minimums[channel] = std::min(minimums[channel], values[i]);
+			maximums[channel] = std::max(maximums[channel], values[i]);
+		}
+	}
+
+	Parameters parameters;
+	parameters.axis = _axis;
+
+	for (int c = 0; c < channels; c++)
+	{
+		Parameters channel = QuantizedTensor::ChooseParameters(minimums[c], maximums[c], _symmetric);
+
+		parameters.scales.push_back(channel.scales[0]);
+		parameters.zero_points.push_back(channel.zero_points[0]);
+	}
+
+	return parameters;
+}
+
+std::vector<long long> QuantizedTensor::Histogram(const Tensor& _tensor, const double& _min, const double& _max, const int& _bins)
+{
+	if (_bins <= 0)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Histogram failed: bin count must be positive.");
+	}
+
+	if (!(_min < _max) || !std::isfinite(_max - _min))
+	{
+		throw std::invalid_argument("[QuantizedTensor] Histogram failed: range must be finite with min < max.");
+	}
+
+	std::vector<long long> counts(_bins, 0);
+
+	const double scale = _bins / (_max - _min);
+	const double last = static_cast<double>(_bins - 1);
+
+	for (const double& value : _tensor)
+	{
+		if (value != value)
+		{
+			continue;
+		}
+
+		counts[static_cast<int>(std::min(std::max((value - _min) * scale, 0.0), last))]++;
+	}
+
+	return counts;
+}
+
+// The symmetric histogram spans [-max|x|, max|x|] in 2 * _bins bins, which
+// fold into _bins bins of |x|; the clipping point is the upper edge of the
+// bin where the running count reaches the share.
+QuantizedTensor::Parameters QuantizedTensor::CalibratePercentile(const Tensor& _tensor, const double& _percentile, const bool& _symmetric, const int& _bins)
+{
+	if (!(_percentile > 0.0 && _percentile <= 1.0))
+	{
+		throw std::invalid_argument("[QuantizedTensor] Calibration failed: percentile must lie in (0, 1].");
+	}
+
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[QuantizedTensor] Calibration failed: empty Tensor.");
+	}
+
+	const double min = _tensor.Min();
+	const double max = _tensor.Max();
+
+	if (_symmetric)
+	{
+		const double bound = std::max(std::abs(min), std::abs(max));
+
+		if (bound == 0.0)
+		{
+			return QuantizedTensor::ChooseParameters(0.0, 0.0, true);
+		}
+
+		std::vector<long long> counts = QuantizedTensor::Histogram(_tensor, -bound, bound, 2 * _bins);
+
+		long long total = std::accumulate(counts.begin(), counts.end(), 0LL);
+		long long running = 0;
+
+		int bin = 0;
+
+		for (; bin < _bins - 1; bin++)
+		{
+			running += counts[_bins + bin] + counts[_bins - 1 - bin];
+
+			if (running >= _percentile * total)
+			{
+				break;
+			}
+		}
+
+		const double threshold = (bin + 1) * (bound / _bins);
+
+		return QuantizedTensor::ChooseParameters(-threshold, threshold, true);
+	}
+
+	if (min == max)
+	{
+		return QuantizedTensor::ChooseParameters(min, max, false);
+	}
+
+	std::vector<long long> counts = QuantizedTensor::Histogram(_tensor, min, max, _bins);
+
+	const double tail = 0.5 * (1.0 - _percentile) * std::accumulate(counts.begin(), counts.end(), 0LL);
+	const double width = (max - min) / _bins;
+
+	int low = 0;
+
+	for (long long running = counts[0]; low < _bins - 1 && running <= tail; running += counts[++low])
+	{
+	}
+
+	int high = _bins - 1;
+
+	for (long long running = counts[_bins - 1]; high > low && running <= tail; running += counts[--high])
+	{
+	}
+
+	return QuantizedTensor::ChooseParameters(min + (low * width), min + ((high + 1) * width), false);
+}
+
+// ========================================
+// Quantization Method(s)
+// ========================================
+QuantizedTensor QuantizedTensor::Quantize(const Tensor& _tensor, const Parameters& _parameters)
+{
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[QuantizedTensor] Quantization failed: empty Tensor.");
+	}
+
+	QuantizedTensor::Validate(_parameters, _tensor.Shape());
+
+	QuantizedTensor result;
+	result.values.Resize(_tensor.Shape());
+	result.parameters = _parameters;
+
+	QuantizedTensor::QuantizeValues(&*_tensor.begin(), _tensor.Shape(), _parameters, result.values.Data());
+
+	return result;
+}
+
+QuantizedTensor QuantizedTensor::Quantize(const TypedTensor<float>& _tensor, const Parameters& _parameters)
+{
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[QuantizedTensor] Quantization failed: empty Tensor.");
+	}
+
+	QuantizedTensor::Validate(_parameters, _tensor.Shape());
+
+	QuantizedTensor result;
+	result.values.Resize(_tensor.Shape());
+	result.parameters = _parameters;
+
+	QuantizedTensor::QuantizeValues(_tensor.Data(), _tensor.Shape(), _parameters, result.values.Data());
+
+	return result;
+}
+
+Tensor QuantizedTensor::Dequantize() const
+{
+	if (this->IsEmpty())
+	{
+		return Tensor();
+	}
+
+	Tensor result(this->Shape());
+	this->DequantizeValues(&*result.begin());
+
+	return result;
+}
+
+void QuantizedTensor::Dequantize(TypedTensor<float>& _out) const
+{
+	if (this->IsEmpty())
+	{
+		_out = TypedTensor<float>();
+		return;
+	}
+
+	_out.Resize(this->Shape());
+	this->DequantizeValues(_out.Data());
+}
+
+// ========================================
+// Matrix Product Method(s)
+// ========================================
+void QuantizedTensor::MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<int32_t>& _out)
+{
+	QuantizedTensor::MatrixProduct(_tensor_1, _tensor_2, _out);
+}
+
+void QuantizedTensor::MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<float>& _out, const std::vector<float>& _bias)
+{
+	TypedTensor<int32_t> accumulators;
+	QuantizedTensor::MatrixProduct(_tensor_1, _tensor_2, accumulators);
+
+	const int columns = _tensor_2.Shape()[1];
+
+	if (!_bias.empty() && static_cast<int>(_bias.size()) != columns)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: bias must have one entry per output column.");
+	}
+
+	std::vector<float> scales(columns);
+
+	for (int j = 0; j < columns; j++)
+	{
+		scales[j] = _tensor_1.parameters.scales[0] * _tensor_2.parameters.scales[(_tensor_2.parameters.axis == -1) ? 0 : j];
+	}
+
+	_out.Resize(accumulators.Shape());
+	QuantizedTensor::Epilogue(accumulators, scales, _bias, nullptr, _out.Data());
+}
+
+void QuantizedTensor::MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, const Parameters& _output, QuantizedTensor& _out, const std::vector<float>& _bias)
+{
+	if (_output.axis != -1)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: output must be quantized per tensor.");
+	}
+
+	TypedTensor<int32_t> accumulators;
+	QuantizedTensor::MatrixProduct(_tensor_1, _tensor_2, accumulators);
+
+	QuantizedTensor::Validate(_output, accumulators.Shape());
+
+	const int columns = _tensor_2.Shape()[1];
+
+	if (!_bias.empty() && static_cast<int>(_bias.size()) != columns)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Multiplication failed: bias must have one entry per output column.");
+	}
+
+	std::vector<float> scales(columns);
+
+	for (int j = 0; j < columns; j++)
+	{
+		scales[j] = _tensor_1.parameters.scales[0] * _tensor_2.parameters.scales[(_tensor_2.parameters.axis == -1) ? 0 : j];
+	}
+
+	// Both operands are fully read by now, so _out may be one of them.
+	_out.values.Resize(accumulators.Shape());
+	_out.parameters = _output;
+
+	QuantizedTensor::Epilogue(accumulators, scales, _bias, &_output, _out.values.Data());
+}
+
+// ========================================
+// Convolution Method(s)
+// ========================================
+void QuantizedTensor::Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<int32_t>& _out) const
+{
+	this->Correlate(_filter, _strides, _padding, _out);
+}
+
+void QuantizedTensor::Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<float>& _out, const float& _bias) const
+{
+	TypedTensor<int32_t> accumulators;
+	this->Correlate(_filter, _strides, _padding, accumulators);
+
+	_out.Resize(accumulators.Shape());
+	QuantizedTensor::Epilogue(accumulators, { this->parameters.scales[0] * _filter.parameters.scales[0] }, { _bias }, nullptr, _out.Data());
+}
+
+void QuantizedTensor::Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, const Parameters& _output, QuantizedTensor& _out, const float& _bias) const
+{
+	if (_output.axis != -1)
+	{
+		throw std::invalid_argument("[QuantizedTensor] Convolution failed: output must be quantized per tensor.");
+	}
+
+	TypedTensor<int32_t> accumulators;
+	this->Correlate(_filter, _strides, _padding, accumulators);
+
+	QuantizedTensor::Validate(_output, accumulators.Shape());
+
+	const float scale = this->parameters.scales[0] * _filter.parameters.scales[0];
+
+	_out.values.Resize(accumulators.Shape());
+	_out.parameters = _output;
+
+	QuantizedTensor::Epilogue(accumulators, { scale }, { _bias }, &_output, _out.values.Data());
+}
+
+// ========================================
+// Accessor Method(s)
+// ========================================
+const TypedTensor<int8_t>& QuantizedTensor::Values() const
+{
+	return this->values;
+}
+
+const QuantizedTensor::Parameters& QuantizedTensor::GetParameters() const
+{
+	return this->parameters;
+}
+
+int QuantizedTensor::Rank() const
+{
+	return this->values.Rank();
+}
+
+int QuantizedTensor::Volume() const
+{
+	return this->values.Volume();
+}
+
+std::vector<int> QuantizedTensor::Shape() const
+{
+	return this->values.Shape();
+}
+
+bool QuantizedTensor::IsEmpty() const
+{
+	return this->values.IsEmpty();
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Gemm.h"
+#include "Tensor.h"
+#include "TypedTensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// ========================================
+// QuantizedTensor Class
+// ========================================
+// An int8_t tensor with affine quantization: a stored value q stands for
+// scale * (q - zero_point). The parameters are per tensor or per channel
+// along one axis (e.g. the output columns of a weight matrix), symmetric
+// (zero point 0, values in [-127, 127]) or asymmetric (the calibrated
+// [min, max] spread over [-128, 127]); either way 0.0 is represented
+// exactly, so zero padding stays exact.
+//
+// Parameters come from calibration: CalibrateMinMax covers the whole range
+// of a tensor (Tensor::Min / Max, or per channel), CalibratePercentile
+// builds a histogram of the values and clips the given share of outliers,
+// which usually suits activations better.
+//
+// MatMul and Convolve multiply the stored values exactly in int32_t (MatMul
+// on Gemm's int8 path) and then remove the zero points:
+//   sum (a - za)(b - zb) = sum a b - zb sum a - za sum b + K za zb.
+// The int32_t result stands for the product at scale sa * sb. Epilogues
+// either dequantize it to float (acc * sa * sb + bias) or requantize it to
+// int8_t at the output's parameters (round((acc * sa * sb + bias) / so) +
+// zo, saturated), so no double tensor is ever formed.
+class QuantizedTensor
+{
+public:
+    // One scale and zero point per tensor (axis -1) or per index along axis.
+    struct Parameters
+    {
+        std::vector<float> scales;
+        std::vector<int32_t> zero_points;
+        int axis = -1;
+    };
+
+private:
+    TypedTensor<int8_t> values;
+
+    Parameters parameters;
+
+    // ========== Constants ==========
+    static constexpr int HISTOGRAM_BINS = 2048;
+    static constexpr int PARALLEL_COUNT = 1 << 16;
+
+private:
+    static void Validate(const Parameters& _parameters, const std::vector<int>& _shape);
+
+    // The tensor as [outer, channels, inner] around the parameters' axis
+    // (channels = 1 per tensor).
+    static void ChannelLayout(const std::vector<int>& _shape, const int& _axis, int& _outer, int& _channels, int& _inner);
+
+    // Largest |q - zero_point| a value quantized with these parameters has.
+    static int64_t Magnitude(const Parameters& _parameters);
+
+    template <typename T>
+    static void QuantizeValues(const T* _source, const std::vector<int>& _shape, const Parameters& _parameters, int8_t* _destination);
+
+    template <typename T>
+    void DequantizeValues(T* _destination) const;
+
+    static void MatrixProduct(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<int32_t>& _out);
+
+    void Correlate(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<int32_t>& _out) const;
+
+    // Applies the epilogue to accumulators whose last axis has
+    // _scales.size() columns; column j stands for acc * _scales[j].
+    template <typename Result>
+    static void Epilogue(const TypedTensor<int32_t>& _accumulators, const std::vector<float>& _scales, const std::vector<float>& _bias, const Parameters* _output, Result* _out);
+
+public:
+    QuantizedTensor() {}
+
+    QuantizedTensor(const TypedTensor<int8_t>& _values, const Parameters& _parameters);
+
+    // Parameters covering [_min, _max] (widened to include 0).
+    static Parameters ChooseParameters(const double& _min, const double& _max, const bool& _symmetric);
+
+    // Covers the full range of _tensor, per tensor (_axis = -1) or per
+    // index along _axis.
+    static Parameters CalibrateMinMax(const Tensor& _tensor, const bool& _symmetric, const int& _axis = -1);
+
+    // Counts of the values in _bins equal bins over [_min, _max]; values
+    // outside fall into the end bins.
+    static std::vector<long long> Histogram(const Tensor& _tensor, const double& _min, const double& _max, const int& _bins = HISTOGRAM_BINS);
+
+    // Per-tensor parameters covering the given share (e.g. 0.9999) of the
+    // values: of |x| when symmetric, else with half the rest clipped from
+    // each tail.
+    static Parameters CalibratePercentile(const Tensor& _tensor, const double& _percentile, const bool& _symmetric, const int& _bins = HISTOGRAM_BINS);
+
+    // q = saturate(round(x / scale) + zero_point).
+    static QuantizedTensor Quantize(const Tensor& _tensor, const Parameters& _parameters);
+
+    static QuantizedTensor Quantize(const TypedTensor<float>& _tensor, const Parameters& _parameters);
+
+    Tensor Dequantize() const;
+
+    void Dequantize(TypedTensor<float>& _out) const;
+
+    // _tensor_1 [..., K] (per tensor) times _tensor_2 [K, N] (per tensor or
+    // per column, axis 1); the result has shape [..., N]. The int32_t form
+    // gives the zero-point-corrected accumulators, which stand for the
+    // product at scale s1 * s2[j]; _bias has 0 or N entries.
+    static void MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<int32_t>& _out);
+
+    static void MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, TypedTensor<float>& _out, const std::vector<float>& _bias = {});
+
+    static void MatMul(const QuantizedTensor& _tensor_1, const QuantizedTensor& _tensor_2, const Parameters& _output, QuantizedTensor& _out, const std::vector<float>& _bias = {});
+
+    // Convolution as Tensor::Convolve (zero padding, i.e. padding with the
+    // zero point); both tensors must be quantized per tensor.
+    void Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<int32_t>& _out) const;
+
+    void Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, TypedTensor<float>& _out, const float& _bias = 0.0f) const;
+
+    void Convolve(const QuantizedTensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, const Parameters& _output, QuantizedTensor& _out, const float& _bias = 0.0f) const;
+
+    const TypedTensor<int8_t>& Values() const;
+
+    const Parameters& GetParameters() const;
+
+    int Rank() const;
+
+    int Volume() const;
+
+    std::vector<int> Shape() const;
+
+    bool IsEmpty() const;
+};
@@ -10,3 +10,5 @@ double Activation::ReLU::df(double x) const
 {
     return (x >= 0.0) ? 1.0 : 0.0;
 }
+
+template class Activation::ScalarActivationImpl<Activation::ReLU>;
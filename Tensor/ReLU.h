@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class ReLU : public ScalarActivation
+    class ReLU : public ScalarActivationImpl<ReLU>
     {
     public:
         using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<ReLU>;
 };
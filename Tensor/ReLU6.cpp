@@ -10,3 +10,5 @@ double Activation::ReLU6::df(double x) const
 {
     return (x <= 0.0 || x >= 6.0) ? 0.0 : 1.0;
 }
+
+template class Activation::ScalarActivationImpl<Activation::ReLU6>;
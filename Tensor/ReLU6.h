@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class ReLU6 : public ScalarActivation
+    class ReLU6 : public ScalarActivationImpl<ReLU6>
     {
     public:
         using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<ReLU6>;
 };
@@ -13,3 +13,13 @@ double Activation::SELU::df(double x) const
 	double d_elu = Activation::ELU(Activation::SELU::ALPHA).df(x);
 	return (Activation::SELU::LAMBDA * d_elu);
 }
+
+void Activation::SELU::fdf(double x, double& value, double& derivative) const
+{
+	Activation::ELU(Activation::SELU::ALPHA).fdf(x, value, derivative);
+
+	value *= Activation::SELU::LAMBDA;
+	derivative *= Activation::SELU::LAMBDA;
+}
+
+template class Activation::ScalarActivationImpl<Activation::SELU>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class SELU : public ScalarActivation
+    class SELU : public ScalarActivationImpl<SELU>
     {
     private:
         static constexpr double LAMBDA = 1.0507009873554804934193349852946;
@@ -15,8 +15,14 @@ namespace Activation
 
         using ScalarActivation::df;
 
+        using ScalarActivation::fdf;
+
         double f(double x) const override;
 
         double df(double x) const override;
+
+        void fdf(double x, double& value, double& derivative) const override;
     };
+
+    extern template class ScalarActivationImpl<SELU>;
 };
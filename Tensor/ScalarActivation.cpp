@@ -1,5 +1,6 @@
 #include "ScalarActivation.h"
 #include "Tensor.h"
+#include "Utils.h"
 
 
 bool Activation::ScalarActivation::isScalar() const
@@ -9,26 +10,162 @@ bool Activation::ScalarActivation::isScalar() const
 
 Tensor Activation::ScalarActivation::f(const Tensor& tensor) const
 {
-	std::vector<double> activated_data;
-	activated_data.reserve(tensor.Volume());
-
-	for (const double& value : tensor)
+	if (tensor.IsEmpty())
 	{
-		activated_data.push_back(this->f(value));
+		return tensor;
 	}
 
-	return Tensor(tensor.Shape(), activated_data);
+	Tensor result;
+	this->f(tensor, result);
+
+	return result;
 }
 
 Tensor Activation::ScalarActivation::df(const Tensor& tensor) const
 {
-	std::vector<double> activated_data;
-	activated_data.reserve(tensor.Volume());
+	if (tensor.IsEmpty())
+	{
+		return tensor;
+	}
+
+	Tensor result;
+	this->df(tensor, result);
+
+	return result;
+}
+
+void Activation::ScalarActivation::f(const Tensor& tensor, Tensor& output) const
+{
+	if (tensor.IsEmpty())
+	{
+		output = tensor;
+		return;
+	}
+
+	output.Resize(tensor);
 
-	for (const double& value : tensor)
+	const double* input = &*tensor.begin();
+	double* result = &*output.begin();
+
+	// One virtual call per chunk; the chunk itself runs the batch loop.
+	Utils::ParallelFor(0, tensor.Volume(), [&](int begin, int end)
+		{
+			this->f(std::span<const double>(input + begin, end - begin), std::span<double>(result + begin, end - begin));
+		}, Activation::ScalarActivation::GRAIN);
+}
+
+void Activation::ScalarActivation::df(const Tensor& tensor, Tensor& output) const
+{
+	if (tensor.IsEmpty())
+	{
+		output = tensor;
+		return;
+	}
+
+	output.Resize(tensor);
+
+	const double* input = &*tensor.begin();
+	double* result = &*output.begin();
+
+	Utils::ParallelFor(0, tensor.Volume(), [&](int begin, int end)
+		{
+			this->df(std::span<const double>(input + begin, end - begin), std::span<double>(result + begin, end - begin));
+		}, Activation::ScalarActivation::GRAIN);
+}
+
+void Activation::ScalarActivation::fdf(double x, double& value, double& derivative) const
+{
+	value = this->f(x);
+	derivative = this->df(x);
+}
+
+std::pair<Tensor, Tensor> Activation::ScalarActivation::fdf(const Tensor& tensor) const
+{
+	if (tensor.IsEmpty())
+	{
+		return { tensor, tensor };
+	}
+
+	Tensor values(tensor.Shape(), 0.0);
+	Tensor derivatives(tensor.Shape(), 0.0);
+
+	const double* input = &*tensor.begin();
+	double* value = &*values.begin();
+	double* derivative = &*derivatives.begin();
+
+	Utils::ParallelFor(0, tensor.Volume(), [&](int begin, int end)
+		{
+			size_t count = static_cast<size_t>(end - begin);
+
+			this->fdf(std::span<const double>(input + begin, count), std::span<double>(value + begin, count), std::span<double>(derivative + begin, count));
+		}, Activation::ScalarActivation::GRAIN);
+
+	return { std::move(values), std::move(derivatives) };
+}
+
+void Activation::ScalarActivation::f(std::span<const double> input, std::span<double> output) const
+{
+	this->f(input.data(), 1, output.data(), 1, std::min(input.size(), output.size()));
+}
+
+void Activation::ScalarActivation::df(std::span<const double> input, std::span<double> output) const
+{
+	this->df(input.data(), 1, output.data(), 1, std::min(input.size(), output.size()));
+}
+
+void Activation::ScalarActivation::f(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const
+{
+	for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); i++)
+	{
+		output[i * output_stride] = this->f(input[i * input_stride]);
+	}
+}
+
+void Activation::ScalarActivation::df(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const
+{
+	for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); i++)
+	{
+		output[i * output_stride] = this->df(input[i * input_stride]);
+	}
+}
+
+void Activation::ScalarActivation::fdf(std::span<const double> input, std::span<double> values, std::span<double> derivatives) const
+{
+	std::size_t count = std::min({ input.size(), values.size(), derivatives.size() });
+
+	for (std::size_t i = 0; i < count; i++)
+	{
+		this->fdf(input[i], values[i], derivatives[i]);
+	}
+}
+
+// The Jacobian of an elementwise activation is diagonal, so both products
+// reduce to grad * f'(x).
+Tensor Activation::ScalarActivation::VJP(const Tensor& tensor, const Tensor& grad) const
+{
+	if (tensor.Shape() != grad.Shape())
+	{
+		throw std::invalid_argument("[Activation] VJP failed: gradient shape mismatch with input Tensor.");
+	}
+
+	Tensor result = this->df(tensor);
+
+	auto grad_it = grad.begin();
+	for (double& value : result)
+	{
+		value *= *grad_it;
+		++grad_it;
+	}
+
+	return result;
+}
+
+Tensor Activation::ScalarActivation::JVP(const Tensor& tensor, const Tensor& tangent) const
+{
+	if (tensor.Shape() != tangent.Shape())
 	{
-		activated_data.push_back(this->df(value));
+		throw std::invalid_argument("[Activation] JVP failed: tangent shape mismatch with input Tensor.");
 	}
 
-	return Tensor(tensor.Shape(), activated_data);
+	return this->VJP(tensor, tangent);
 }
@@ -2,10 +2,16 @@
 
 #include "BaseActivation.h"
 
+#include <span>
+
 namespace Activation
 {
 	class ScalarActivation : public BaseActivation
 	{
+	protected:
+		// ========== Constants ==========
+		static constexpr int GRAIN = 1 << 16;
+
 	public:
 		bool isScalar() const override;
 
@@ -16,5 +22,132 @@ namespace Activation
 		Tensor f(const Tensor& tensor) const override;
 
 		Tensor df(const Tensor& tensor) const override;
+
+		void f(const Tensor& tensor, Tensor& output) const override;
+
+		void df(const Tensor& tensor, Tensor& output) const override;
+
+		// value = f(x), derivative = f'(x). Activations whose f and df share
+		// transcendental terms override this to compute them once.
+		virtual void fdf(double x, double& value, double& derivative) const;
+
+		std::pair<Tensor, Tensor> fdf(const Tensor& tensor) const override;
+
+		Tensor VJP(const Tensor& tensor, const Tensor& grad) const override;
+
+		Tensor JVP(const Tensor& tensor, const Tensor& tangent) const override;
+
+		// Batch evaluation, output[i] = f(input[i]). input and output must have
+		// the same size and may be the same memory (in-place).
+		virtual void f(std::span<const double> input, std::span<double> output) const;
+
+		virtual void df(std::span<const double> input, std::span<double> output) const;
+
+		// Strided batch evaluation over count elements, e.g. a column or a
+		// non-contiguous slice. Strides are in elements.
+		virtual void f(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const;
+
+		virtual void df(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const;
+
+		virtual void fdf(std::span<const double> input, std::span<double> values, std::span<double> derivatives) const;
+	};
+
+	// CRTP base for concrete scalar activations: the batch overloads call
+	// Derived::f / Derived::df non-virtually, so the per-element function is
+	// inlined into a tight loop the compiler can vectorize. Each activation
+	// explicitly instantiates its base in its own .cpp, next to the
+	// definitions of f and df, and declares it extern in its header.
+	template<typename Derived>
+	class ScalarActivationImpl : public ScalarActivation
+	{
+	public:
+		using ScalarActivation::f;
+
+		using ScalarActivation::df;
+
+		using ScalarActivation::fdf;
+
+		void fdf(double x, double& value, double& derivative) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			value = self.Derived::f(x);
+			derivative = self.Derived::df(x);
+		}
+
+		void f(std::span<const double> input, std::span<double> output) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			const double* in = input.data();
+			double* out = output.data();
+			std::size_t count = std::min(input.size(), output.size());
+
+			for (std::size_t i = 0; i < count; i++)
+			{
+				out[i] = self.Derived::f(in[i]);
+			}
+		}
+
+		void df(std::span<const double> input, std::span<double> output) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			const double* in = input.data();
+			double* out = output.data();
+			std::size_t count = std::min(input.size(), output.size());
+
+			for (std::size_t i = 0; i < count; i++)
+			{
+				out[i] = self.Derived::df(in[i]);
+			}
+		}
+
+		void f(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			if (input_stride == 1 && output_stride == 1)
+			{
+				ScalarActivationImpl::f(std::span<const double>(input, count), std::span<double>(output, count));
+				return;
+			}
+
+			for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); i++)
+			{
+				output[i * output_stride] = self.Derived::f(input[i * input_stride]);
+			}
+		}
+
+		void df(const double* input, std::ptrdiff_t input_stride, double* output, std::ptrdiff_t output_stride, std::size_t count) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			if (input_stride == 1 && output_stride == 1)
+			{
+				ScalarActivationImpl::df(std::span<const double>(input, count), std::span<double>(output, count));
+				return;
+			}
+
+			for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); i++)
+			{
+				output[i * output_stride] = self.Derived::df(input[i * input_stride]);
+			}
+		}
+
+		void fdf(std::span<const double> input, std::span<double> values, std::span<double> derivatives) const override
+		{
+			const Derived& self = static_cast<const Derived&>(*this);
+
+			const double* in = input.data();
+			double* value = values.data();
+			double* derivative = derivatives.data();
+			std::size_t count = std::min({ input.size(), values.size(), derivatives.size() });
+
+			for (std::size_t i = 0; i < count; i++)
+			{
+				self.Derived::fdf(in[i], value[i], derivative[i]);
+			}
+		}
 	};
 };
@@ -1,9 +1,10 @@
 #include "Sigmoid.h"
+#include "FastMath.h"
 
 
 double Activation::Sigmoid::f(double x) const
 {
-    return 1.0 / (1.0 + std::exp(-x));
+    return 1.0 / (1.0 + FastMath::Exp(-x));
 }
 
 double Activation::Sigmoid::df(double x) const
@@ -11,3 +12,13 @@ double Activation::Sigmoid::df(double x) const
     double s = this->f(x);
     return s * (1.0 - s);
 }
+
+void Activation::Sigmoid::fdf(double x, double& value, double& derivative) const
+{
+    double s = this->Sigmoid::f(x);
+
+    value = s;
+    derivative = s * (1.0 - s);
+}
+
+template class Activation::ScalarActivationImpl<Activation::Sigmoid>;
@@ -4,15 +4,21 @@
 
 namespace Activation
 {
-    class Sigmoid : public ScalarActivation
+    class Sigmoid : public ScalarActivationImpl<Sigmoid>
     {
     public:
         using ScalarActivation::f;
 
         using ScalarActivation::df;
 
+        using ScalarActivation::fdf;
+
         double f(double x) const override;
 
         double df(double x) const override;
+
+        void fdf(double x, double& value, double& derivative) const override;
     };
+
+    extern template class ScalarActivationImpl<Sigmoid>;
 };
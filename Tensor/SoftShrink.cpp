@@ -25,3 +25,5 @@ double Activation::SoftShrink::df(double x) const
 {
     return (x > this->threshold) ? 1.0 : ((x < -this->threshold) ? 1.0 : 0.0);
 }
+
+template class Activation::ScalarActivationImpl<Activation::SoftShrink>;
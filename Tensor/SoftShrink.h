@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class SoftShrink : public ScalarActivation
+	class SoftShrink : public ScalarActivationImpl<SoftShrink>
 	{
 	private:
 		double threshold;
@@ -20,4 +20,6 @@ namespace Activation
 
 		double df(double x) const override;
 	};
+
+	extern template class ScalarActivationImpl<SoftShrink>;
 }
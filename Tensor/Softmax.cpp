@@ -11,32 +11,42 @@ Activation::Softmax::Softmax(int axis)
 
 Tensor Activation::Softmax::f(const Tensor& tensor) const
 {
-    if (tensor.IsEmpty())
-    {
-        throw std::runtime_error("[Activation] Softmax failed: empty Tensor.");
-    }
+    TensorActivation::ResolveAxis(tensor, this->axis, "Softmax");
 
-    if (tensor.IsScalar())
-    {
-        throw std::invalid_argument("[Activation] Softmax failed: cannot apply Softmax to scalar. Softmax requires at least 2 elements.");
-    }
+    Tensor output(tensor.Shape(), 0.0);
+    this->f(tensor, output);
 
-    int actual_axis = (this->axis < 0) ? (tensor.Rank() + this->axis) : this->axis;
-
-    if (actual_axis < 0 || actual_axis >= tensor.Rank())
-    {
-        throw std::out_of_range("[Activation] Softmax failed: axis out of range.");
-    }
+    return output;
+}
 
-    Tensor max_vals = tensor.ReduceMax(actual_axis);
-    Tensor shifted = tensor - max_vals.ExpandRank(actual_axis);
-    Tensor exp_vals = Math::Exp(shifted);
-    Tensor sum_exp = exp_vals.ReduceSum(actual_axis);
+// Writes into a preallocated output (reshaped if needed); output may be tensor itself.
+void Activation::Softmax::f(const Tensor& tensor, Tensor& output) const
+{
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "Softmax");
 
-    return exp_vals / sum_exp.ExpandRank(actual_axis);
+    TensorActivation::PrepareOutput(tensor, output);
+    TensorActivation::SoftmaxKernel(&*tensor.begin(), &*output.begin(), layout, false);
 }
 
+// The Jacobian diag(s) - s * s^T is fully determined by s = f(tensor).
 Tensor Activation::Softmax::df(const Tensor& tensor) const
+{
+    return this->f(tensor);
+}
+
+void Activation::Softmax::df(const Tensor& tensor, Tensor& output) const
+{
+    this->f(tensor, output);
+}
+
+std::pair<Tensor, Tensor> Activation::Softmax::fdf(const Tensor& tensor) const
+{
+    Tensor probabilities = this->f(tensor);
+
+    return { probabilities, probabilities };
+}
+
+Tensor Activation::Softmax::Jacobian(const Tensor& tensor) const
 {
     Tensor result = this->f(tensor);
 
@@ -56,7 +66,7 @@ Tensor Activation::Softmax::df(const Tensor& tensor) const
 
     Tensor jacobian = Tensor::MatMul(s1, s2);
 
-    Tensor identity_matrix(LinAlg::Matrix::Identity(size));
+    Tensor identity_matrix = Tensor::View(LinAlg::Matrix::Identity(size));
     Tensor identity_tensor = identity_matrix.Broadcast(jacobian.Shape());
 
     jacobian = (s1 * identity_tensor) - jacobian;
@@ -67,3 +77,14 @@ Tensor Activation::Softmax::df(const Tensor& tensor) const
 
     return jacobian.Transpose(permutation_2);
 }
+
+// s * (grad - <grad, s>) per row; the Jacobian is symmetric so JVP matches.
+Tensor Activation::Softmax::VJP(const Tensor& tensor, const Tensor& grad) const
+{
+    return TensorActivation::Product(this->f(tensor), grad, this->axis, ProductKind::Softmax, "Softmax VJP");
+}
+
+Tensor Activation::Softmax::JVP(const Tensor& tensor, const Tensor& tangent) const
+{
+    return TensorActivation::Product(this->f(tensor), tangent, this->axis, ProductKind::Softmax, "Softmax JVP");
+}
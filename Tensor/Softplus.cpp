@@ -1,5 +1,6 @@
 #include "Softplus.h"
 #include "Sigmoid.h"
+#include "FastMath.h"
 
 
 double Activation::Softplus::f(double x) const
@@ -10,9 +11,9 @@ double Activation::Softplus::f(double x) const
     }
     if (x < -20.0)
     {
-        return std::exp(x);
+        return FastMath::Exp(x);
     }
-    return std::log(1.0 + std::exp(x));
+    return FastMath::Log(1.0 + FastMath::Exp(x));
 }
 
 double Activation::Softplus::df(double x) const
@@ -23,7 +24,31 @@ double Activation::Softplus::df(double x) const
     }
     if (x < -20.0)
     {
-        return std::exp(x);
+        return FastMath::Exp(x);
     }
     return Activation::Sigmoid().f(x);
 }
+
+void Activation::Softplus::fdf(double x, double& value, double& derivative) const
+{
+    if (x > 20.0)
+    {
+        value = x;
+        derivative = 1;
+        return;
+    }
+
+    double e = FastMath::Exp(x);
+
+    if (x < -20.0)
+    {
+        value = e;
+        derivative = e;
+        return;
+    }
+
+    value = FastMath::Log(1.0 + e);
+    derivative = e / (1.0 + e);
+}
+
+template class Activation::ScalarActivationImpl<Activation::Softplus>;
@@ -11,3 +11,5 @@ double Activation::Softsign::df(double x) const
 	double d = 1.0 + std::abs(x);
 	return 1.0 / (d * d);
 }
+
+template class Activation::ScalarActivationImpl<Activation::Softsign>;
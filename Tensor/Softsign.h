@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class Softsign : public ScalarActivation
+    class Softsign : public ScalarActivationImpl<Softsign>
     {
     public:
         using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<Softsign>;
 };
@@ -10,3 +10,5 @@ double Activation::SparsePlus::df(double x) const
 {
 	return (x <= -1.0) ? 0 : ((x >= 1.0) ? 1 : (0.5 * (x + 1.0)));
 }
+
+template class Activation::ScalarActivationImpl<Activation::SparsePlus>;
@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-    class SparsePlus : public ScalarActivation
+    class SparsePlus : public ScalarActivationImpl<SparsePlus>
     {
     public:
         using ScalarActivation::f;
@@ -15,4 +15,6 @@ namespace Activation
 
         double df(double x) const override;
     };
+
+    extern template class ScalarActivationImpl<SparsePlus>;
 };
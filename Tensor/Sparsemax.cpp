@@ -1,152 +1,203 @@
 #include "Sparsemax.h"
 #include "Tensor.h"
+#include "Utils.h"
 
 Activation::Sparsemax::Sparsemax(int axis)
 {
 	this->axis = axis;
 }
 
-std::vector<double> Activation::Sparsemax::__Sparsemax(const std::vector<double>& nums) const
+// Expected-linear threshold search (pivot partition, as in quickselect): tau
+// is the value with sum(max(z - tau, 0)) = 1. Each round splits the range
+// three ways around the pivot; the values >= pivot are accepted wholesale when
+// the pivot lies in the support, otherwise the search narrows to the values
+// > pivot. Either way the whole block equal to the pivot leaves the range, so
+// repeated values cost no extra rounds. values is reordered.
+double Activation::Sparsemax::Threshold(double* values, int n)
 {
-    int n = static_cast<int>(nums.size());
+    int lo = 0;
+    int hi = n;
 
-    std::vector<double> nums_sorted = nums;
-    std::sort(nums_sorted.begin(), nums_sorted.end(), std::greater<double>());
+    double support_sum = 0.0;
+    int support_size = 0;
 
-    std::vector<double> cumsum(n);
-    std::partial_sum(nums_sorted.begin(), nums_sorted.end(), cumsum.begin());
-
-    int k_star = n;
-    for (int k = 1; k <= n; k++)
+    while (lo < hi)
     {
-        double tau_k = (cumsum[k - 1] - 1.0) / k;
-        if ((nums_sorted[k - 1] - tau_k) <= 0.0)
+        // Median of three as pivot.
+        int mid = lo + (hi - lo) / 2;
+        if (values[mid] < values[lo]) std::swap(values[mid], values[lo]);
+        if (values[hi - 1] < values[lo]) std::swap(values[hi - 1], values[lo]);
+        if (values[hi - 1] < values[mid]) std::swap(values[hi - 1], values[mid]);
+
+        double pivot = values[mid];
+
+        // [lo, greater) holds values > pivot, [greater, less) values equal
+        // to it and [less, hi) the rest.
+        int greater = lo;
+        int less = hi;
+        double greater_sum = 0.0;
+
+        for (int i = lo; i < less;)
         {
-            k_star = k - 1;
-            break;
+            if (values[i] > pivot)
+            {
+                greater_sum += values[i];
+                std::swap(values[i], values[greater]);
+                greater++;
+                i++;
+            }
+            else if (values[i] < pivot)
+            {
+                less--;
+                std::swap(values[i], values[less]);
+            }
+            else
+            {
+                i++;
+            }
         }
-    }
 
-    double tau = (cumsum[k_star - 1] - 1.0) / k_star;
+        int block_size = less - lo;
+        double block_sum = greater_sum + (less - greater) * pivot;
 
-    std::vector<double> sparse_prob(n);
-    for (int i = 0; i < n; i++)
-    {
-        sparse_prob[i] = std::max((nums[i] - tau), 0.0);
+        if ((support_sum + block_sum) - (support_size + block_size) * pivot < 1.0)
+        {
+            support_sum += block_sum;
+            support_size += block_size;
+            lo = less;
+        }
+        else
+        {
+            hi = greater;
+        }
     }
 
-    return sparse_prob;
+    return (support_sum - 1.0) / support_size;
 }
 
-Tensor Activation::Sparsemax::f(const Tensor& tensor) const
+// Rows along the axis are read with stride inner, copied into one scratch
+// buffer per thread, and written back as max(z - tau, 0) (or the support
+// mask). Input and output may alias.
+void Activation::Sparsemax::SparsemaxKernel(const double* input, double* output, const AxisLayout& layout, bool mask)
 {
-    if (tensor.IsEmpty())
-    {
-        throw std::runtime_error("[Activation] Sparsemax failed: empty Tensor.");
-    }
+    int n = layout.size;
+    int inner = layout.inner;
+    size_t row_volume = static_cast<size_t>(n) * inner;
 
-    if (tensor.IsScalar())
-    {
-        throw std::invalid_argument("[Activation] Sparsemax failed: cannot apply Sparsemax to scalar. Sparsemax requires at least 2 elements.");
-    }
+    Utils::ParallelFor(0, layout.outer * inner, [&](int begin, int end)
+        {
+            std::vector<double> scratch(n);
 
-    int actual_axis = (this->axis < 0) ? (tensor.Rank() + this->axis) : this->axis;
+            for (int r = begin; r < end; r++)
+            {
+                size_t base = (r / inner) * row_volume + (r % inner);
 
-    if (actual_axis < 0 || actual_axis >= tensor.Rank())
-    {
-        throw std::out_of_range("[Activation] Sparsemax failed: axis out of range.");
-    }
+                const double* x = input + base;
+                double* y = output + base;
 
-    std::vector<int> permutation(tensor.Rank());
-    std::iota(permutation.begin(), permutation.end(), 0);
-    permutation.erase(permutation.begin() + actual_axis);
-    permutation.push_back(actual_axis);
+                for (int k = 0; k < n; k++)
+                {
+                    scratch[k] = x[static_cast<size_t>(k) * inner];
+                }
 
-    Tensor transposed_tensor = tensor.Transpose(permutation);
+                double tau = Activation::Sparsemax::Threshold(scratch.data(), n);
 
-    int len = tensor.Shape()[actual_axis];
-    std::vector<double> nums;
-    nums.reserve(len);
+                for (int k = 0; k < n; k++)
+                {
+                    double value = x[static_cast<size_t>(k) * inner] - tau;
 
-    std::vector<double> activated_data;
-    activated_data.reserve(tensor.Volume());
+                    if (mask)
+                    {
+                        y[static_cast<size_t>(k) * inner] = (value > Activation::Sparsemax::EPSILON) ? 1.0 : 0.0;
+                    }
+                    else
+                    {
+                        y[static_cast<size_t>(k) * inner] = std::max(value, 0.0);
+                    }
+                }
+            }
+        }, std::max(1, 4096 / n));
+}
 
-    for (const double& num : transposed_tensor)
-    {
-        nums.push_back(num);
+Tensor Activation::Sparsemax::f(const Tensor& tensor) const
+{
+    TensorActivation::ResolveAxis(tensor, this->axis, "Sparsemax");
 
-        if (nums.size() == len)
-        {
-            auto result = this->__Sparsemax(nums);
-            activated_data.insert(activated_data.end(), result.begin(), result.end());
-            nums.clear();
-        }
-    }
+    Tensor output(tensor.Shape(), 0.0);
+    this->f(tensor, output);
 
-    Tensor transposed_result(transposed_tensor.Shape(), activated_data);
+    return output;
+}
 
-    permutation.insert((permutation.begin() + actual_axis), (tensor.Rank() - 1));
-    permutation.pop_back();
-    for (int i = actual_axis + 1; i < permutation.size(); i++)
-    {
-        permutation[i]--;
-    }
+// Writes into a preallocated output (reshaped if needed); output may be tensor itself.
+void Activation::Sparsemax::f(const Tensor& tensor, Tensor& output) const
+{
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "Sparsemax");
 
-    return transposed_result.Transpose(permutation);
+    TensorActivation::PrepareOutput(tensor, output);
+    Activation::Sparsemax::SparsemaxKernel(&*tensor.begin(), &*output.begin(), layout, false);
 }
 
+// The Jacobian diag(m) - m * m^T / |S| depends only on the support mask m
+// (1 where the output is positive, 0 elsewhere), which is returned here.
 Tensor Activation::Sparsemax::df(const Tensor& tensor) const
 {
-    if (tensor.IsEmpty())
-    {
-        throw std::runtime_error("[Activation] Sparsemax failed: empty Tensor.");
-    }
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "Sparsemax");
 
-    if (tensor.IsScalar())
-    {
-        throw std::invalid_argument("[Activation] Sparsemax failed: cannot apply Sparsemax to scalar. Sparsemax requires at least 2 elements.");
-    }
+    Tensor support(tensor.Shape(), 0.0);
+    Activation::Sparsemax::SparsemaxKernel(&*tensor.begin(), &*support.begin(), layout, true);
 
-    int actual_axis = (this->axis < 0) ? (tensor.Rank() + this->axis) : this->axis;
+    return support;
+}
+
+void Activation::Sparsemax::df(const Tensor& tensor, Tensor& output) const
+{
+    AxisLayout layout = TensorActivation::ResolveAxis(tensor, this->axis, "Sparsemax");
+
+    TensorActivation::PrepareOutput(tensor, output);
+    Activation::Sparsemax::SparsemaxKernel(&*tensor.begin(), &*output.begin(), layout, true);
+}
+
+std::pair<Tensor, Tensor> Activation::Sparsemax::fdf(const Tensor& tensor) const
+{
+    Tensor values = this->f(tensor);
+    Tensor support = values;
 
-    if (actual_axis < 0 || actual_axis >= tensor.Rank())
+    for (double& value : support)
     {
-        throw std::out_of_range("[Activation] Sparsemax failed: axis out of range.");
+        value = (value > Activation::Sparsemax::EPSILON) ? 1.0 : 0.0;
     }
 
+    return { std::move(values), std::move(support) };
+}
+
+Tensor Activation::Sparsemax::Jacobian(const Tensor& tensor) const
+{
+    Tensor support_tensor = this->df(tensor);
+
+    int actual_axis = (this->axis < 0) ? (tensor.Rank() + this->axis) : this->axis;
+
     std::vector<int> permutation(tensor.Rank());
     std::iota(permutation.begin(), permutation.end(), 0);
     permutation.erase(permutation.begin() + actual_axis);
     permutation.push_back(actual_axis);
 
-    Tensor transposed_tensor = tensor.Transpose(permutation);
+    Tensor transposed_support = support_tensor.Transpose(permutation);
 
     int len = tensor.Shape()[actual_axis];
-    std::vector<double> nums;
-    nums.reserve(len);
+    std::vector<bool> support;
+    support.reserve(len);
 
     std::vector<double> jacobian_data;
+    jacobian_data.reserve(static_cast<size_t>(tensor.Volume()) * len);
 
-    for (const double& num : transposed_tensor)
+    for (const double& flag : transposed_support)
     {
-        nums.push_back(num);
+        support.push_back(flag > 0.5);
 
-        if (nums.size() == len)
+        if (static_cast<int>(support.size()) == len)
         {
-            auto sparse_output = this->__Sparsemax(nums);
-
-            std::vector<bool> support(len, false);
-            int support_size = 0;
-
-            for (int i = 0; i < len; i++)
-            {
-                if (sparse_output[i] > Activation::Sparsemax::EPSILON)
-                {
-                    support[i] = true;
-                    support_size++;
-                }
-            }
-
+            int support_size = static_cast<int>(std::count(support.begin(), support.end(), true));
             double inv_support_size = 1.0 / support_size;
 
             for (int i = 0; i < len; i++)
@@ -162,11 +213,11 @@ Tensor Activation::Sparsemax::df(const Tensor& tensor) const
                 }
             }
 
-            nums.clear();
+            support.clear();
         }
     }
 
-    std::vector<int> jacobian_shape = transposed_tensor.Shape();
+    std::vector<int> jacobian_shape = transposed_support.Shape();
     jacobian_shape.push_back(len);
 
     Tensor jacobian_tensor(jacobian_shape, jacobian_data);
@@ -177,3 +228,15 @@ Tensor Activation::Sparsemax::df(const Tensor& tensor) const
 
     return jacobian_tensor.Transpose(inv_permutation);
 }
+
+// On the support: grad - mean of grad over the support; zero elsewhere.
+// Symmetric, so JVP matches.
+Tensor Activation::Sparsemax::VJP(const Tensor& tensor, const Tensor& grad) const
+{
+    return TensorActivation::Product(this->f(tensor), grad, this->axis, ProductKind::Sparsemax, "Sparsemax VJP");
+}
+
+Tensor Activation::Sparsemax::JVP(const Tensor& tensor, const Tensor& tangent) const
+{
+    return TensorActivation::Product(this->f(tensor), tangent, this->axis, ProductKind::Sparsemax, "Sparsemax JVP");
+}
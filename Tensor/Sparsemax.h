@@ -12,13 +12,27 @@ namespace Activation
 		static constexpr double EPSILON = 1e-10;
 
 	private:
-		std::vector<double> __Sparsemax(const std::vector<double>& nums) const;
+		static double Threshold(double* values, int n);
+
+		static void SparsemaxKernel(const double* input, double* output, const AxisLayout& layout, bool mask);
 
 	public:
 		explicit Sparsemax(int axis = -1);
 
 		Tensor f(const Tensor& tensor) const override;
 
+		void f(const Tensor& tensor, Tensor& output) const override;
+
 		Tensor df(const Tensor& tensor) const override;
+
+		void df(const Tensor& tensor, Tensor& output) const override;
+
+		std::pair<Tensor, Tensor> fdf(const Tensor& tensor) const override;
+
+		Tensor Jacobian(const Tensor& tensor) const override;
+
+		Tensor VJP(const Tensor& tensor, const Tensor& grad) const override;
+
+		Tensor JVP(const Tensor& tensor, const Tensor& tangent) const override;
 	};
 }
@@ -22,3 +22,13 @@ double Activation::SquarePlus::df(double x) const
 	double a = (x * x) + this->smoothness;
 	return (1.0 + (x / std::sqrt(a))) / 2.0;
 }
+
+void Activation::SquarePlus::fdf(double x, double& value, double& derivative) const
+{
+	double root = std::sqrt((x * x) + this->smoothness);
+
+	value = (x + root) / 2.0;
+	derivative = (1.0 + (x / root)) / 2.0;
+}
+
+template class Activation::ScalarActivationImpl<Activation::SquarePlus>;
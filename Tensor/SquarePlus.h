@@ -4,7 +4,7 @@
 
 namespace Activation
 {
-	class SquarePlus : public ScalarActivation
+	class SquarePlus : public ScalarActivationImpl<SquarePlus>
 	{
 	private:
 		double smoothness;
@@ -16,8 +16,14 @@ namespace Activation
 
 		using ScalarActivation::df;
 
+		using ScalarActivation::fdf;
+
 		double f(double x) const override;
 
 		double df(double x) const override;
+
+		void fdf(double x, double& value, double& derivative) const override;
 	};
+
+	extern template class ScalarActivationImpl<SquarePlus>;
 }
@@ -12,3 +12,13 @@ double Activation::Swish::df(double x) const
     double s = Activation::Sigmoid().f(x);
     return s * (1 + x - (x * s));
 }
+
+void Activation::Swish::fdf(double x, double& value, double& derivative) const
+{
+    double s = Activation::Sigmoid().f(x);
+
+    value = x * s;
+    derivative = s * (1 + x - (x * s));
+}
+
+template class Activation::ScalarActivationImpl<Activation::Swish>;
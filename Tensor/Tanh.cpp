@@ -1,13 +1,24 @@
 #include "Tanh.h"
+#include "FastMath.h"
 
 
 double Activation::Tanh::f(double x) const
 {
-    return std::tanh(x);
+    return FastMath::Tanh(x);
 }
 
 double Activation::Tanh::df(double x) const
 {
-    double t = std::tanh(x);
+    double t = FastMath::Tanh(x);
     return 1.0 - (t * t);
 }
+
+void Activation::Tanh::fdf(double x, double& value, double& derivative) const
+{
+    double t = FastMath::Tanh(x);
+
+    value = t;
+    derivative = 1.0 - (t * t);
+}
+
+template class Activation::ScalarActivationImpl<Activation::Tanh>;
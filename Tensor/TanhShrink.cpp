@@ -1,12 +1,23 @@
 #include "TanhShrink.h"
+#include "FastMath.h"
 
 
 double Activation::TanhShrink::f(double x) const
 {
-	return x - std::tanh(x);
+	return x - FastMath::Tanh(x);
 }
 
 double Activation::TanhShrink::df(double x) const
 {
-	return std::tanh(x) * std::tanh(x);
+	return FastMath::Tanh(x) * FastMath::Tanh(x);
 }
+
+void Activation::TanhShrink::fdf(double x, double& value, double& derivative) const
+{
+	double t = FastMath::Tanh(x);
+
+	value = x - t;
+	derivative = t * t;
+}
+
+template class Activation::ScalarActivationImpl<Activation::TanhShrink>;
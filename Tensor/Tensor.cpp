@@ -1,4 +1,5 @@
 #include "Tensor.h"
+#include "Einsum.h"
 
 // ========================================
 // [Private] TensorSlice Helper Methods
@@ -135,6 +136,344 @@ Tensor Tensor::Apply(const std::function<double(double)>& _func) const
 	return Tensor(this->shape, result_data);
 }
 
+bool Tensor::SharesData(const Tensor& _tensor) const
+{
+	return (this->data != nullptr) && (this->data == _tensor.data);
+}
+
+// Sizes _out for a reduction over _axis; the reduced shape is only built
+// when _out does not have it already.
+void Tensor::ResizeReduced(const int& _axis, Tensor& _out) const
+{
+	bool sized = !_out.IsEmpty() && _out.rank == (this->rank - 1)
+		&& std::equal(this->shape.begin(), this->shape.begin() + _axis, _out.shape.begin())
+		&& std::equal(this->shape.begin() + _axis + 1, this->shape.end(), _out.shape.begin() + _axis);
+
+	if (!sized)
+	{
+		std::vector<int> reduced_shape = this->shape;
+		reduced_shape.erase(reduced_shape.begin() + _axis);
+
+		_out.Resize(reduced_shape);
+	}
+}
+
+// ========================================
+// [Private] Sliding Window Helper Method(s)
+// ========================================
+// Flat offset of every window element, in row-major window order, relative
+// to the window origin in a buffer with the given strides.
+void Tensor::WindowOffsets(const std::vector<int>& _window_shape, const std::vector<int>& _strides, std::vector<int>& _offsets)
+{
+	int window_rank = static_cast<int>(_window_shape.size());
+	int window_volume = Utils::ShapeToVolume(_window_shape);
+
+	_offsets.assign(window_volume, 0);
+
+	std::vector<int> index(window_rank, 0);
+	int offset = 0;
+
+	for (int k = 0; k < window_volume; k++)
+	{
+		_offsets[k] = offset;
+
+		for (int d = window_rank - 1; d >= 0; d--)
+		{
+			index[d]++;
+			offset += _strides[d];
+
+			if (index[d] < _window_shape[d])
+			{
+				break;
+			}
+
+			offset -= index[d] * _strides[d];
+			index[d] = 0;
+		}
+	}
+}
+
+void Tensor::Pool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, const PoolKind& _kind, Tensor& _out) const
+{
+	const char* name = (_kind == PoolKind::Max) ? "Max Pooling" : (_kind == PoolKind::Min) ? "Min Pooling" : "Average Pooling";
+	const char* kind = (_kind == PoolKind::Max) ? "max pooling" : (_kind == PoolKind::Min) ? "min pooling" : "average pooling";
+
+	if (!Utils::IsConvolveCompatible(this->shape, _pool_shape))
+	{
+		throw std::invalid_argument(std::string("[Tensor] ") + name + " failed: kernel shape is not compatible with Tensor for " + kind + ".");
+	}
+
+	std::vector<int> broadcasted_pool_shape((this->rank - _pool_shape.size()), 1);
+	broadcasted_pool_shape.insert(broadcasted_pool_shape.end(), _pool_shape.begin(), _pool_shape.end());
+
+	const std::vector<int>& pool_strides = (_strides.empty()) ? broadcasted_pool_shape : _strides;
+
+	if (pool_strides.size() != this->rank)
+	{
+		throw std::invalid_argument(std::string("[Tensor] ") + name + " failed: stride size mismatch with Tensor's rank.");
+	}
+
+	if (!Utils::IsAllPositive(pool_strides))
+	{
+		throw std::invalid_argument(std::string("[Tensor] ") + name + " failed: stride values must be positive.");
+	}
+
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument(std::string("[Tensor] ") + name + " failed: output cannot share storage with the input.");
+	}
+
+	_out.Resize(Utils::ConvolvedFeatureShape(this->shape, broadcasted_pool_shape, pool_strides));
+
+	std::vector<int> window_offsets;
+	Tensor::WindowOffsets(broadcasted_pool_shape, this->strides, window_offsets);
+
+	const double* input = this->data->data() + this->start_point;
+	double* output = _out.data->data() + _out.start_point;
+
+	int pool_volume = static_cast<int>(window_offsets.size());
+
+	// The window origin is walked odometer-style over the output positions.
+	std::vector<int> position(this->rank, 0);
+	int origin = 0;
+
+	for (int i = 0; i < _out.volume; i++)
+	{
+		const double* window = input + origin;
+
+		double value = window[window_offsets[0]];
+		for (int j = 1; j < pool_volume; j++)
+		{
+			double element = window[window_offsets[j]];
+
+			if (_kind == PoolKind::Max)
+			{
+				value = std::max(value, element);
+			}
+			else if (_kind == PoolKind::Min)
+			{
+				value = std::min(value, element);
+			}
+			else
+			{
+				value += element;
+			}
+		}
+
+		output[i] = (_kind == PoolKind::Average) ? (value / pool_volume) : value;
+
+		for (int d = this->rank - 1; d >= 0; d--)
+		{
+			position[d]++;
+			origin += pool_strides[d] * this->strides[d];
+
+			if (position[d] < _out.shape[d])
+			{
+				break;
+			}
+
+			origin -= position[d] * pool_strides[d] * this->strides[d];
+			position[d] = 0;
+		}
+	}
+}
+
+// ========================================
+// [Private] Transpose Helper Method(s)
+// ========================================
+// Reduces a permutation to its minimal form: size-1 axes are dropped, and
+// axes that stay adjacent and in order in the output are fused into one.
+// E.g. shape [2, 3, 4, 5] with permutation {2, 3, 0, 1} becomes a plain 2-D
+// transpose of [6, 20]. The merged permutation follows the same convention
+// (output axis i is merged input axis _merged_permutation[i]).
+void Tensor::MergeTransposeAxes(const std::vector<int>& _shape, const std::vector<int>& _permutation, std::vector<int>& _merged_shape, std::vector<int>& _merged_permutation)
+{
+	int rank = static_cast<int>(_shape.size());
+
+	// Each group is a run [first, last] of input axes, listed in output order.
+	std::vector<std::pair<int, int>> groups;
+
+	for (int i = 0; i < rank; i++)
+	{
+		int axis = _permutation[i];
+
+		if (_shape[axis] == 1)
+		{
+			continue;
+		}
+
+		// Axes between the group's last one and this one are all of size 1.
+		bool adjacent = !groups.empty();
+		for (int a = adjacent ? (groups.back().second + 1) : 0; adjacent && a < axis; a++)
+		{
+			adjacent = (_shape[a] == 1);
+		}
+
+		if (adjacent && axis > groups.back().second)
+		{
+			groups.back().second = axis;
+		}
+		else
+		{
+			groups.push_back({ axis, axis });
+		}
+	}
+
+	int merged_rank = static_cast<int>(groups.size());
+
+	// Input order of the groups is the order of their first axes.
+	std::vector<int> input_order(merged_rank);
+	std::iota(input_order.begin(), input_order.end(), 0);
+	std::sort(input_order.begin(), input_order.end(), [&](int a, int b) { return groups[a].first < groups[b].first; });
+
+	_merged_shape.assign(merged_rank, 1);
+	_merged_permutation.assign(merged_rank, 0);
+
+	for (int k = 0; k < merged_rank; k++)
+	{
+		const auto& group = groups[input_order[k]];
+
+		for (int a = group.first; a <= group.second; a++)
+		{
+			_merged_shape[k] *= _shape[a];
+		}
+
+		_merged_permutation[input_order[k]] = k;
+	}
+}
+
+// _destination[c * _destination_stride + r] = _source[r * _source_stride + c]
+// for r < _rows, c < _columns. Columns are walked in TRANSPOSE_TILE-wide
+// strips so the destination lines of a strip stay in cache, and the inner
+// loop moves 4 x 4 blocks through registers: four rows are read
+// contiguously and written back as four contiguous columns.
+void Tensor::TransposeBlock(const double* _source, double* _destination, const int& _rows, const int& _columns, const int& _source_stride, const int& _destination_stride)
+{
+	for (int c_begin = 0; c_begin < _columns; c_begin += Tensor::TRANSPOSE_TILE)
+	{
+		int c_end = std::min(c_begin + Tensor::TRANSPOSE_TILE, _columns);
+
+		int r = 0;
+		for (; r + 4 <= _rows; r += 4)
+		{
+			const double* s0 = _source + (r * _source_stride);
+			const double* s1 = s0 + _source_stride;
+			const double* s2 = s1 + _source_stride;
+			const double* s3 = s2 + _source_stride;
+
+			int c = c_begin;
+			for (; c + 4 <= c_end; c += 4)
+			{
+				double a00 = s0[c], a01 = s0[c + 1], a02 = s0[c + 2], a03 = s0[c + 3];
+				double a10 = s1[c], a11 = s1[c + 1], a12 = s1[c + 2], a13 = s1[c + 3];
+				double a20 = s2[c], a21 = s2[c + 1], a22 = s2[c + 2], a23 = s2[c + 3];
+				double a30 = s3[c], a31 = s3[c + 1], a32 = s3[c + 2], a33 = s3[c + 3];
+
+				double* d0 = _destination + (c * _destination_stride) + r;
+				double* d1 = d0 + _destination_stride;
+				double* d2 = d1 + _destination_stride;
+				double* d3 = d2 + _destination_stride;
+
+				d0[0] = a00; d0[1] = a10; d0[2] = a20; d0[3] = a30;
+				d1[0] = a01; d1[1] = a11; d1[2] = a21; d1[3] = a31;
+				d2[0] = a02; d2[1] = a12; d2[2] = a22; d2[3] = a32;
+				d3[0] = a03; d3[1] = a13; d3[2] = a23; d3[3] = a33;
+			}
+
+			for (; c < c_end; c++)
+			{
+				double* d = _destination + (c * _destination_stride) + r;
+
+				d[0] = s0[c];
+				d[1] = s1[c];
+				d[2] = s2[c];
+				d[3] = s3[c];
+			}
+		}
+
+		for (; r < _rows; r++)
+		{
+			const double* s = _source + (r * _source_stride);
+
+			for (int c = c_begin; c < c_end; c++)
+			{
+				_destination[(c * _destination_stride) + r] = s[c];
+			}
+		}
+	}
+}
+
+// ========================================
+// [Private] Matrix Product Helper Method(s)
+// ========================================
+// Shared body of the MatMul forms. _shape_1 and _shape_2 are the operands'
+// shapes as matrix stacks (rank >= 2), which lets a vector be read as a
+// single row or column without reshaping it.
+void Tensor::MatrixProduct(const Tensor& _tensor_1, const std::vector<int>& _shape_1, const Tensor& _tensor_2, const std::vector<int>& _shape_2, Tensor& _out, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha, const double& _beta)
+{
+	int rank_1 = static_cast<int>(_shape_1.size());
+	int rank_2 = static_cast<int>(_shape_2.size());
+
+	int rows_1 = _shape_1[rank_1 - 2];
+	int columns_1 = _shape_1[rank_1 - 1];
+	int rows_2 = _shape_2[rank_2 - 2];
+	int columns_2 = _shape_2[rank_2 - 1];
+
+	int rows = _transpose_1 ? columns_1 : rows_1;
+	int inner = _transpose_1 ? rows_1 : columns_1;
+	int inner_2 = _transpose_2 ? columns_2 : rows_2;
+	int columns = _transpose_2 ? rows_2 : columns_2;
+
+	if (inner != inner_2)
+	{
+		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: inner dimensions must match (got "
+			+ std::to_string(inner) + " and " + std::to_string(inner_2) + ").");
+	}
+
+	std::vector<int> batch_shape_1(_shape_1.begin(), _shape_1.end() - 2);
+	std::vector<int> batch_shape_2(_shape_2.begin(), _shape_2.end() - 2);
+
+	std::vector<int> batch_shape = (batch_shape_1 == batch_shape_2) ? batch_shape_1 : Utils::BroadcastShape(batch_shape_1, batch_shape_2);
+
+	std::vector<int> result_shape = batch_shape;
+	result_shape.push_back(rows);
+	result_shape.push_back(columns);
+
+	if (_out.IsEmpty() || _out.shape != result_shape)
+	{
+		if (_beta != 0.0)
+		{
+			throw std::invalid_argument("[Tensor] Matrix Multiplication failed: output must match the product's shape when beta != 0.");
+		}
+
+		_out.Resize(result_shape);
+	}
+
+	// Broadcast batch axes are addressed with stride 0 instead of being
+	// materialized; Gemm then packs a shared operand once for the whole batch.
+	LinAlg::Gemm::Batch batch;
+	batch.shape = batch_shape;
+	batch.a_strides = Utils::BatchStrides(_shape_1, batch_shape);
+	batch.b_strides = Utils::BatchStrides(_shape_2, batch_shape);
+	batch.c_strides = Utils::BatchStrides(result_shape, batch_shape);
+
+	double* output = &*_out.begin();
+
+	LinAlg::Gemm::Multiply({ &*_tensor_1.begin(), rows_1, columns_1, columns_1, 1 }, _transpose_1,
+		{ &*_tensor_2.begin(), rows_2, columns_2, columns_2, 1 }, _transpose_2,
+		{ output, columns, 1 }, batch, _alpha, _beta);
+
+	// As in Matrix::MatMul, round-off residue below the Matrix tolerance is
+	// flushed to zero.
+	for (int i = 0; i < _out.volume; i++)
+	{
+		if (std::abs(output[i]) < LinAlg::Matrix::TOLERANCE)
+		{
+			output[i] = 0.0;
+		}
+	}
+}
+
 // ========================================
 // Tensor Constructors
 // ========================================
@@ -145,7 +484,7 @@ Tensor::Tensor(const std::vector<int>& _shape, const double& _value)
 		throw std::invalid_argument("[Tensor] Constructor failed: invalid value.");
 	}
 
-	if (shape.empty())
+	if (_shape.empty())
 	{
 		this->rank = 0;
 		this->volume = 1;
@@ -244,8 +583,16 @@ Tensor::Tensor(const LinAlg::Matrix& _matrix)
 		return;
 	}
 
-	this->data = std::make_shared<std::vector<double>>(_matrix.GetFlatData());
-	
+	if (_matrix.IsContiguous())
+	{
+		auto start_ptr = _matrix.data.buffer->begin() + _matrix.data.offset;
+		this->data = std::make_shared<std::vector<double>>(start_ptr, start_ptr + _matrix.Volume());
+	}
+	else
+	{
+		this->data = std::make_shared<std::vector<double>>(_matrix.GetFlatData());
+	}
+
 	this->rank = 2;
 	this->volume = _matrix.Volume();
 
@@ -267,12 +614,68 @@ Tensor::Tensor(const Tensor& _tensor)
 	this->start_point = 0;
 	this->end_point = _tensor.volume;
 
+	if (!_tensor.data)
+	{
+		return;
+	}
+
 	auto start_ptr = (*_tensor.data).begin() + _tensor.start_point;
 	auto end_ptr = (*_tensor.data).begin() + _tensor.end_point;
 
 	this->data = std::make_shared<std::vector<double>>(start_ptr, end_ptr);
 }
 
+Tensor::Tensor(Tensor&& _tensor) noexcept
+{
+	this->rank = _tensor.rank;
+	this->volume = _tensor.volume;
+
+	this->shape = std::move(_tensor.shape);
+	this->strides = std::move(_tensor.strides);
+
+	this->start_point = _tensor.start_point;
+	this->end_point = _tensor.end_point;
+
+	this->data = std::move(_tensor.data);
+	this->view_owner = std::move(_tensor.view_owner);
+
+	_tensor.rank = 0;
+	_tensor.volume = 0;
+	_tensor.start_point = 0;
+	_tensor.end_point = 0;
+}
+
+// Rank-2 Tensor sharing the Matrix buffer (no copy). In-place updates made
+// through either object are visible to the other until one of them
+// reallocates (copy, UniqueData, or a shape-changing Matrix method).
+Tensor Tensor::View(const LinAlg::Matrix& _matrix)
+{
+	if (_matrix.IsEmpty())
+	{
+		return Tensor();
+	}
+
+	if (!_matrix.IsContiguous())
+	{
+		return Tensor(_matrix);
+	}
+
+	Tensor result;
+
+	result.rank = 2;
+	result.volume = _matrix.Volume();
+
+	result.shape = { _matrix.Row(), _matrix.Column() };
+	result.strides = { result.shape[1], 1 };
+
+	result.data = _matrix.data.buffer;
+
+	result.start_point = _matrix.data.offset;
+	result.end_point = result.start_point + result.volume;
+
+	return result;
+}
+
 // ========================================
 // Tensor Iterator(s)
 // ========================================
@@ -301,7 +704,7 @@ Tensor::const_iterator Tensor::end() const
 // ========================================
 void Tensor::UniqueData()
 {
-	if (!this->IsEmpty() && this->data.use_count() > 1)
+	if (!this->IsEmpty() && this->IsDataShared())
 	{
 		auto start_ptr = this->data->begin() + this->start_point;
 		auto end_ptr = this->data->begin() + this->end_point;
@@ -313,6 +716,68 @@ void Tensor::UniqueData()
 	}
 }
 
+bool Tensor::IsDataShared() const
+{
+	auto owner = this->view_owner.lock();
+	bool has_views = (owner != nullptr) && (*owner == this->data);
+
+	return this->data.use_count() > (has_views ? 2 : 1);
+}
+
+// ========================================
+// Tensor Output Buffer Method(s)
+// ========================================
+void Tensor::Resize(const std::vector<int>& _shape)
+{
+	if (this->data && !this->IsEmpty() && this->shape == _shape)
+	{
+		return;
+	}
+
+	if (!Utils::IsAllPositive(_shape))
+	{
+		throw std::invalid_argument("[Tensor] Resize failed: all shape dimensions must be > 0.");
+	}
+
+	int new_volume = Utils::ShapeToVolume(_shape);
+
+	// An unshared buffer keeps its capacity, so a Tensor cycling between a
+	// few shapes stops allocating once it has held the largest of them.
+	if (this->data && this->data.use_count() == 1)
+	{
+		this->data->resize(new_volume);
+	}
+	else
+	{
+		this->data = std::make_shared<std::vector<double>>(new_volume, 0.0);
+	}
+
+	this->rank = static_cast<int>(_shape.size());
+	this->volume = new_volume;
+
+	this->shape = _shape;
+	this->strides.resize(this->rank);
+
+	for (int i = this->rank - 1, stride = 1; i >= 0; i--)
+	{
+		this->strides[i] = stride;
+		stride *= _shape[i];
+	}
+
+	this->start_point = 0;
+	this->end_point = this->volume;
+}
+
+void Tensor::Resize(const Tensor& _tensor)
+{
+	if (_tensor.IsEmpty())
+	{
+		throw std::runtime_error("[Tensor] Resize failed: cannot take the shape of an empty Tensor.");
+	}
+
+	this->Resize(_tensor.shape);
+}
+
 // ========================================
 // Tensor Indexing Operator
 // ========================================
@@ -378,13 +843,19 @@ Tensor Tensor::operator=(const Tensor& _tensor)
 	this->shape = _tensor.shape;
 	this->strides = _tensor.strides;
 
+	this->start_point = 0;
+	this->end_point = _tensor.volume;
+
+	if (!_tensor.data)
+	{
+		this->data.reset();
+		return *this;
+	}
+
 	auto start_ptr = _tensor.data->begin() + _tensor.start_point;
 	auto end_ptr = _tensor.data->begin() + _tensor.end_point;
 	this->data = std::make_shared<std::vector<double>>(start_ptr, end_ptr);
 
-	this->start_point = 0;
-	this->end_point = _tensor.volume;
-
 	return *this;
 }
 
@@ -393,376 +864,329 @@ Tensor Tensor::operator=(const Tensor& _tensor)
 // ========================================
 Tensor Tensor::operator+(const double& _value) const
 {
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor.");
-	}
-
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Addition failed: invalid value.");
-	}
-
-	std::vector<double> result_data(this->volume, 0.0);
+	Tensor result;
+	Tensor::Add(*this, _value, result);
 
-	for (int i = this->start_point, j = 0; i < this->end_point; i++, j++)
-	{
-		result_data[j] = (*this->data)[i] + _value;
-	}
-
-	return Tensor(this->shape, result_data);
+	return result;
 }
 
 Tensor Tensor::operator-(const double& _value) const
 {
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor.");
-	}
+	Tensor result;
+	Tensor::Subtract(*this, _value, result);
 
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Subtraction failed: invalid value.");
-	}
-
-	std::vector<double> result_data(this->volume, 0.0);
-
-	for (int i = this->start_point, j = 0; i < this->end_point; i++, j++)
-	{
-		result_data[j] = (*this->data)[i] - _value;
-	}
-
-	return Tensor(this->shape, result_data);
+	return result;
 }
 
 Tensor Tensor::operator*(const double& _value) const
 {
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor.");
-	}
-
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Multiplication failed: invalid value.");
-	}
+	Tensor result;
+	Tensor::Multiply(*this, _value, result);
 
-	std::vector<double> result_data(this->volume, 0.0);
-
-	for (int i = this->start_point, j = 0; i < this->end_point; i++, j++)
-	{
-		result_data[j] = (*this->data)[i] * _value;
-	}
-
-	return Tensor(this->shape, result_data);
+	return result;
 }
 
 Tensor Tensor::operator/(const double& _value) const
 {
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor.");
-	}
-
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Division failed: invalid value.");
-	}
+	Tensor result;
+	Tensor::Divide(*this, _value, result);
 
-	if (std::abs(_value) < std::numeric_limits<double>::epsilon() * this->EPSILON_SCALE)
-	{
-		throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
-	}
+	return result;
+}
 
-	std::vector<double> result_data(this->volume, 0.0);
+Tensor Tensor::operator+(const Tensor& _tensor) const
+{
+	Tensor result;
+	Tensor::Add(*this, _tensor, result);
 
-	for (int i = this->start_point, j = 0; i < this->end_point; i++, j++)
-	{
-		result_data[j] = (*this->data)[i] / _value;
-	}
+	return result;
+}
 
-	return Tensor(this->shape, result_data);
+Tensor Tensor::operator-(const Tensor& _tensor) const
+{
+	Tensor result;
+	Tensor::Subtract(*this, _tensor, result);
+
+	return result;
 }
 
-Tensor Tensor::operator+(const Tensor& _tensor) const
+Tensor Tensor::operator*(const Tensor& _tensor) const
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor(s).");
-	}
+	Tensor result;
+	Tensor::Multiply(*this, _tensor, result);
 
-	if (this->shape != _tensor.shape)
-	{
-		auto t1 = this->Broadcast(_tensor.shape);
-		auto t2 = _tensor.Broadcast(this->shape);
+	return result;
+}
 
-		return (t1 + t2);
-	}
+Tensor Tensor::operator/(const Tensor& _tensor) const
+{
+	Tensor result;
+	Tensor::Divide(*this, _tensor, result);
 
-	std::vector<double> result_data(this->volume, 0.0);
+	return result;
+}
 
-	for (int i = this->start_point, j = _tensor.start_point, k = 0; i < this->end_point && j < _tensor.end_point; i++, j++, k++)
-	{
-		result_data[k] = (*this->data)[i] + (*_tensor.data)[j];
-	}
+void Tensor::operator+=(const double& _value)
+{
+	Tensor::Add(*this, _value, *this);
+}
 
-	return Tensor(this->shape, result_data);
+void Tensor::operator-=(const double& _value)
+{
+	Tensor::Subtract(*this, _value, *this);
 }
 
-Tensor Tensor::operator-(const Tensor& _tensor) const
+void Tensor::operator*=(const double& _value)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor(s).");
-	}
+	Tensor::Multiply(*this, _value, *this);
+}
 
-	if (this->shape != _tensor.shape)
-	{
-		auto t1 = this->Broadcast(_tensor.shape);
-		auto t2 = _tensor.Broadcast(this->shape);
+void Tensor::operator/=(const double& _value)
+{
+	Tensor::Divide(*this, _value, *this);
+}
 
-		return (t1 - t2);
-	}
+void Tensor::operator+=(const Tensor& _tensor)
+{
+	Tensor::Add(*this, _tensor, *this);
+}
 
-	std::vector<double> result_data(this->volume, 0.0);
+void Tensor::operator-=(const Tensor& _tensor)
+{
+	Tensor::Subtract(*this, _tensor, *this);
+}
 
-	for (int i = this->start_point, j = _tensor.start_point, k = 0; i < this->end_point && j < _tensor.end_point; i++, j++, k++)
-	{
-		result_data[k] = (*this->data)[i] - (*_tensor.data)[j];
-	}
+void Tensor::operator*=(const Tensor& _tensor)
+{
+	Tensor::Multiply(*this, _tensor, *this);
+}
 
-	return Tensor(this->shape, result_data);
+void Tensor::operator/=(const Tensor& _tensor)
+{
+	Tensor::Divide(*this, _tensor, *this);
 }
 
-Tensor Tensor::operator*(const Tensor& _tensor) const
+// ========================================
+// Tensor Out-Parameter Arithmetic Method(s)
+// ========================================
+// Equal shapes are combined element by element straight into _out; other
+// shapes go through Broadcast first. Writing into an operand is safe since
+// every element is read before it is written.
+void Tensor::Add(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor(s).");
 	}
 
-	if (this->shape != _tensor.shape)
+	if (_tensor_1.shape != _tensor_2.shape)
 	{
-		auto t1 = this->Broadcast(_tensor.shape);
-		auto t2 = _tensor.Broadcast(this->shape);
+		Tensor t1 = _tensor_1.Broadcast(_tensor_2.shape);
+		Tensor t2 = _tensor_2.Broadcast(_tensor_1.shape);
 
-		return (t1 * t2);
+		Tensor::Add(t1, t2, _out);
+		return;
 	}
 
-	std::vector<double> result_data(this->volume, 0.0);
+	const double* lhs = _tensor_1.data->data() + _tensor_1.start_point;
+	const double* rhs = _tensor_2.data->data() + _tensor_2.start_point;
+
+	_out.Resize(_tensor_1.shape);
+	double* result = _out.data->data() + _out.start_point;
 
-	for (int i = this->start_point, j = _tensor.start_point, k = 0; i < this->end_point && j < _tensor.end_point; i++, j++, k++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		result_data[k] = (*this->data)[i] * (*_tensor.data)[j];
+		result[i] = lhs[i] + rhs[i];
 	}
-
-	return Tensor(this->shape, result_data);
 }
 
-Tensor Tensor::operator/(const Tensor& _tensor) const
+void Tensor::Subtract(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor(s).");
 	}
 
-	if (this->shape != _tensor.shape)
+	if (_tensor_1.shape != _tensor_2.shape)
 	{
-		auto t1 = this->Broadcast(_tensor.shape);
-		auto t2 = _tensor.Broadcast(this->shape);
+		Tensor t1 = _tensor_1.Broadcast(_tensor_2.shape);
+		Tensor t2 = _tensor_2.Broadcast(_tensor_1.shape);
 
-		return (t1 / t2);
+		Tensor::Subtract(t1, t2, _out);
+		return;
 	}
 
-	std::vector<double> result_data(this->volume, 0.0);
+	const double* lhs = _tensor_1.data->data() + _tensor_1.start_point;
+	const double* rhs = _tensor_2.data->data() + _tensor_2.start_point;
 
-	for (int i = this->start_point, j = _tensor.start_point, k = 0; i < this->end_point && j < _tensor.end_point; i++, j++, k++)
+	_out.Resize(_tensor_1.shape);
+	double* result = _out.data->data() + _out.start_point;
+
+	for (int i = 0; i < _out.volume; i++)
 	{
-		if (std::abs((*_tensor.data)[j]) < std::numeric_limits<double>::epsilon() * this->EPSILON_SCALE)
-		{
-			throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
-		}
-		result_data[k] = (*this->data)[i] / (*_tensor.data)[j];
+		result[i] = lhs[i] - rhs[i];
 	}
-
-	return Tensor(this->shape, result_data);
 }
 
-void Tensor::operator+=(const double& _value)
+void Tensor::Multiply(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out)
 {
-	if (this->IsEmpty())
+	if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor.");
+		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor(s).");
 	}
 
-	if (!Utils::IsValidData<double>({ _value }))
+	if (_tensor_1.shape != _tensor_2.shape)
 	{
-		throw std::invalid_argument("[Tensor] Addition failed: invalid value.");
-	}
+		Tensor t1 = _tensor_1.Broadcast(_tensor_2.shape);
+		Tensor t2 = _tensor_2.Broadcast(_tensor_1.shape);
 
-	for (int i = this->start_point; i < this->end_point; i++)
-	{
-		(*this->data)[i] += _value;
+		Tensor::Multiply(t1, t2, _out);
+		return;
 	}
-}
 
-void Tensor::operator-=(const double& _value)
-{
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor.");
-	}
+	const double* lhs = _tensor_1.data->data() + _tensor_1.start_point;
+	const double* rhs = _tensor_2.data->data() + _tensor_2.start_point;
 
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Subtraction failed: invalid value.");
-	}
+	_out.Resize(_tensor_1.shape);
+	double* result = _out.data->data() + _out.start_point;
 
-	for (int i = this->start_point; i < this->end_point; i++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] -= _value;
+		result[i] = lhs[i] * rhs[i];
 	}
 }
 
-void Tensor::operator*=(const double& _value)
+void Tensor::Divide(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out)
 {
-	if (this->IsEmpty())
+	if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor.");
+		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor(s).");
 	}
 
-	if (!Utils::IsValidData<double>({ _value }))
+	if (_tensor_1.shape != _tensor_2.shape)
 	{
-		throw std::invalid_argument("[Tensor] Multiplication failed: invalid value.");
-	}
+		Tensor t1 = _tensor_1.Broadcast(_tensor_2.shape);
+		Tensor t2 = _tensor_2.Broadcast(_tensor_1.shape);
 
-	for (int i = this->start_point; i < this->end_point; i++)
-	{
-		(*this->data)[i] *= _value;
+		Tensor::Divide(t1, t2, _out);
+		return;
 	}
-}
 
-void Tensor::operator/=(const double& _value)
-{
-	if (this->IsEmpty())
-	{
-		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor.");
-	}
+	const double* lhs = _tensor_1.data->data() + _tensor_1.start_point;
+	const double* rhs = _tensor_2.data->data() + _tensor_2.start_point;
 
-	if (!Utils::IsValidData<double>({ _value }))
-	{
-		throw std::invalid_argument("[Tensor] Division failed: invalid value.");
-	}
+	const double limit = std::numeric_limits<double>::epsilon() * Tensor::EPSILON_SCALE;
 
-	if (std::abs(_value) < std::numeric_limits<double>::epsilon() * this->EPSILON_SCALE)
+	// Checked before anything is written, so a failed in-place division
+	// leaves the operand untouched.
+	if (std::any_of(rhs, rhs + _tensor_2.volume, [=](double value) { return std::abs(value) < limit; }))
 	{
 		throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
 	}
 
-	for (int i = this->start_point; i < this->end_point; i++)
+	_out.Resize(_tensor_1.shape);
+	double* result = _out.data->data() + _out.start_point;
+
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] /= _value;
+		result[i] = lhs[i] / rhs[i];
 	}
 }
 
-void Tensor::operator+=(const Tensor& _tensor)
+void Tensor::Add(const Tensor& _tensor, const double& _value, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Addition failed: cannot perform addition on empty Tensor.");
 	}
 
-	if (this->IsScalar() && _tensor.IsScalar())
+	if (!std::isfinite(_value))
 	{
-		(*this->data)[this->start_point] += (*_tensor.data)[_tensor.start_point];
-		return;
+		throw std::invalid_argument("[Tensor] Addition failed: invalid value.");
 	}
 
-	*this = this->Broadcast(_tensor.shape);
-	auto t2 = _tensor.Broadcast(this->shape);
+	const double* source = _tensor.data->data() + _tensor.start_point;
+
+	_out.Resize(_tensor.shape);
+	double* result = _out.data->data() + _out.start_point;
 
-	for (int i = this->start_point, j = _tensor.start_point; i < this->end_point && j < _tensor.end_point; i++, j++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] += (*_tensor.data)[j];
+		result[i] = source[i] + _value;
 	}
 }
 
-void Tensor::operator-=(const Tensor& _tensor)
+void Tensor::Subtract(const Tensor& _tensor, const double& _value, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Subtraction failed: cannot perform subtraction on empty Tensor.");
 	}
 
-	if (this->IsScalar() && _tensor.IsScalar())
+	if (!std::isfinite(_value))
 	{
-		(*this->data)[this->start_point] -= (*_tensor.data)[_tensor.start_point];
-		return;
+		throw std::invalid_argument("[Tensor] Subtraction failed: invalid value.");
 	}
 
-	*this = this->Broadcast(_tensor.shape);
-	auto t2 = _tensor.Broadcast(this->shape);
+	const double* source = _tensor.data->data() + _tensor.start_point;
+
+	_out.Resize(_tensor.shape);
+	double* result = _out.data->data() + _out.start_point;
 
-	for (int i = this->start_point, j = _tensor.start_point; i < this->end_point && j < _tensor.end_point; i++, j++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] -= (*_tensor.data)[j];
+		result[i] = source[i] - _value;
 	}
 }
 
-void Tensor::operator*=(const Tensor& _tensor)
+void Tensor::Multiply(const Tensor& _tensor, const double& _value, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Multiplication failed: cannot perform multiplication on empty Tensor.");
 	}
 
-	if (this->IsScalar() && _tensor.IsScalar())
+	if (!std::isfinite(_value))
 	{
-		(*this->data)[this->start_point] *= (*_tensor.data)[_tensor.start_point];
-		return;
+		throw std::invalid_argument("[Tensor] Multiplication failed: invalid value.");
 	}
 
-	*this = this->Broadcast(_tensor.shape);
-	auto t2 = _tensor.Broadcast(this->shape);
+	const double* source = _tensor.data->data() + _tensor.start_point;
+
+	_out.Resize(_tensor.shape);
+	double* result = _out.data->data() + _out.start_point;
 
-	for (int i = this->start_point, j = _tensor.start_point; i < this->end_point && j < _tensor.end_point; i++, j++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] *= (*_tensor.data)[j];
+		result[i] = source[i] * _value;
 	}
 }
 
-void Tensor::operator/=(const Tensor& _tensor)
+void Tensor::Divide(const Tensor& _tensor, const double& _value, Tensor& _out)
 {
-	if (this->IsEmpty() || _tensor.IsEmpty())
+	if (_tensor.IsEmpty())
 	{
-		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor(s).");
+		throw std::runtime_error("[Tensor] Division failed: cannot perform division on empty Tensor.");
 	}
 
-	if (this->IsScalar() && _tensor.IsScalar())
+	if (!std::isfinite(_value))
 	{
-		if (std::abs((*_tensor.data)[_tensor.start_point]) < std::numeric_limits<double>::epsilon() * this->EPSILON_SCALE)
-		{
-			throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
-		}
-
-		(*this->data)[this->start_point] /= (*_tensor.data)[_tensor.start_point];
-		return;
+		throw std::invalid_argument("[Tensor] Division failed: invalid value.");
 	}
 
-	*this = this->Broadcast(_tensor.shape);
-	auto t2 = _tensor.Broadcast(this->shape);
-
-	for (int i = _tensor.start_point; i < _tensor.end_point; i++)
+	if (std::abs(_value) < std::numeric_limits<double>::epsilon() * Tensor::EPSILON_SCALE)
 	{
-		if (std::abs((*_tensor.data)[i]) < std::numeric_limits<double>::epsilon() * this->EPSILON_SCALE)
-		{
-			throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
-		}
+		throw std::domain_error("[Tensor] Division failed: division by ~zero value detected.");
 	}
 
-	for (int i = this->start_point, j = _tensor.start_point; i < this->end_point && j < _tensor.end_point; i++, j++)
+	const double* source = _tensor.data->data() + _tensor.start_point;
+
+	_out.Resize(_tensor.shape);
+	double* result = _out.data->data() + _out.start_point;
+
+	for (int i = 0; i < _out.volume; i++)
 	{
-		(*this->data)[i] /= (*_tensor.data)[j];
+		result[i] = source[i] / _value;
 	}
 }
 
@@ -1363,9 +1787,23 @@ Tensor Tensor::Broadcast(const std::vector<int>& _shape) const
 }
 
 // ========================================
-// Tensor Transpose Method
+// Tensor Transpose Method(s)
 // ========================================
 Tensor Tensor::Transpose(const std::vector<int>& _permutation) const
+{
+	Tensor result;
+	this->Transpose(_permutation, result);
+
+	return result;
+}
+
+// After merging axes, one of three kernels applies:
+//   - identity: a single copy
+//   - innermost axis unchanged: contiguous runs copied odometer-style
+//   - otherwise: the innermost input axis and the input axis that becomes
+//     innermost form a 2-D tiled transpose, repeated over the other axes
+// Work is split over (outer position, row tile) pairs.
+void Tensor::Transpose(const std::vector<int>& _permutation, Tensor& _out) const
 {
 	if (_permutation.size() != this->rank)
 	{
@@ -1387,103 +1825,152 @@ Tensor Tensor::Transpose(const std::vector<int>& _permutation) const
 		throw std::invalid_argument("[Tensor] Transposing failed: duplicate values found in permutation array.");
 	}
 
-	std::vector<int> transposed_shape = Utils::Permute(this->shape, _permutation);
-	std::vector<double> transposed_data(this->volume);
-
-	for (int i = this->start_point; i < this->end_point; i++)
+	if (this->SharesData(_out))
 	{
-		auto tensor_index = Utils::TensorIndex(this->shape, i);
-		auto transposed_index = Utils::Permute(tensor_index, _permutation);
-
-		int flat_index = Utils::FlatIndex(transposed_shape, transposed_index);
-		transposed_data[flat_index] = (*this->data)[i];
+		throw std::invalid_argument("[Tensor] Transposing failed: output cannot share storage with the Tensor.");
 	}
 
-	return Tensor(transposed_shape, transposed_data);
-}
-
-// ========================================
-// Tensor Dot Product Method(s)
-// ========================================
-Tensor Tensor::MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2)
-{
-	if (_tensor_1.rank == 0 || _tensor_2.rank == 0)
+	if (this->IsEmpty())
 	{
-		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: rank of Tensor(s) must be > 0.");
+		_out.Clear();
+		return;
 	}
 
-	Tensor tensor_1 = _tensor_1;
-	Tensor tensor_2 = _tensor_2;
+	_out.Resize(Utils::Permute(this->shape, _permutation));
 
-	if (tensor_1.rank == 1)
-	{
-		tensor_1 = tensor_1.ExpandRank(0);
-	}
+	const double* source = this->data->data() + this->start_point;
+	double* destination = _out.data->data() + _out.start_point;
 
-	if (tensor_2.rank == 1)
-	{
-		tensor_2 = tensor_2.ExpandRank(tensor_2.rank);
-	}
+	std::vector<int> merged_shape;
+	std::vector<int> merged_permutation;
+	Tensor::MergeTransposeAxes(this->shape, _permutation, merged_shape, merged_permutation);
 
-	std::vector<int> batch_shape_1(tensor_1.shape.begin(), (tensor_1.shape.end() - 2));
-	std::vector<int> batch_shape_2(tensor_2.shape.begin(), (tensor_2.shape.end() - 2));
-	std::vector<int> matrix_shape_1((tensor_1.shape.end() - 2), tensor_1.shape.end());
-	std::vector<int> matrix_shape_2((tensor_2.shape.end() - 2), tensor_2.shape.end());
+	int merged_rank = static_cast<int>(merged_shape.size());
 
-	if (matrix_shape_1[1] != matrix_shape_2[0])
+	if (merged_rank <= 1)
 	{
-		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: inner dimensions must match (got "
-			+ std::to_string(matrix_shape_1[1]) + " and " + std::to_string(matrix_shape_2[0]) + ").");
+		std::copy(source, source + this->volume, destination);
+		return;
 	}
 
-	std::vector<int> batch_shape = Utils::BroadcastShape(batch_shape_1, batch_shape_2);
+	std::vector<int> source_strides = Utils::ShapeToStrides(merged_shape);
+	std::vector<int> output_shape = Utils::Permute(merged_shape, merged_permutation);
+	std::vector<int> output_strides = Utils::ShapeToStrides(output_shape);
 
-	std::vector<int> new_shape_1 = batch_shape;
-	new_shape_1.insert(new_shape_1.end(), matrix_shape_1.begin(), matrix_shape_1.end());
+	// Output axes other than the ones handled by the kernel, in output order.
+	std::vector<int> outer_axes;
+	int rows = 1;
+	int columns = 1;
+	int row_stride = 0;
+	int column_stride = 0;
 
-	std::vector<int> new_shape_2 = batch_shape;
-	new_shape_2.insert(new_shape_2.end(), matrix_shape_2.begin(), matrix_shape_2.end());
+	bool contiguous_runs = (merged_permutation.back() == merged_rank - 1);
 
-	if (tensor_1.shape != new_shape_1)
+	if (contiguous_runs)
 	{
-		tensor_1 = tensor_1.Broadcast(new_shape_1);
+		columns = merged_shape.back();
+
+		for (int i = 0; i < merged_rank - 1; i++)
+		{
+			outer_axes.push_back(i);
+		}
 	}
-	if (tensor_2.shape != new_shape_2)
+	else
 	{
-		tensor_2 = tensor_2.Broadcast(new_shape_2);
+		int row_axis = merged_permutation.back();
+		int column_output_axis = static_cast<int>(std::find(merged_permutation.begin(), merged_permutation.end(), merged_rank - 1) - merged_permutation.begin());
+
+		rows = merged_shape[row_axis];
+		columns = merged_shape.back();
+		row_stride = source_strides[row_axis];
+		column_stride = output_strides[column_output_axis];
+
+		for (int i = 0; i < merged_rank - 1; i++)
+		{
+			if (i != column_output_axis)
+			{
+				outer_axes.push_back(i);
+			}
+		}
 	}
 
-	int mat_volume_1 = Utils::ShapeToVolume(matrix_shape_1);
-	int mat_volume_2 = Utils::ShapeToVolume(matrix_shape_2);
+	int outer_volume = this->volume / (rows * columns);
+	int row_tiles = (rows + Tensor::TRANSPOSE_TILE - 1) / Tensor::TRANSPOSE_TILE;
+	int tile_volume = std::min(rows, Tensor::TRANSPOSE_TILE) * columns;
 
-	std::vector<int> result_shape = batch_shape;
-	result_shape.push_back(matrix_shape_1[0]);
-	result_shape.push_back(matrix_shape_2[1]);
+	Utils::ParallelFor(0, outer_volume * row_tiles, [&](int begin, int end)
+		{
+			for (int task = begin; task < end; task++)
+			{
+				int outer_index = task / row_tiles;
+				int row_begin = (task % row_tiles) * Tensor::TRANSPOSE_TILE;
 
-	std::vector<double> result_data;
-	result_data.reserve(Utils::ShapeToVolume(result_shape));
+				int source_offset = 0;
+				int destination_offset = 0;
 
-	for (int i = tensor_1.start_point, j = tensor_2.start_point; i < tensor_1.end_point && j < tensor_2.end_point; i += mat_volume_1, j += mat_volume_2)
-	{
-		auto start_ptr_1 = (tensor_1.data)->begin() + i;
-		auto end_ptr_1 = start_ptr_1 + mat_volume_1;
+				for (int k = static_cast<int>(outer_axes.size()) - 1; k >= 0; k--)
+				{
+					int axis = outer_axes[k];
+					int position = outer_index % output_shape[axis];
+					outer_index /= output_shape[axis];
+
+					source_offset += position * source_strides[merged_permutation[axis]];
+					destination_offset += position * output_strides[axis];
+				}
+
+				if (contiguous_runs)
+				{
+					std::copy(source + source_offset, source + source_offset + columns, destination + destination_offset);
+				}
+				else
+				{
+					int row_count = std::min(Tensor::TRANSPOSE_TILE, rows - row_begin);
 
-		auto start_ptr_2 = (tensor_2.data)->begin() + j;
-		auto end_ptr_2 = start_ptr_2 + mat_volume_2;
+					Tensor::TransposeBlock(source + source_offset + (row_begin * row_stride), destination + destination_offset + row_begin,
+						row_count, columns, row_stride, column_stride);
+				}
+			}
+		}, std::max(1, Tensor::TRANSPOSE_GRAIN / tile_volume));
+}
+
+// ========================================
+// Tensor Dot Product Method(s)
+// ========================================
+Tensor Tensor::MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2)
+{
+	Tensor result;
+	Tensor::MatMul(_tensor_1, _tensor_2, result);
+
+	return result;
+}
+
+void Tensor::MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out)
+{
+	if (_tensor_1.rank == 0 || _tensor_2.rank == 0)
+	{
+		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: rank of Tensor(s) must be > 0.");
+	}
 
-		std::vector<double> data_1(start_ptr_1, end_ptr_1);
-		std::vector<double> data_2(start_ptr_2, end_ptr_2);
+	if (_tensor_1.SharesData(_out) || _tensor_2.SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: output cannot share storage with an operand.");
+	}
 
-		LinAlg::Matrix matrix_1({ matrix_shape_1[0], matrix_shape_1[1] }, data_1);
-		LinAlg::Matrix matrix_2({ matrix_shape_2[0], matrix_shape_2[1] }, data_2);
+	// A vector is read in place as a single row (left) or column (right).
+	std::vector<int> shape_1 = _tensor_1.shape;
+	std::vector<int> shape_2 = _tensor_2.shape;
 
-		LinAlg::Matrix result_matrix = LinAlg::Matrix::MatMul(matrix_1, matrix_2);
+	if (_tensor_1.rank == 1)
+	{
+		shape_1.insert(shape_1.begin(), 1);
+	}
 
-		std::vector<double> data_vec = result_matrix.GetFlatData();
-		result_data.insert(result_data.end(), data_vec.begin(), data_vec.end());
+	if (_tensor_2.rank == 1)
+	{
+		shape_2.push_back(1);
 	}
 
-	return Tensor(result_shape, result_data);
+	Tensor::MatrixProduct(_tensor_1, shape_1, _tensor_2, shape_2, _out, false, false, 1.0, 0.0);
 }
 
 Tensor Tensor::MatMul(const Tensor& _tensor) const
@@ -1491,6 +1978,21 @@ Tensor Tensor::MatMul(const Tensor& _tensor) const
 	return Tensor::MatMul(*this, _tensor);
 }
 
+void Tensor::MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha, const double& _beta)
+{
+	if (_tensor_1.rank < 2 || _tensor_2.rank < 2)
+	{
+		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: transposed operands must be of rank >= 2.");
+	}
+
+	if (_tensor_1.SharesData(_out) || _tensor_2.SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Matrix Multiplication failed: output cannot share storage with an operand.");
+	}
+
+	Tensor::MatrixProduct(_tensor_1, _tensor_1.shape, _tensor_2, _tensor_2.shape, _out, _transpose_1, _transpose_2, _alpha, _beta);
+}
+
 Tensor Tensor::TensorDot(const Tensor& _tensor_1, const Tensor& _tensor_2, const std::vector<int>& _contract_axes_1, const std::vector<int>& _contract_axes_2)
 {
 	if (!Utils::IsBounded(_contract_axes_1, _tensor_1.rank, -1, true))
@@ -1546,27 +2048,113 @@ Tensor Tensor::TensorDot(const Tensor& _tensor_1, const Tensor& _tensor_2, const
 	int batch_1 = _tensor_1.volume / contract_volume_1;
 	int batch_2 = _tensor_2.volume / contract_volume_2;
 
-	Tensor tensor_1 = _tensor_1.Transpose(permutation_1).Reshape({ batch_1, contract_volume_1 });
-	Tensor tensor_2 = _tensor_2.Transpose(permutation_2).Reshape({ contract_volume_2, batch_2 });
-
-	Tensor dot_product = Tensor::MatMul(tensor_1, tensor_2);
-
 	auto shape_1 = Utils::Permute(_tensor_1.shape, permutation_1);
 	auto shape_2 = Utils::Permute(_tensor_2.shape, permutation_2);
 
-	std::vector<int> tensordot_shape;
-	tensordot_shape.insert(tensordot_shape.end(), shape_1.begin(), (shape_1.end() - _contract_axes_1.size()));
-	tensordot_shape.insert(tensordot_shape.end(), (shape_2.begin() + _contract_axes_2.size()), shape_2.end());
+	std::vector<int> tensordot_shape;
+	tensordot_shape.insert(tensordot_shape.end(), shape_1.begin(), (shape_1.end() - _contract_axes_1.size()));
+	tensordot_shape.insert(tensordot_shape.end(), (shape_2.begin() + _contract_axes_2.size()), shape_2.end());
+
+	// Each operand is used in place as a [free, contracted] or [contracted,
+	// free] matrix (with a transpose flag) when its contracted axes are its
+	// trailing or leading axes in order; only other layouts are transposed.
+	int n_contract = static_cast<int>(_contract_axes_1.size());
+
+	auto in_order = [](const std::vector<int>& _axes, const int& _first)
+		{
+			for (size_t i = 0; i < _axes.size(); i++)
+			{
+				if (_axes[i] != _first + static_cast<int>(i))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+	Tensor transposed_1;
+	Tensor transposed_2;
+
+	const Tensor* tensor_1 = &_tensor_1;
+	const Tensor* tensor_2 = &_tensor_2;
+
+	bool transpose_1 = false;
+	bool transpose_2 = false;
+
+	if (in_order(_contract_axes_1, _tensor_1.rank - n_contract))
+	{
+		transpose_1 = false;
+	}
+	else if (in_order(_contract_axes_1, 0))
+	{
+		transpose_1 = true;
+	}
+	else
+	{
+		_tensor_1.Transpose(permutation_1, transposed_1);
+		tensor_1 = &transposed_1;
+	}
+
+	if (in_order(_contract_axes_2, 0))
+	{
+		transpose_2 = false;
+	}
+	else if (in_order(_contract_axes_2, _tensor_2.rank - n_contract))
+	{
+		transpose_2 = true;
+	}
+	else
+	{
+		_tensor_2.Transpose(permutation_2, transposed_2);
+		tensor_2 = &transposed_2;
+	}
+
+	LinAlg::Matrix matrix_1(tensor_1->data, tensor_1->start_point,
+		transpose_1 ? std::make_pair(contract_volume_1, batch_1) : std::make_pair(batch_1, contract_volume_1), transpose_1 ? batch_1 : contract_volume_1);
+	LinAlg::Matrix matrix_2(tensor_2->data, tensor_2->start_point,
+		transpose_2 ? std::make_pair(batch_2, contract_volume_2) : std::make_pair(contract_volume_2, batch_2), transpose_2 ? contract_volume_2 : batch_2);
+
+	Tensor result(tensordot_shape, 0.0);
+	LinAlg::Matrix result_view(result.data, result.start_point, { batch_1, batch_2 }, batch_2);
 
-	Tensor result = dot_product.Reshape(tensordot_shape);
+	LinAlg::Matrix::MatMul(matrix_1, matrix_2, result_view, transpose_1, transpose_2);
 
 	return result;
 }
 
+// ========================================
+// Tensor Einsum Method(s)
+// ========================================
+Tensor Tensor::Einsum(const std::string& _equation, const std::vector<Tensor>& _operands)
+{
+	std::vector<const Tensor*> operands;
+	for (const Tensor& operand : _operands)
+	{
+		operands.push_back(&operand);
+	}
+
+	return ::Einsum::Evaluate(_equation, operands);
+}
+
+Tensor Tensor::Einsum(const std::string& _equation, const std::vector<const Tensor*>& _operands)
+{
+	return ::Einsum::Evaluate(_equation, _operands);
+}
 // ========================================
 // Tensor Convolution Method(s)
 // ========================================
 Tensor Tensor::Convolve(const Tensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding)
+{
+	Tensor result;
+	this->Convolve(_filter, _strides, _padding, result);
+
+	return result;
+}
+
+// Zero padding is virtual: windows that overlap the border skip the
+// out-of-range elements instead of reading from a padded copy.
+void Tensor::Convolve(const Tensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, Tensor& _out) const
 {
 	if (_strides.size() != this->rank)
 	{
@@ -1600,195 +2188,137 @@ Tensor Tensor::Convolve(const Tensor& _filter, const std::vector<int>& _strides,
 		throw std::overflow_error("[Tensor] Convolution failed: shape too large, potential overflow.");
 	}
 
-	Tensor padded_tensor = *this;
-	for (int i = 0; i < this->rank; i++)
-	{
-		padded_tensor = padded_tensor.Pad(i, _padding[i], _padding[i], 0.0);
-	}
-
-	if (!Utils::IsConvolveCompatible(padded_tensor.shape, _filter.shape))
+	if (!Utils::IsConvolveCompatible(padded_shape, _filter.shape))
 	{
 		throw std::invalid_argument("[Tensor] Convolution failed: kernel shape is not compatible with Tensor for convolution.");
 	}
 
-	std::vector<int> broadcasted_shape((padded_tensor.rank - _filter.rank), 1);
-	broadcasted_shape.insert(broadcasted_shape.end(), _filter.shape.begin(), _filter.shape.end());
-
-	Tensor broadcasted_filter = _filter.Reshape(broadcasted_shape);
-
-	auto convolved_shape = Utils::ConvolvedFeatureShape(padded_tensor.shape, broadcasted_filter.shape, _strides);
-	int convolved_volume = Utils::ShapeToVolume(convolved_shape);
-
-	std::vector<double> convolved_data(convolved_volume, 0.0);
-
-	for (int i = 0; i < convolved_volume; i++)
-	{
-		double sum = 0.0;
-		auto cnv_tensor_index = Utils::TensorIndex(convolved_shape, i);
-
-		for (int k = broadcasted_filter.start_point; k < broadcasted_filter.end_point; k++)
-		{
-			auto filter_index = Utils::TensorIndex(broadcasted_filter.shape, (k - broadcasted_filter.start_point));
-			auto main_tensor_index = Utils::ScaleNShift(cnv_tensor_index, _strides, filter_index);
-
-			int flat_index = Utils::FlatIndex(padded_tensor.shape, main_tensor_index) + padded_tensor.start_point;
-			sum += ((*padded_tensor.data)[flat_index] * (*broadcasted_filter.data)[k]);
-		}
-
-		convolved_data[i] = sum;
-	}
-
-	return Tensor(convolved_shape, convolved_data);
-}
-
-// ========================================
-// Tensor Pooling Method(s)
-// ========================================
-Tensor Tensor::MaxPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
-{
-	if (!Utils::IsConvolveCompatible(this->shape, _pool_shape))
+	if (this->SharesData(_out) || _filter.SharesData(_out))
 	{
-		throw std::invalid_argument("[Tensor] Max Pooling failed: kernel shape is not compatible with Tensor for max pooling.");
+		throw std::invalid_argument("[Tensor] Convolution failed: output cannot share storage with the input or the kernel.");
 	}
 
-	std::vector<int> broadcasted_pool_shape((this->rank - _pool_shape.size()), 1);
-	broadcasted_pool_shape.insert(broadcasted_pool_shape.end(), _pool_shape.begin(), _pool_shape.end());
+	std::vector<int> filter_shape((this->rank - _filter.rank), 1);
+	filter_shape.insert(filter_shape.end(), _filter.shape.begin(), _filter.shape.end());
 
-	std::vector<int> pool_strides = (_strides.empty()) ? broadcasted_pool_shape : _strides;
-
-	if (pool_strides.size() != this->rank)
-	{
-		throw std::invalid_argument("[Tensor] Max Pooling failed: stride size mismatch with Tensor's rank.");
-	}
+	_out.Resize(Utils::ConvolvedFeatureShape(padded_shape, filter_shape, _strides));
 
-	if (!Utils::IsAllPositive(pool_strides))
-	{
-		throw std::invalid_argument("[Tensor] Max Pooling failed: stride values must be positive.");
-	}
+	std::vector<int> window_offsets;
+	Tensor::WindowOffsets(filter_shape, this->strides, window_offsets);
 
-	auto pool_volume = Utils::ShapeToVolume(broadcasted_pool_shape);
+	const double* input = this->data->data() + this->start_point;
+	const double* filter = _filter.data->data() + _filter.start_point;
+	double* output = _out.data->data() + _out.start_point;
 
-	auto feature_shape = Utils::ConvolvedFeatureShape(this->shape, broadcasted_pool_shape, pool_strides);
-	int feature_volume = Utils::ShapeToVolume(feature_shape);
+	int filter_volume = static_cast<int>(window_offsets.size());
 
-	std::vector<double> feature_data(feature_volume, 0.0);
+	std::vector<int> position(this->rank, 0);
+	std::vector<int> window_index(this->rank, 0);
 
-	for (int i = 0; i < feature_volume; i++)
+	for (int i = 0; i < _out.volume; i++)
 	{
-		double max_value = std::numeric_limits<double>::lowest();
-		auto feature_tensor_index = Utils::TensorIndex(feature_shape, i);
+		bool interior = true;
+		int origin = 0;
 
-		for (int j = 0; j < pool_volume; j++)
+		for (int d = 0; d < this->rank; d++)
 		{
-			auto pool_index = Utils::TensorIndex(broadcasted_pool_shape, j);
-			auto main_tensor_index = Utils::ScaleNShift(feature_tensor_index, pool_strides, pool_index);
+			int start = (position[d] * _strides[d]) - _padding[d];
 
-			int flat_index = Utils::FlatIndex(this->shape, main_tensor_index) + this->start_point;
-			max_value = std::max(max_value, (*this->data)[flat_index]);
+			interior = interior && (start >= 0) && (start + filter_shape[d] <= this->shape[d]);
+			origin += start * this->strides[d];
 		}
 
-		feature_data[i] = max_value;
-	}
-
-	return Tensor(feature_shape, feature_data);
-}
-
-Tensor Tensor::MinPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
-{
-	if (!Utils::IsConvolveCompatible(this->shape, _pool_shape))
-	{
-		throw std::invalid_argument("[Tensor] Min Pooling failed: kernel shape is not compatible with Tensor for min pooling.");
-	}
-
-	std::vector<int> broadcasted_pool_shape((this->rank - _pool_shape.size()), 1);
-	broadcasted_pool_shape.insert(broadcasted_pool_shape.end(), _pool_shape.begin(), _pool_shape.end());
-
-	std::vector<int> pool_strides = (_strides.empty()) ? broadcasted_pool_shape : _strides;
-
-	if (pool_strides.size() != this->rank)
-	{
-		throw std::invalid_argument("[Tensor] Max Pooling failed: stride size mismatch with Tensor's rank.");
-	}
+		double sum = 0.0;
 
-	if (!Utils::IsAllPositive(pool_strides))
-	{
-		throw std::invalid_argument("[Tensor] Min Pooling failed: stride values must be positive.");
-	}
+		if (interior)
+		{
+			for (int k = 0; k < filter_volume; k++)
+			{
+				sum += (input[origin + window_offsets[k]] * filter[k]);
+			}
+		}
+		else
+		{
+			std::fill(window_index.begin(), window_index.end(), 0);
 
-	auto pool_volume = Utils::ShapeToVolume(broadcasted_pool_shape);
+			for (int k = 0; k < filter_volume; k++)
+			{
+				bool inside = true;
+				for (int d = 0; d < this->rank; d++)
+				{
+					int coordinate = (position[d] * _strides[d]) - _padding[d] + window_index[d];
+					inside = inside && (coordinate >= 0) && (coordinate < this->shape[d]);
+				}
 
-	auto feature_shape = Utils::ConvolvedFeatureShape(this->shape, broadcasted_pool_shape, pool_strides);
-	int feature_volume = Utils::ShapeToVolume(feature_shape);
+				if (inside)
+				{
+					sum += (input[origin + window_offsets[k]] * filter[k]);
+				}
 
-	std::vector<double> feature_data(feature_volume, 0.0);
+				for (int d = this->rank - 1; d >= 0; d--)
+				{
+					if (++window_index[d] < filter_shape[d])
+					{
+						break;
+					}
+					window_index[d] = 0;
+				}
+			}
+		}
 
-	for (int i = 0; i < feature_volume; i++)
-	{
-		double min_value = std::numeric_limits<double>::max();
-		auto feature_tensor_index = Utils::TensorIndex(feature_shape, i);
+		output[i] = sum;
 
-		for (int j = 0; j < pool_volume; j++)
+		for (int d = this->rank - 1; d >= 0; d--)
 		{
-			auto pool_index = Utils::TensorIndex(broadcasted_pool_shape, j);
-			auto main_tensor_index = Utils::ScaleNShift(feature_tensor_index, pool_strides, pool_index);
-
-			int flat_index = Utils::FlatIndex(this->shape, main_tensor_index) + this->start_point;
-			min_value = std::min(min_value, (*this->data)[flat_index]);
+			if (++position[d] < _out.shape[d])
+			{
+				break;
+			}
+			position[d] = 0;
 		}
-
-		feature_data[i] = min_value;
 	}
-
-	return Tensor(feature_shape, feature_data);
 }
 
-Tensor Tensor::AvgPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
+// ========================================
+// Tensor Pooling Method(s)
+// ========================================
+Tensor Tensor::MaxPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
 {
-	if (!Utils::IsConvolveCompatible(this->shape, _pool_shape))
-	{
-		throw std::invalid_argument("[Tensor] Average Pooling failed: kernel shape is not compatible with Tensor for average pooling.");
-	}
-
-	std::vector<int> broadcasted_pool_shape((this->rank - _pool_shape.size()), 1);
-	broadcasted_pool_shape.insert(broadcasted_pool_shape.end(), _pool_shape.begin(), _pool_shape.end());
-
-	std::vector<int> pool_strides = (_strides.empty()) ? broadcasted_pool_shape : _strides;
-
-	if (pool_strides.size() != this->rank)
-	{
-		throw std::invalid_argument("[Tensor] Average Pooling failed: stride size mismatch with Tensor's rank.");
-	}
-
-	if (!Utils::IsAllPositive(pool_strides))
-	{
-		throw std::invalid_argument("[Tensor] Average Pooling failed: stride values must be positive.");
-	}
+	Tensor result;
+	this->Pool(_pool_shape, _strides, PoolKind::Max, result);
 
-	auto pool_volume = Utils::ShapeToVolume(broadcasted_pool_shape);
+	return result;
+}
 
-	auto feature_shape = Utils::ConvolvedFeatureShape(this->shape, broadcasted_pool_shape, pool_strides);
-	int feature_volume = Utils::ShapeToVolume(feature_shape);
+Tensor Tensor::MinPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
+{
+	Tensor result;
+	this->Pool(_pool_shape, _strides, PoolKind::Min, result);
 
-	std::vector<double> feature_data(feature_volume, 0.0);
+	return result;
+}
 
-	for (int i = 0; i < feature_volume; i++)
-	{
-		double avg_value = 0;
-		auto feature_tensor_index = Utils::TensorIndex(feature_shape, i);
+Tensor Tensor::AvgPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides)
+{
+	Tensor result;
+	this->Pool(_pool_shape, _strides, PoolKind::Average, result);
 
-		for (int j = 0; j < pool_volume; j++)
-		{
-			auto pool_index = Utils::TensorIndex(broadcasted_pool_shape, j);
-			auto main_tensor_index = Utils::ScaleNShift(feature_tensor_index, pool_strides, pool_index);
+	return result;
+}
 
-			int flat_index = Utils::FlatIndex(this->shape, main_tensor_index) + this->start_point;
-			avg_value += (*this->data)[flat_index];
-		}
+void Tensor::MaxPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const
+{
+	this->Pool(_pool_shape, _strides, PoolKind::Max, _out);
+}
 
-		feature_data[i] = avg_value / pool_volume;
-	}
+void Tensor::MinPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const
+{
+	this->Pool(_pool_shape, _strides, PoolKind::Min, _out);
+}
 
-	return Tensor(feature_shape, feature_data);
+void Tensor::AvgPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const
+{
+	this->Pool(_pool_shape, _strides, PoolKind::Average, _out);
 }
 
 // ========================================
@@ -1823,6 +2353,49 @@ Tensor Tensor::Sign(const bool& _heaviside) const
 // Tensor Statistical Method(s)
 // ========================================
 Tensor Tensor::ReduceSum(const int& _axis) const
+{
+	Tensor result;
+	this->ReduceSum(_axis, result);
+
+	return result;
+}
+
+Tensor Tensor::ReduceMean(const int& _axis) const
+{
+	Tensor result;
+	this->ReduceMean(_axis, result);
+
+	return result;
+}
+
+Tensor Tensor::ReduceVar(const int& _axis, const bool& _inference) const
+{
+	Tensor result;
+	this->ReduceVar(_axis, _inference, result);
+
+	return result;
+}
+
+Tensor Tensor::ReduceMax(const int& _axis) const
+{
+	Tensor result;
+	this->ReduceMax(_axis, result);
+
+	return result;
+}
+
+Tensor Tensor::ReduceMin(const int& _axis) const
+{
+	Tensor result;
+	this->ReduceMin(_axis, result);
+
+	return result;
+}
+
+// The out-parameter reductions view the Tensor as [outer, size, inner]
+// around _axis and accumulate whole inner rows, so they stream through
+// memory without building slices.
+void Tensor::ReduceSum(const int& _axis, Tensor& _out) const
 {
 	if (this->rank == 0)
 	{
@@ -1834,21 +2407,38 @@ Tensor Tensor::ReduceSum(const int& _axis) const
 		throw std::out_of_range("[Tensor] Reduce Sum failed: axis out of bounds.");
 	}
 
-	std::vector<int> reduced_shape = this->shape;
-	reduced_shape.erase(reduced_shape.begin() + _axis);
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Reduce Sum failed: output cannot share storage with the input.");
+	}
+
+	this->ResizeReduced(_axis, _out);
 
-	Tensor reduced_sum(reduced_shape, 0.0);
+	int size = this->shape[_axis];
+	int inner = this->strides[_axis];
+	int outer = this->volume / (size * inner);
 
-	for (int i = 0; i < this->shape[_axis]; i++)
+	const double* input = this->data->data() + this->start_point;
+	double* output = _out.data->data() + _out.start_point;
+
+	for (int o = 0; o < outer; o++)
 	{
-		Tensor temp = this->Slice(_axis, i);
-		reduced_sum += temp;
-	}
+		double* out_row = output + (o * inner);
+		std::fill(out_row, out_row + inner, 0.0);
 
-	return reduced_sum;
+		for (int i = 0; i < size; i++)
+		{
+			const double* in_row = input + ((o * size + i) * inner);
+
+			for (int j = 0; j < inner; j++)
+			{
+				out_row[j] += in_row[j];
+			}
+		}
+	}
 }
 
-Tensor Tensor::ReduceMean(const int& _axis) const
+void Tensor::ReduceMean(const int& _axis, Tensor& _out) const
 {
 	if (this->rank == 0)
 	{
@@ -1860,13 +2450,22 @@ Tensor Tensor::ReduceMean(const int& _axis) const
 		throw std::out_of_range("[Tensor] Reduce Mean failed: axis out of bounds.");
 	}
 
-	Tensor reduced_sum = this->ReduceSum(_axis);
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Reduce Mean failed: output cannot share storage with the input.");
+	}
+
+	this->ReduceSum(_axis, _out);
+
 	double size = static_cast<double>(this->shape[_axis]);
 
-	return (reduced_sum / size);
+	for (double& value : _out)
+	{
+		value /= size;
+	}
 }
 
-Tensor Tensor::ReduceVar(const int& _axis, const bool& _inference) const
+void Tensor::ReduceVar(const int& _axis, const bool& _inference, Tensor& _out) const
 {
 	if (this->rank == 0)
 	{
@@ -1878,27 +2477,44 @@ Tensor Tensor::ReduceVar(const int& _axis, const bool& _inference) const
 		throw std::out_of_range("[Tensor] Reduce Variance failed: axis out of bounds.");
 	}
 
-	std::vector<int> reduced_shape = this->shape;
-	reduced_shape.erase(reduced_shape.begin() + _axis);
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Reduce Variance failed: output cannot share storage with the input.");
+	}
+
+	this->ReduceMean(_axis, _out);
 
-	Tensor reduced_mean = this->ReduceMean(_axis);
-	Tensor reduced_var(reduced_shape, 0.0);
+	int size = this->shape[_axis];
+	int inner = this->strides[_axis];
+	int outer = this->volume / (size * inner);
 
-	for (int i = 0; i < this->shape[_axis]; i++)
-	{
-		Tensor temp = this->Slice(_axis, i);
-		Tensor diff = temp - reduced_mean;
+	double divisor = static_cast<double>(size);
+	divisor -= (_inference && (divisor > 1)) ? 1 : 0;
 
-		reduced_var += (diff * diff);
-	}
+	const double* input = this->data->data() + this->start_point;
+	double* output = _out.data->data() + _out.start_point;
 
-	double size = static_cast<double>(this->shape[_axis]);
-	size -= (_inference && (size > 1)) ? 1 : 0;
+	// The mean held in _out is replaced by the variance position by position.
+	for (int o = 0; o < outer; o++)
+	{
+		for (int j = 0; j < inner; j++)
+		{
+			const double* column = input + (o * size * inner) + j;
+			double mean = output[o * inner + j];
+			double sum = 0.0;
+
+			for (int i = 0; i < size; i++)
+			{
+				double diff = column[i * inner] - mean;
+				sum += (diff * diff);
+			}
 
-	return reduced_var / size;
+			output[o * inner + j] = sum / divisor;
+		}
+	}
 }
 
-Tensor Tensor::ReduceMax(const int& _axis) const
+void Tensor::ReduceMax(const int& _axis, Tensor& _out) const
 {
 	if (this->rank == 0)
 	{
@@ -1910,23 +2526,38 @@ Tensor Tensor::ReduceMax(const int& _axis) const
 		throw std::out_of_range("[Tensor] Reduce Max failed: axis out of bounds.");
 	}
 
-	std::vector<int> reduced_shape = this->shape;
-	reduced_shape.erase(reduced_shape.begin() + _axis);
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Reduce Max failed: output cannot share storage with the input.");
+	}
+
+	this->ResizeReduced(_axis, _out);
+
+	int size = this->shape[_axis];
+	int inner = this->strides[_axis];
+	int outer = this->volume / (size * inner);
 
-	Tensor reduced_max = this->Slice(_axis, 0);
-	for (int i = 1; i < this->shape[_axis]; i++)
+	const double* input = this->data->data() + this->start_point;
+	double* output = _out.data->data() + _out.start_point;
+
+	for (int o = 0; o < outer; o++)
 	{
-		Tensor temp = this->Slice(_axis, i);
-		for (int j = reduced_max.start_point, k = temp.start_point; j < reduced_max.end_point && k < temp.end_point; j++, k++)
+		double* out_row = output + (o * inner);
+		std::copy(input + (o * size * inner), input + (o * size * inner) + inner, out_row);
+
+		for (int i = 1; i < size; i++)
 		{
-			(*reduced_max.data)[j] = std::max((*reduced_max.data)[j], (*temp.data)[k]);
+			const double* in_row = input + ((o * size + i) * inner);
+
+			for (int j = 0; j < inner; j++)
+			{
+				out_row[j] = std::max(out_row[j], in_row[j]);
+			}
 		}
 	}
-
-	return reduced_max;
 }
 
-Tensor Tensor::ReduceMin(const int& _axis) const
+void Tensor::ReduceMin(const int& _axis, Tensor& _out) const
 {
 	if (this->rank == 0)
 	{
@@ -1938,20 +2569,35 @@ Tensor Tensor::ReduceMin(const int& _axis) const
 		throw std::out_of_range("[Tensor] Reduce Min failed: axis out of bounds.");
 	}
 
-	std::vector<int> reduced_shape = this->shape;
-	reduced_shape.erase(reduced_shape.begin() + _axis);
+	if (this->SharesData(_out))
+	{
+		throw std::invalid_argument("[Tensor] Reduce Min failed: output cannot share storage with the input.");
+	}
+
+	this->ResizeReduced(_axis, _out);
+
+	int size = this->shape[_axis];
+	int inner = this->strides[_axis];
+	int outer = this->volume / (size * inner);
+
+	const double* input = this->data->data() + this->start_point;
+	double* output = _out.data->data() + _out.start_point;
 
-	Tensor reduced_min = this->Slice(_axis, 0);
-	for (int i = 1; i < this->shape[_axis]; i++)
+	for (int o = 0; o < outer; o++)
 	{
-		Tensor temp = this->Slice(_axis, i);
-		for (int j = reduced_min.start_point, k = temp.start_point; j < reduced_min.end_point && k < temp.end_point; j++, k++)
+		double* out_row = output + (o * inner);
+		std::copy(input + (o * size * inner), input + (o * size * inner) + inner, out_row);
+
+		for (int i = 1; i < size; i++)
 		{
-			(*reduced_min.data)[j] = std::min((*reduced_min.data)[j], (*temp.data)[k]);
+			const double* in_row = input + ((o * size + i) * inner);
+
+			for (int j = 0; j < inner; j++)
+			{
+				out_row[j] = std::min(out_row[j], in_row[j]);
+			}
 		}
 	}
-
-	return reduced_min;
 }
 
 double Tensor::Sum() const
@@ -2047,6 +2693,21 @@ Tensor Tensor::ActivateDerivative(const Activation::BaseActivation& _activation_
 	return _activation_func.df(*this);
 }
 
+std::pair<Tensor, Tensor> Tensor::ActivateWithDerivative(const Activation::BaseActivation& _activation_func) const
+{
+	return _activation_func.fdf(*this);
+}
+
+void Tensor::Activate(const Activation::BaseActivation& _activation_func, Tensor& _out) const
+{
+	_activation_func.f(*this, _out);
+}
+
+void Tensor::ActivateDerivative(const Activation::BaseActivation& _activation_func, Tensor& _out) const
+{
+	_activation_func.df(*this, _out);
+}
+
 // ========================================
 // Tensor Utility Method(s)
 // ========================================
@@ -2207,3 +2868,64 @@ std::vector<std::vector<double>> Tensor::ToMatrix() const
 
 	return matrix;
 }
+
+// ========================================
+// Tensor Matrix-View Method(s)
+// ========================================
+// Matrix aliasing the _batch_index-th matrix of the last two axes. Storage
+// shared with another Tensor is detached first so writes through the Matrix
+// land in this Tensor only; views of the same Tensor keep aliasing each other.
+LinAlg::Matrix Tensor::MatrixView(const int& _batch_index)
+{
+	int offset = this->MatrixOffset(_batch_index);
+
+	this->UniqueData();
+
+	auto owner = this->view_owner.lock();
+
+	if (owner == nullptr || *owner != this->data)
+	{
+		owner = std::make_shared<std::shared_ptr<std::vector<double>>>(this->data);
+		this->view_owner = owner;
+	}
+
+	int rows = this->shape[this->rank - 2];
+	int columns = this->shape[this->rank - 1];
+
+	std::shared_ptr<std::vector<double>> buffer(owner, this->data.get());
+
+	return LinAlg::Matrix(buffer, offset, { rows, columns }, columns);
+}
+
+// A const Tensor cannot be written through a view, so this returns a copy.
+LinAlg::Matrix Tensor::MatrixView(const int& _batch_index) const
+{
+	int offset = this->MatrixOffset(_batch_index);
+
+	int rows = this->shape[this->rank - 2];
+	int columns = this->shape[this->rank - 1];
+
+	// The copy constructor compacts the view into a buffer of its own.
+	LinAlg::Matrix view(this->data, offset, { rows, columns }, columns);
+
+	return LinAlg::Matrix(view);
+}
+
+int Tensor::MatrixOffset(const int& _batch_index) const
+{
+	if (this->rank < 2)
+	{
+		throw std::runtime_error("[Tensor] Matrix View failed: Tensor's rank must be >= 2.");
+	}
+
+	int rows = this->shape[this->rank - 2];
+	int columns = this->shape[this->rank - 1];
+	int n_matrix = this->volume / (rows * columns);
+
+	if (_batch_index < 0 || _batch_index >= n_matrix)
+	{
+		throw std::out_of_range("[Tensor] Matrix View failed: batch index out of bounds.");
+	}
+
+	return this->start_point + (_batch_index * rows * columns);
+}
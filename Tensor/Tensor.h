@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <climits>
 #include <cmath>
+#include <concepts>
 #include <cstdlib>
 #include <functional>
 #include <iostream>
@@ -20,19 +21,24 @@
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include <Windows.h>
 
 #undef min
 #undef max
 
+class Attention;
 class Math;
+class QuantizedTensor;
 class TensorSlice;
 
 class Tensor
 {
 	friend class TensorSlice;
+	friend class Attention;
 	friend class Math;
+	friend class QuantizedTensor;
 
 private:
 	int rank = 0;
@@ -49,8 +55,15 @@ private:
 
 	int end_point = 0;
 
+	// Owner through which every live Matrix handed out by MatrixView()
+	// aliases data, so all of this Tensor's views together add a single
+	// owner to data and are not mistaken for another Tensor sharing it.
+	std::weak_ptr<std::shared_ptr<std::vector<double>>> view_owner;
+
 	// ========== Constants ==========
 	static constexpr double EPSILON_SCALE = 1e6;
+	static constexpr int TRANSPOSE_TILE = 32;
+	static constexpr int TRANSPOSE_GRAIN = 1 << 15;
 
 public:
 	using iterator = std::vector<double>::iterator;
@@ -67,6 +80,27 @@ private:
 
 	Tensor Apply(const std::function<double(double)>& _func) const;
 
+	bool SharesData(const Tensor& _tensor) const;
+
+	void ResizeReduced(const int& _axis, Tensor& _out) const;
+
+	static void WindowOffsets(const std::vector<int>& _window_shape, const std::vector<int>& _strides, std::vector<int>& _offsets);
+
+	enum class PoolKind
+	{
+		Max,
+		Min,
+		Average
+	};
+
+	void Pool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, const PoolKind& _kind, Tensor& _out) const;
+
+	static void MergeTransposeAxes(const std::vector<int>& _shape, const std::vector<int>& _permutation, std::vector<int>& _merged_shape, std::vector<int>& _merged_permutation);
+
+	static void TransposeBlock(const double* _source, double* _destination, const int& _rows, const int& _columns, const int& _source_stride, const int& _destination_stride);
+
+	static void MatrixProduct(const Tensor& _tensor_1, const std::vector<int>& _shape_1, const Tensor& _tensor_2, const std::vector<int>& _shape_2, Tensor& _out, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha, const double& _beta);
+
 public:
 	Tensor() {}
 
@@ -78,6 +112,10 @@ public:
 
 	Tensor(const Tensor& _tensor);
 
+	Tensor(Tensor&& _tensor) noexcept;
+
+	static Tensor View(const LinAlg::Matrix& _matrix);
+
 	iterator begin();
 
 	iterator end();
@@ -88,6 +126,19 @@ public:
 
 	void UniqueData();
 
+	// Whether data has owners besides this Tensor and its own matrix views.
+	bool IsDataShared() const;
+
+	// Offset of the _batch_index-th matrix of the last two axes.
+	int MatrixOffset(const int& _batch_index) const;
+
+	// Prepares this Tensor to receive a result of the given shape: storage is
+	// kept when the shape already matches (results land in place, also through
+	// a view), reused when unshared, and reallocated only otherwise.
+	void Resize(const std::vector<int>& _shape);
+
+	void Resize(const Tensor& _tensor);
+
 	TensorSlice operator[](const int& _index);
 
 	Tensor operator[](const int& _index) const;
@@ -126,6 +177,24 @@ public:
 
 	void operator/=(const Tensor& _tensor);
 
+	// Out-parameter forms of the arithmetic operators; _out may be one of the
+	// operands (in-place) and is reused across calls of the same shape.
+	static void Add(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out);
+
+	static void Subtract(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out);
+
+	static void Multiply(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out);
+
+	static void Divide(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out);
+
+	static void Add(const Tensor& _tensor, const double& _value, Tensor& _out);
+
+	static void Subtract(const Tensor& _tensor, const double& _value, Tensor& _out);
+
+	static void Multiply(const Tensor& _tensor, const double& _value, Tensor& _out);
+
+	static void Divide(const Tensor& _tensor, const double& _value, Tensor& _out);
+
 	Tensor Reshape(const std::vector<int>& _new_shape) const;
 
 	Tensor ExpandRank(const int& _axis = 0) const;
@@ -152,20 +221,53 @@ public:
 
 	Tensor Transpose(const std::vector<int>& _permutation) const;
 
+	// Writes into _out, which must not share storage with the Tensor.
+	void Transpose(const std::vector<int>& _permutation, Tensor& _out) const;
+
 	static Tensor MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2);
 
 	Tensor MatMul(const Tensor& _tensor) const;
 
+	// Writes into _out, which must not share storage with either operand.
+	static void MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out);
+
+	// _out = _alpha * op(_tensor_1) @ op(_tensor_2) + _beta * _out over the last
+	// two axes, where op swaps them when its flag is set; transposed operands
+	// are read in place. Batch dimensions broadcast without copying either
+	// operand. With _beta != 0, _out must already have the product's shape.
+	static void MatMul(const Tensor& _tensor_1, const Tensor& _tensor_2, Tensor& _out, const bool& _transpose_1, const bool& _transpose_2, const double& _alpha = 1.0, const double& _beta = 0.0);
+
 	static Tensor TensorDot(const Tensor& _tensor_1, const Tensor& _tensor_2, const std::vector<int>& _contract_axes_1, const std::vector<int>& _contract_axes_2);
 
+	// Einstein summation over any number of operands, e.g.
+	// Einsum("bij,bjk->bik", a, b) or Einsum("ii", a) for a trace. Without
+	// "->" the output holds the labels used exactly once, in alphabetical
+	// order. The pairwise contraction order minimizes the operation count
+	// (see Einsum.h).
+	template <typename... Tensors>
+		requires (std::same_as<Tensors, Tensor> && ...)
+	static Tensor Einsum(const std::string& _equation, const Tensors&... _operands);
+
+	static Tensor Einsum(const std::string& _equation, const std::vector<Tensor>& _operands);
+
+	static Tensor Einsum(const std::string& _equation, const std::vector<const Tensor*>& _operands);
+
 	Tensor Convolve(const Tensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding);
 
+	void Convolve(const Tensor& _filter, const std::vector<int>& _strides, const std::vector<int>& _padding, Tensor& _out) const;
+
 	Tensor MaxPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides = {});
 
 	Tensor MinPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides = {});
 
 	Tensor AvgPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides = {});
 
+	void MaxPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const;
+
+	void MinPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const;
+
+	void AvgPool(const std::vector<int>& _pool_shape, const std::vector<int>& _strides, Tensor& _out) const;
+
 	Tensor Sign(const bool& _heaviside = false) const;
 
 	Tensor ReduceSum(const int& _axis = 0) const;
@@ -178,6 +280,17 @@ public:
 
 	Tensor ReduceMin(const int& _axis = 0) const;
 
+	// Out-parameter reductions; _out must not share storage with this Tensor.
+	void ReduceSum(const int& _axis, Tensor& _out) const;
+
+	void ReduceMean(const int& _axis, Tensor& _out) const;
+
+	void ReduceVar(const int& _axis, const bool& _inference, Tensor& _out) const;
+
+	void ReduceMax(const int& _axis, Tensor& _out) const;
+
+	void ReduceMin(const int& _axis, Tensor& _out) const;
+
 	double Sum() const;
 
 	double Mean() const;
@@ -192,6 +305,13 @@ public:
 
 	Tensor ActivateDerivative(const Activation::BaseActivation& _activation_func) const;
 
+	void Activate(const Activation::BaseActivation& _activation_func, Tensor& _out) const;
+
+	void ActivateDerivative(const Activation::BaseActivation& _activation_func, Tensor& _out) const;
+
+	// Activation and its derivative in one pass (e.g. for a training step).
+	std::pair<Tensor, Tensor> ActivateWithDerivative(const Activation::BaseActivation& _activation_func) const;
+
 	int Rank() const;
 
 	int Volume() const;
@@ -211,4 +331,15 @@ public:
 	std::vector<double> ToVector() const;
 
 	std::vector<std::vector<double>> ToMatrix() const;
+
+	LinAlg::Matrix MatrixView(const int& _batch_index = 0);
+
+	LinAlg::Matrix MatrixView(const int& _batch_index = 0) const;
 };
+
+template <typename... Tensors>
+	requires (std::same_as<Tensors, Tensor> && ...)
+Tensor Tensor::Einsum(const std::string& _equation, const Tensors&... _operands)
+{
+	return Tensor::Einsum(_equation, std::vector<const Tensor*>{ &_operands... });
+}
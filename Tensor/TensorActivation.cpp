@@ -1,4 +1,7 @@
 #include "TensorActivation.h"
+#include "Tensor.h"
+#include "Utils.h"
+#include "FastMath.h"
 
 
 bool Activation::TensorActivation::isScalar() const
@@ -15,3 +18,330 @@ double Activation::TensorActivation::df(double x) const
 {
     throw std::logic_error("[Activation] Tensor Activation failed: Scalar derivative not supported for TensorActivation.");
 }
+
+std::pair<Tensor, Tensor> Activation::TensorActivation::fdf(const Tensor& tensor) const
+{
+    return { this->f(tensor), this->df(tensor) };
+}
+
+Activation::TensorActivation::AxisLayout Activation::TensorActivation::ResolveAxis(const Tensor& tensor, int axis, const std::string& name)
+{
+    if (tensor.IsEmpty())
+    {
+        throw std::runtime_error("[Activation] " + name + " failed: empty Tensor.");
+    }
+
+    if (tensor.IsScalar())
+    {
+        throw std::invalid_argument("[Activation] " + name + " failed: cannot apply " + name + " to scalar. " + name + " requires at least 2 elements.");
+    }
+
+    int actual_axis = (axis < 0) ? (tensor.Rank() + axis) : axis;
+
+    if (actual_axis < 0 || actual_axis >= tensor.Rank())
+    {
+        throw std::out_of_range("[Activation] " + name + " failed: axis out of range.");
+    }
+
+    std::vector<int> shape = tensor.Shape();
+
+    AxisLayout layout;
+    layout.size = shape[actual_axis];
+
+    for (int i = 0; i < actual_axis; i++)
+    {
+        layout.outer *= shape[i];
+    }
+
+    for (int i = actual_axis + 1; i < tensor.Rank(); i++)
+    {
+        layout.inner *= shape[i];
+    }
+
+    return layout;
+}
+
+void Activation::TensorActivation::PrepareOutput(const Tensor& tensor, Tensor& output)
+{
+    output.Resize(tensor);
+}
+
+void Activation::TensorActivation::SoftmaxKernel(const double* input, double* output, const AxisLayout& layout, bool log)
+{
+    // Online softmax: a single read pass keeps a running maximum m and a sum s
+    // rescaled by exp(m_old - m_new) whenever the maximum grows, then one
+    // write pass. Reads of element k happen before its write, so input and
+    // output may alias. -inf entries (masked positions) contribute 0: while
+    // a lane's maximum is still -inf it has nothing to rescale, since
+    // exp(-inf - -inf) would be NaN.
+    int n = layout.size;
+    int inner = layout.inner;
+    size_t row_volume = static_cast<size_t>(n) * inner;
+
+    // Resolved once so every worker uses the same exp/log accuracy.
+    FastMath::Precision precision = FastMath::GetPrecision();
+
+    const double neg_inf = -std::numeric_limits<double>::infinity();
+
+    if (inner == 1)
+    {
+        Utils::ParallelFor(0, layout.outer, [&](int begin, int end)
+            {
+                constexpr int LANES = 4;
+
+                for (int r = begin; r < end; r++)
+                {
+                    const double* x = input + static_cast<size_t>(r) * n;
+                    double* y = output + static_cast<size_t>(r) * n;
+
+                    // Independent lanes break the max/sum dependency chain.
+                    double m[LANES] = { neg_inf, neg_inf, neg_inf, neg_inf };
+                    double s[LANES] = { 0.0, 0.0, 0.0, 0.0 };
+
+                    int k = 0;
+                    for (; k + LANES <= n; k += LANES)
+                    {
+                        for (int l = 0; l < LANES; l++)
+                        {
+                            double v = x[k + l];
+                            if (v > m[l])
+                            {
+                                s[l] = s[l] * FastMath::Exp(m[l] - v, precision) + 1.0;
+                                m[l] = v;
+                            }
+                            else if (m[l] != neg_inf)
+                            {
+                                s[l] += FastMath::Exp(v - m[l], precision);
+                            }
+                        }
+                    }
+
+                    for (; k < n; k++)
+                    {
+                        double v = x[k];
+                        if (v > m[0])
+                        {
+                            s[0] = s[0] * FastMath::Exp(m[0] - v, precision) + 1.0;
+                            m[0] = v;
+                        }
+                        else if (m[0] != neg_inf)
+                        {
+                            s[0] += FastMath::Exp(v - m[0], precision);
+                        }
+                    }
+
+                    double max_value = *std::max_element(m, m + LANES);
+                    double sum = 0.0;
+                    for (int l = 0; l < LANES; l++)
+                    {
+                        if (m[l] != neg_inf)
+                        {
+                            sum += s[l] * FastMath::Exp(m[l] - max_value, precision);
+                        }
+                    }
+
+                    if (log)
+                    {
+                        double log_norm = max_value + FastMath::Log(sum, precision);
+                        for (int j = 0; j < n; j++)
+                        {
+                            y[j] = x[j] - log_norm;
+                        }
+                    }
+                    else
+                    {
+                        double inv_sum = 1.0 / sum;
+                        for (int j = 0; j < n; j++)
+                        {
+                            y[j] = FastMath::Exp(x[j] - max_value, precision) * inv_sum;
+                        }
+                    }
+                }
+            }, std::max(1, 16384 / n));
+
+        return;
+    }
+
+    // Strided rows: sweep TILE neighbouring rows together so every inner loop
+    // runs over contiguous memory.
+    constexpr int TILE = 256;
+    int tiles = (inner + TILE - 1) / TILE;
+
+    Utils::ParallelFor(0, layout.outer * tiles, [&](int begin, int end)
+        {
+            double m[TILE];
+            double s[TILE];
+
+            for (int t = begin; t < end; t++)
+            {
+                int o = t / tiles;
+                int i_begin = (t % tiles) * TILE;
+                int width = std::min(TILE, inner - i_begin);
+
+                const double* x = input + o * row_volume + i_begin;
+                double* y = output + o * row_volume + i_begin;
+
+                std::fill(m, m + width, neg_inf);
+                std::fill(s, s + width, 0.0);
+
+                for (int k = 0; k < n; k++)
+                {
+                    const double* row = x + static_cast<size_t>(k) * inner;
+
+                    for (int i = 0; i < width; i++)
+                    {
+                        double v = row[i];
+                        if (v > m[i])
+                        {
+                            s[i] = s[i] * FastMath::Exp(m[i] - v, precision) + 1.0;
+                            m[i] = v;
+                        }
+                        else if (m[i] != neg_inf)
+                        {
+                            s[i] += FastMath::Exp(v - m[i], precision);
+                        }
+                    }
+                }
+
+                for (int i = 0; i < width; i++)
+                {
+                    if (log)
+                    {
+                        m[i] += FastMath::Log(s[i], precision);
+                    }
+                    else
+                    {
+                        s[i] = 1.0 / s[i];
+                    }
+                }
+
+                for (int k = 0; k < n; k++)
+                {
+                    const double* row = x + static_cast<size_t>(k) * inner;
+                    double* out_row = y + static_cast<size_t>(k) * inner;
+
+                    if (log)
+                    {
+                        for (int i = 0; i < width; i++)
+                        {
+                            out_row[i] = row[i] - m[i];
+                        }
+                    }
+                    else
+                    {
+                        for (int i = 0; i < width; i++)
+                        {
+                            out_row[i] = FastMath::Exp(row[i] - m[i], precision) * s[i];
+                        }
+                    }
+                }
+            }
+        }, std::max(1, 16384 / (n * TILE)));
+}
+
+Tensor Activation::TensorActivation::Product(const Tensor& y, const Tensor& vector, int axis, ProductKind kind, const std::string& name)
+{
+    if (y.Shape() != vector.Shape())
+    {
+        throw std::invalid_argument("[Activation] " + name + " failed: vector shape mismatch with input Tensor.");
+    }
+
+    AxisLayout layout = TensorActivation::ResolveAxis(y, axis, name);
+
+    Tensor result(y.Shape(), 0.0);
+
+    const double* y_data = &*y.begin();
+    const double* v_data = &*vector.begin();
+    double* out_data = &*result.begin();
+
+    int n = layout.size;
+    int inner = layout.inner;
+    size_t row_volume = static_cast<size_t>(n) * inner;
+
+    constexpr int TILE = 256;
+    constexpr double SUPPORT_EPSILON = 1e-10;
+
+    int tiles = (inner + TILE - 1) / TILE;
+
+    // Two passes per row: reduce sum(c * v) (and the support size), then write.
+    Utils::ParallelFor(0, layout.outer * tiles, [&](int begin, int end)
+        {
+            double dot[TILE];
+            double count[TILE];
+
+            for (int t = begin; t < end; t++)
+            {
+                int o = t / tiles;
+                int i_begin = (t % tiles) * TILE;
+                int width = std::min(TILE, inner - i_begin);
+
+                size_t base = o * row_volume + i_begin;
+
+                std::fill(dot, dot + width, 0.0);
+                std::fill(count, count + width, 0.0);
+
+                for (int k = 0; k < n; k++)
+                {
+                    const double* y_row = y_data + base + static_cast<size_t>(k) * inner;
+                    const double* v_row = v_data + base + static_cast<size_t>(k) * inner;
+
+                    for (int i = 0; i < width; i++)
+                    {
+                        switch (kind)
+                        {
+                        case ProductKind::Softmax:
+                        case ProductKind::LogSoftmaxJVP:
+                            dot[i] += y_row[i] * v_row[i];
+                            break;
+                        case ProductKind::LogSoftmaxVJP:
+                            dot[i] += v_row[i];
+                            break;
+                        case ProductKind::Sparsemax:
+                            if (y_row[i] > SUPPORT_EPSILON)
+                            {
+                                dot[i] += v_row[i];
+                                count[i] += 1.0;
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                if (kind == ProductKind::Sparsemax)
+                {
+                    for (int i = 0; i < width; i++)
+                    {
+                        dot[i] = (count[i] > 0.0) ? (dot[i] / count[i]) : 0.0;
+                    }
+                }
+
+                for (int k = 0; k < n; k++)
+                {
+                    const double* y_row = y_data + base + static_cast<size_t>(k) * inner;
+                    const double* v_row = v_data + base + static_cast<size_t>(k) * inner;
+                    double* out_row = out_data + base + static_cast<size_t>(k) * inner;
+
+                    for (int i = 0; i < width; i++)
+                    {
+                        switch (kind)
+                        {
+                        case ProductKind::Softmax:
+                            out_row[i] = y_row[i] * (v_row[i] - dot[i]);
+                            break;
+                        case ProductKind::LogSoftmaxVJP:
+                            out_row[i] = v_row[i] - y_row[i] * dot[i];
+                            break;
+                        case ProductKind::LogSoftmaxJVP:
+                            out_row[i] = v_row[i] - dot[i];
+                            break;
+                        case ProductKind::Sparsemax:
+                            out_row[i] = (y_row[i] > SUPPORT_EPSILON) ? (v_row[i] - dot[i]) : 0.0;
+                            break;
+                        }
+                    }
+                }
+            }
+        }, std::max(1, 16384 / (n * TILE)));
+
+    return result;
+}
@@ -2,10 +2,40 @@
 
 #include "BaseActivation.h"
 
+#include <string>
+
 namespace Activation
 {
     class TensorActivation : public BaseActivation
     {
+    protected:
+        // A Tensor viewed as [outer, size, inner] around the activation axis:
+        // element k of row (o, i) lives at o * size * inner + k * inner + i.
+        struct AxisLayout
+        {
+            int outer = 1;
+            int size = 1;
+            int inner = 1;
+        };
+
+        static AxisLayout ResolveAxis(const Tensor& tensor, int axis, const std::string& name);
+
+        static void PrepareOutput(const Tensor& tensor, Tensor& output);
+
+        static void SoftmaxKernel(const double* input, double* output, const AxisLayout& layout, bool log);
+
+        // Row-wise out = a * v - b * sum(c * v) for the softmax family, where
+        // y is the forward output (probabilities, or sparsemax values).
+        enum class ProductKind
+        {
+            Softmax,        // a = b = c = y
+            LogSoftmaxVJP,  // a = 1, b = y, c = 1
+            LogSoftmaxJVP,  // a = 1, b = 1, c = y
+            Sparsemax       // a = c = support(y), b = support(y) / |support(y)|
+        };
+
+        static Tensor Product(const Tensor& y, const Tensor& vector, int axis, ProductKind kind, const std::string& name);
+
     public:
         bool isScalar() const override;
 
@@ -15,6 +45,22 @@ namespace Activation
 
         virtual Tensor f(const Tensor& tensor) const = 0;
 
+        // Not an elementwise derivative: the O(n)-per-row data the Jacobian
+        // is built from, shaped like tensor. Softmax and LogSoftmax return the
+        // probabilities p (J = diag(p) - p * p^T and J = I - 1 * p^T), Sparsemax
+        // the support mask m (J = diag(m) - m * m^T / |S|). fdf and
+        // Tensor::ActivateDerivative return the same; VJP/JVP apply it.
         virtual Tensor df(const Tensor& tensor) const = 0;
+
+        using BaseActivation::f;
+
+        using BaseActivation::df;
+
+        std::pair<Tensor, Tensor> fdf(const Tensor& tensor) const override;
+
+        // Dense Jacobian, with the activation axis expanded in place into two
+        // axes of its size. O(n^2) per row: an opt-in debugging path, and the
+        // only method that materializes it.
+        virtual Tensor Jacobian(const Tensor& tensor) const = 0;
     };
 }
@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Conversion.h"
+#include "HalfPrecision.h"
+#include "LinAlg.h"
+#include "Tensor.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// ========================================
+// Concept: Element types of TypedTensor
+// ========================================
+template <typename T>
+concept HalfElement = std::same_as<T, BFloat16> || std::same_as<T, Float16>;
+
+template <typename T>
+concept FloatingElement = std::floating_point<T> || HalfElement<T>;
+
+template <typename T>
+concept TensorElement = FloatingElement<T> || std::same_as<T, int32_t> || std::same_as<T, int8_t>;
+
+// Arithmetic type of T: double for double, float otherwise.
+template <typename T>
+using ComputeType = std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+// Types element-wise and reduction results of T are stored as: T itself or,
+// to keep the precision, its arithmetic type.
+template <typename R, typename T>
+concept ResultElement = FloatingElement<T> && (std::same_as<R, T> || std::same_as<R, ComputeType<T>>);
+
+// Operand types Gemm multiplies into a result of type R: R itself, float
+// into double, and 16-bit types into float.
+template <typename U, typename R>
+concept ProductOperand = (std::same_as<U, R> && FloatingElement<R>)
+    || (std::same_as<U, float> && std::same_as<R, double>)
+    || (HalfElement<U> && std::same_as<R, float>);
+
+// ========================================
+// TypedTensor Class
+// ========================================
+// A dense row-major tensor of a chosen element type, for data that does not
+// need Tensor's double precision: float halves the memory and bandwidth of
+// a Tensor and doubles the vector width of its kernels, int32_t / int8_t
+// hold indices and quantized values, and BFloat16 / Float16 store large
+// weight and embedding tables in a quarter of a Tensor's memory.
+// Conversions between element types, and to and from Tensor, go through
+// the Conversion kernels (rounding and saturating into integer types).
+//
+// Arithmetic happens in the Compute type (double for double elements,
+// float otherwise): 16-bit elements are widened BLOCK at a time into a
+// float buffer, processed there, and narrowed again only when the result is
+// stored as 16-bit; a float result keeps the full float precision.
+//
+// MatMul runs on Gemm for floating elements. Float products accumulate in
+// float by default, or in double with Accumulation::Double; a double result
+// from float operands accumulates in double, and 16-bit operands always
+// accumulate in float.
+//
+// As with Tensor, copies are deep; the storage is held by a shared_ptr so
+// moved-from and assigned tensors hand it over without copying.
+template <TensorElement T>
+class TypedTensor
+{
+    template <TensorElement U>
+    friend class TypedTensor;
+
+private:
+    std::shared_ptr<std::vector<T>> data;
+
+    std::vector<int> shape;
+
+    int volume = 0;
+
+    // ========== Constants ==========
+    static constexpr int BLOCK = 256;
+    static constexpr int PARALLEL_BLOCKS = 64;
+
+public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    using Compute = ComputeType<T>;
+
+private:
+    enum class ReduceKind
+    {
+        Sum,
+        Mean,
+        Max,
+        Min
+    };
+
+    static int ShapeVolume(const std::vector<int>& _shape);
+
+    template <typename From, typename To>
+    static void Copy(const From* _source, To* _destination, const int& _count);
+
+    bool SharesData(const TypedTensor& _tensor) const;
+
+    template <TensorElement R, typename Func>
+    static void Elementwise(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out, Func _func);
+
+    static double ReduceBlock(const T* _source, const int& _count, const ReduceKind& _kind);
+
+    static double ReduceRange(const T* _source, const int& _count, const ReduceKind& _kind);
+
+    template <TensorElement R>
+    void Reduce(const int& _axis, const ReduceKind& _kind, TypedTensor<R>& _out) const;
+
+    template <typename U>
+    static void MatrixProduct(const TypedTensor<U>& _tensor_1, const std::vector<int>& _shape_1, const TypedTensor<U>& _tensor_2, const std::vector<int>& _shape_2, TypedTensor& _out, const bool& _transpose_1, const bool& _transpose_2, const LinAlg::Gemm::Accumulation& _accumulation, const Compute& _alpha, const Compute& _beta);
+
+public:
+    TypedTensor() {}
+
+    TypedTensor(const std::vector<int>& _shape, const T& _value = T());
+
+    TypedTensor(const std::vector<int>& _shape, const std::vector<T>& _data);
+
+    // Converts every element of _tensor to T.
+    explicit TypedTensor(const Tensor& _tensor);
+
+    TypedTensor(const TypedTensor& _tensor);
+
+    TypedTensor(TypedTensor&& _tensor) noexcept;
+
+    TypedTensor& operator=(const TypedTensor& _tensor);
+
+    TypedTensor& operator=(TypedTensor&& _tensor) noexcept;
+
+    iterator begin();
+
+    iterator end();
+
+    const_iterator begin() const;
+
+    const_iterator end() const;
+
+    T* Data();
+
+    const T* Data() const;
+
+    // Prepares this tensor to receive a result of the given shape; storage is
+    // kept when the shape already matches and reused when unshared.
+    void Resize(const std::vector<int>& _shape);
+
+    Tensor ToTensor() const;
+
+    template <TensorElement U>
+    TypedTensor<U> Cast() const;
+
+    // Element-wise arithmetic on tensors of equal shape, computed in Compute
+    // and stored as T or, to keep the precision, as Compute. _out may be
+    // one of the operands (in-place).
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    static void Add(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out);
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    static void Subtract(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out);
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    static void Multiply(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out);
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    static void Divide(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out);
+
+    static TypedTensor MatMul(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, const LinAlg::Gemm::Accumulation& _accumulation = LinAlg::Gemm::Accumulation::Single)
+        requires FloatingElement<T>;
+
+    // _out = op(_tensor_1) @ op(_tensor_2) over the last two axes with the
+    // batch axes broadcast, as Tensor::MatMul; vectors are read as a single
+    // row (left) or column (right). _out must not share storage with an
+    // operand. Operands are of the tensor's own type, float for a double
+    // result or 16-bit for a float result (see ProductOperand).
+    template <TensorElement U>
+        requires ProductOperand<U, T>
+    static void MatMul(const TypedTensor<U>& _tensor_1, const TypedTensor<U>& _tensor_2, TypedTensor& _out, const LinAlg::Gemm::Accumulation& _accumulation = LinAlg::Gemm::Accumulation::Single);
+
+    // _out = _alpha * op(_tensor_1) @ op(_tensor_2) + _beta * _out, where op
+    // swaps the last two axes when its flag is set (read in place). With
+    // _beta != 0, _out must already have the product's shape.
+    template <TensorElement U>
+        requires ProductOperand<U, T>
+    static void MatMul(const TypedTensor<U>& _tensor_1, const TypedTensor<U>& _tensor_2, TypedTensor& _out, const bool& _transpose_1, const bool& _transpose_2, const LinAlg::Gemm::Accumulation& _accumulation = LinAlg::Gemm::Accumulation::Single, const Compute& _alpha = Compute(1), const Compute& _beta = Compute(0));
+
+    // Reductions along _axis (removed from the shape), computed in Compute
+    // and stored as T or Compute. _out must not share storage with this
+    // tensor.
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    void ReduceSum(const int& _axis, TypedTensor<R>& _out) const;
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    void ReduceMean(const int& _axis, TypedTensor<R>& _out) const;
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    void ReduceMax(const int& _axis, TypedTensor<R>& _out) const;
+
+    template <TensorElement R>
+        requires ResultElement<R, T>
+    void ReduceMin(const int& _axis, TypedTensor<R>& _out) const;
+
+    // Whole-tensor reductions. Sum and Mean add BLOCK elements at a time in
+    // Compute and the block sums in double, so long float / 16-bit tensors
+    // do not drift.
+    Compute Sum() const
+        requires FloatingElement<T>;
+
+    Compute Mean() const
+        requires FloatingElement<T>;
+
+    Compute Max() const
+        requires FloatingElement<T>;
+
+    Compute Min() const
+        requires FloatingElement<T>;
+
+    int Rank() const;
+
+    int Volume() const;
+
+    std::vector<int> Shape() const;
+
+    bool IsEmpty() const;
+
+    std::vector<T> ToVector() const;
+};
+
+#include "TypedTensor.inl"
@@ -0,0 +1,702 @@
+#include "TypedTensor.h"
+
+// ========================================
+// [Private] Helper Method(s)
+// ========================================
+template <TensorElement T>
+int TypedTensor<T>::ShapeVolume(const std::vector<int>& _shape)
+{
+    if (Utils::IsAnyNegative(_shape))
+    {
+        throw std::invalid_argument("[TypedTensor] Construction failed: dimensions of shape must be non-negative.");
+    }
+
+    return std::accumulate(_shape.begin(), _shape.end(), 1, std::multiplies<int>());
+}
+
+template <TensorElement T>
+template <typename From, typename To>
+void TypedTensor<T>::Copy(const From* _source, To* _destination, const int& _count)
+{
+    if constexpr (std::is_same_v<From, To>)
+    {
+        std::copy(_source, _source + _count, _destination);
+    }
+    else
+    {
+        Conversion::Convert(_source, _destination, _count);
+    }
+}
+
+template <TensorElement T>
+bool TypedTensor<T>::SharesData(const TypedTensor& _tensor) const
+{
+    return (this->data != nullptr) && (this->data == _tensor.data);
+}
+
+// ========================================
+// [Private] Element-wise Helper Method(s)
+// ========================================
+// _out[i] = _func(_tensor_1[i], _tensor_2[i]) in Compute, BLOCK elements at
+// a time: both operand blocks are widened into local buffers (a plain copy
+// for float and double), combined there and narrowed into _out. A block is
+// read completely before it is written, so _out may be an operand.
+template <TensorElement T>
+template <TensorElement R, typename Func>
+void TypedTensor<T>::Elementwise(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out, Func _func)
+{
+    if (_tensor_1.IsEmpty() || _tensor_2.IsEmpty())
+    {
+        throw std::invalid_argument("[TypedTensor] Element-wise operation failed: tensors must not be empty.");
+    }
+
+    if (_tensor_1.shape != _tensor_2.shape)
+    {
+        throw std::invalid_argument("[TypedTensor] Element-wise operation failed: shapes of tensors must match.");
+    }
+
+    _out.Resize(_tensor_1.shape);
+
+    const T* x = _tensor_1.Data();
+    const T* y = _tensor_2.Data();
+    R* z = _out.Data();
+
+    const int volume = _tensor_1.volume;
+    const int blocks = (volume + TypedTensor::BLOCK - 1) / TypedTensor::BLOCK;
+
+    Utils::ParallelFor(0, blocks, [&](int begin, int end)
+        {
+            Compute x_block[TypedTensor::BLOCK];
+            Compute y_block[TypedTensor::BLOCK];
+            Compute z_block[TypedTensor::BLOCK];
+
+            for (int block = begin; block < end; block++)
+            {
+                const int offset = block * TypedTensor::BLOCK;
+                const int count = std::min(TypedTensor::BLOCK, volume - offset);
+
+                TypedTensor::Copy(x + offset, x_block, count);
+                TypedTensor::Copy(y + offset, y_block, count);
+
+                for (int i = 0; i < count; i++)
+                {
+                    z_block[i] = _func(x_block[i], y_block[i]);
+                }
+
+                TypedTensor::Copy(z_block, z + offset, count);
+            }
+        }, TypedTensor::PARALLEL_BLOCKS);
+}
+
+// ========================================
+// [Private] Reduction Helper Method(s)
+// ========================================
+// Reduces at most BLOCK contiguous elements, widened into a local buffer.
+template <TensorElement T>
+double TypedTensor<T>::ReduceBlock(const T* _source, const int& _count, const ReduceKind& _kind)
+{
+    Compute block[TypedTensor::BLOCK];
+    TypedTensor::Copy(_source, block, _count);
+
+    Compute result = block[0];
+
+    for (int i = 1; i < _count; i++)
+    {
+        switch (_kind)
+        {
+        case ReduceKind::Max: result = std::max(result, block[i]); break;
+        case ReduceKind::Min: result = std::min(result, block[i]); break;
+        default: result += block[i]; break;
+        }
+    }
+
+    return static_cast<double>(result);
+}
+
+// Block results are combined in double (a sum of n float elements then
+// errs by about BLOCK * 2^-24 relative instead of n * 2^-24).
+template <TensorElement T>
+double TypedTensor<T>::ReduceRange(const T* _source, const int& _count, const ReduceKind& _kind)
+{
+    double result = TypedTensor::ReduceBlock(_source, std::min(_count, TypedTensor::BLOCK), _kind);
+
+    for (int offset = TypedTensor::BLOCK; offset < _count; offset += TypedTensor::BLOCK)
+    {
+        double block = TypedTensor::ReduceBlock(_source + offset, std::min(TypedTensor::BLOCK, _count - offset), _kind);
+
+        switch (_kind)
+        {
+        case ReduceKind::Max: result = std::max(result, block); break;
+        case ReduceKind::Min: result = std::min(result, block); break;
+        default: result += block; break;
+        }
+    }
+
+    return (_kind == ReduceKind::Mean) ? (result / _count) : result;
+}
+
+template <TensorElement T>
+template <TensorElement R>
+void TypedTensor<T>::Reduce(const int& _axis, const ReduceKind& _kind, TypedTensor<R>& _out) const
+{
+    if (this->IsEmpty() || this->Rank() == 0)
+    {
+        throw std::runtime_error("[TypedTensor] Reduction failed: invalid operation on scalar or empty tensor.");
+    }
+
+    if (_axis < 0 || _axis >= this->Rank())
+    {
+        throw std::out_of_range("[TypedTensor] Reduction failed: axis out of bounds.");
+    }
+
+    if (this->shape[_axis] == 0)
+    {
+        throw std::invalid_argument("[TypedTensor] Reduction failed: the reduced axis must not be empty.");
+    }
+
+    if constexpr (std::is_same_v<R, T>)
+    {
+        if (this->SharesData(_out))
+        {
+            throw std::invalid_argument("[TypedTensor] Reduction failed: output cannot share storage with the input.");
+        }
+    }
+
+    std::vector<int> reduced_shape = this->shape;
+    reduced_shape.erase(reduced_shape.begin() + _axis);
+
+    _out.Resize(reduced_shape);
+
+    const int size = this->shape[_axis];
+    const int inner = std::accumulate(this->shape.begin() + _axis + 1, this->shape.end(), 1, std::multiplies<int>());
+    const int outer = std::accumulate(this->shape.begin(), this->shape.begin() + _axis, 1, std::multiplies<int>());
+
+    const T* input = this->Data();
+    R* output = _out.Data();
+
+    // The last axis is contiguous: each output reduces one row.
+    if (inner == 1)
+    {
+        Utils::ParallelFor(0, outer, [&](int begin, int end)
+            {
+                for (int o = begin; o < end; o++)
+                {
+                    output[o] = static_cast<R>(static_cast<Compute>(TypedTensor::ReduceRange(input + (static_cast<size_t>(o) * size), size, _kind)));
+                }
+            }, std::max(1, (TypedTensor::PARALLEL_BLOCKS * TypedTensor::BLOCK) / size));
+
+        return;
+    }
+
+    // Otherwise BLOCK outputs at a time are accumulated row by row.
+    const int inner_blocks = (inner + TypedTensor::BLOCK - 1) / TypedTensor::BLOCK;
+
+    Utils::ParallelFor(0, outer * inner_blocks, [&](int begin, int end)
+        {
+            Compute accumulator[TypedTensor::BLOCK];
+            Compute row[TypedTensor::BLOCK];
+
+            for (int task = begin; task < end; task++)
+            {
+                const int o = task / inner_blocks;
+                const int j_begin = (task % inner_blocks) * TypedTensor::BLOCK;
+                const int count = std::min(TypedTensor::BLOCK, inner - j_begin);
+
+                const T* source = input + (static_cast<size_t>(o) * size * inner) + j_begin;
+
+                TypedTensor::Copy(source, accumulator, count);
+
+                for (int i = 1; i < size; i++)
+                {
+                    TypedTensor::Copy(source + (static_cast<size_t>(i) * inner), row, count);
+
+                    for (int j = 0; j < count; j++)
+                    {
+                        switch (_kind)
+                        {
+                        case ReduceKind::Max: accumulator[j] = std::max(accumulator[j], row[j]); break;
+                        case ReduceKind::Min: accumulator[j] = std::min(accumulator[j], row[j]); break;
+                        default: accumulator[j] += row[j]; break;
+                        }
+                    }
+                }
+
+                if (_kind == ReduceKind::Mean)
+                {
+                    for (int j = 0; j < count; j++)
+                    {
+                        accumulator[j] /= static_cast<Compute>(size);
+                    }
+                }
+
+                TypedTensor::Copy(accumulator, output + (static_cast<size_t>(o) * inner) + j_begin, count);
+            }
+        }, std::max(1, TypedTensor::PARALLEL_BLOCKS / size));
+}
+
+// ========================================
+// [Private] Matrix Product Helper Method(s)
+// ========================================
+// Shared body of the MatMul forms; _shape_1 and _shape_2 are the operands'
+// shapes as matrix stacks (rank >= 2).
+template <TensorElement T>
+template <typename U>
+void TypedTensor<T>::MatrixProduct(const TypedTensor<U>& _tensor_1, const std::vector<int>& _shape_1, const TypedTensor<U>& _tensor_2, const std::vector<int>& _shape_2, TypedTensor& _out, const bool& _transpose_1, const bool& _transpose_2, const LinAlg::Gemm::Accumulation& _accumulation, const Compute& _alpha, const Compute& _beta)
+{
+    int rank_1 = static_cast<int>(_shape_1.size());
+    int rank_2 = static_cast<int>(_shape_2.size());
+
+    int rows_1 = _shape_1[rank_1 - 2];
+    int columns_1 = _shape_1[rank_1 - 1];
+    int rows_2 = _shape_2[rank_2 - 2];
+    int columns_2 = _shape_2[rank_2 - 1];
+
+    int rows = _transpose_1 ? columns_1 : rows_1;
+    int inner = _transpose_1 ? rows_1 : columns_1;
+    int inner_2 = _transpose_2 ? columns_2 : rows_2;
+    int columns = _transpose_2 ? rows_2 : columns_2;
+
+    if (inner != inner_2)
+    {
+        throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: inner dimensions must match (got "
+            + std::to_string(inner) + " and " + std::to_string(inner_2) + ").");
+    }
+
+    std::vector<int> batch_shape_1(_shape_1.begin(), _shape_1.end() - 2);
+    std::vector<int> batch_shape_2(_shape_2.begin(), _shape_2.end() - 2);
+
+    std::vector<int> batch_shape = (batch_shape_1 == batch_shape_2) ? batch_shape_1 : Utils::BroadcastShape(batch_shape_1, batch_shape_2);
+
+    std::vector<int> result_shape = batch_shape;
+    result_shape.push_back(rows);
+    result_shape.push_back(columns);
+
+    if (_out.IsEmpty() || _out.shape != result_shape)
+    {
+        if (_beta != Compute(0))
+        {
+            throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: output must match the product's shape when beta != 0.");
+        }
+
+        _out.Resize(result_shape);
+    }
+
+    LinAlg::Gemm::Batch batch;
+    batch.shape = batch_shape;
+    batch.a_strides = Utils::BatchStrides(_shape_1, batch_shape);
+    batch.b_strides = Utils::BatchStrides(_shape_2, batch_shape);
+    batch.c_strides = Utils::BatchStrides(result_shape, batch_shape);
+
+    LinAlg::Gemm::BasicView<U> a{ _tensor_1.Data(), rows_1, columns_1, columns_1, 1 };
+    LinAlg::Gemm::BasicView<U> b{ _tensor_2.Data(), rows_2, columns_2, columns_2, 1 };
+    LinAlg::Gemm::BasicOutput<T> c{ _out.Data(), columns, 1 };
+
+    if constexpr (std::is_same_v<U, float> && std::is_same_v<T, float>)
+    {
+        LinAlg::Gemm::Multiply(a, _transpose_1, b, _transpose_2, c, batch, _accumulation, _alpha, _beta);
+    }
+    else
+    {
+        LinAlg::Gemm::Multiply(a, _transpose_1, b, _transpose_2, c, batch, _alpha, _beta);
+    }
+}
+
+// ========================================
+// Constructor(s)
+// ========================================
+template <TensorElement T>
+TypedTensor<T>::TypedTensor(const std::vector<int>& _shape, const T& _value)
+{
+    this->volume = TypedTensor::ShapeVolume(_shape);
+    this->shape = _shape;
+    this->data = std::make_shared<std::vector<T>>(this->volume, _value);
+}
+
+template <TensorElement T>
+TypedTensor<T>::TypedTensor(const std::vector<int>& _shape, const std::vector<T>& _data)
+{
+    this->volume = TypedTensor::ShapeVolume(_shape);
+
+    if (static_cast<int>(_data.size()) != this->volume)
+    {
+        throw std::invalid_argument("[TypedTensor] Construction failed: size of data must match the volume of shape.");
+    }
+
+    this->shape = _shape;
+    this->data = std::make_shared<std::vector<T>>(_data);
+}
+
+template <TensorElement T>
+TypedTensor<T>::TypedTensor(const Tensor& _tensor)
+{
+    if (_tensor.IsEmpty())
+    {
+        return;
+    }
+
+    this->shape = _tensor.Shape();
+    this->volume = _tensor.Volume();
+    this->data = std::make_shared<std::vector<T>>(this->volume);
+
+    TypedTensor::Copy(&*_tensor.begin(), this->data->data(), this->volume);
+}
+
+template <TensorElement T>
+TypedTensor<T>::TypedTensor(const TypedTensor& _tensor)
+{
+    this->shape = _tensor.shape;
+    this->volume = _tensor.volume;
+
+    if (_tensor.data != nullptr)
+    {
+        this->data = std::make_shared<std::vector<T>>(*_tensor.data);
+    }
+}
+
+template <TensorElement T>
+TypedTensor<T>::TypedTensor(TypedTensor&& _tensor) noexcept
+{
+    this->data = std::move(_tensor.data);
+    this->shape = std::move(_tensor.shape);
+    this->volume = _tensor.volume;
+
+    _tensor.volume = 0;
+}
+
+template <TensorElement T>
+TypedTensor<T>& TypedTensor<T>::operator=(const TypedTensor& _tensor)
+{
+    if (this != &_tensor)
+    {
+        *this = TypedTensor(_tensor);
+    }
+
+    return *this;
+}
+
+template <TensorElement T>
+TypedTensor<T>& TypedTensor<T>::operator=(TypedTensor&& _tensor) noexcept
+{
+    this->data = std::move(_tensor.data);
+    this->shape = std::move(_tensor.shape);
+    this->volume = _tensor.volume;
+
+    _tensor.volume = 0;
+
+    return *this;
+}
+
+// ========================================
+// Storage Method(s)
+// ========================================
+template <TensorElement T>
+typename TypedTensor<T>::iterator TypedTensor<T>::begin()
+{
+    return this->data->begin();
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::iterator TypedTensor<T>::end()
+{
+    return this->data->end();
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::const_iterator TypedTensor<T>::begin() const
+{
+    return this->data->cbegin();
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::const_iterator TypedTensor<T>::end() const
+{
+    return this->data->cend();
+}
+
+template <TensorElement T>
+T* TypedTensor<T>::Data()
+{
+    return (this->data != nullptr) ? this->data->data() : nullptr;
+}
+
+template <TensorElement T>
+const T* TypedTensor<T>::Data() const
+{
+    return (this->data != nullptr) ? this->data->data() : nullptr;
+}
+
+template <TensorElement T>
+void TypedTensor<T>::Resize(const std::vector<int>& _shape)
+{
+    if (this->data != nullptr && this->shape == _shape)
+    {
+        return;
+    }
+
+    int new_volume = TypedTensor::ShapeVolume(_shape);
+
+    if (this->data != nullptr && this->data.use_count() == 1)
+    {
+        this->data->resize(new_volume);
+    }
+    else
+    {
+        this->data = std::make_shared<std::vector<T>>(new_volume);
+    }
+
+    this->shape = _shape;
+    this->volume = new_volume;
+}
+
+// ========================================
+// Conversion Method(s)
+// ========================================
+template <TensorElement T>
+Tensor TypedTensor<T>::ToTensor() const
+{
+    if (this->IsEmpty())
+    {
+        return Tensor();
+    }
+
+    Tensor result(this->shape);
+    TypedTensor::Copy(this->Data(), &*result.begin(), this->volume);
+
+    return result;
+}
+
+template <TensorElement T>
+template <TensorElement U>
+TypedTensor<U> TypedTensor<T>::Cast() const
+{
+    TypedTensor<U> result;
+
+    if (this->IsEmpty())
+    {
+        return result;
+    }
+
+    result.Resize(this->shape);
+    TypedTensor::Copy(this->Data(), result.Data(), this->volume);
+
+    return result;
+}
+
+// ========================================
+// Arithmetic Method(s)
+// ========================================
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::Add(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out)
+{
+    TypedTensor::Elementwise(_tensor_1, _tensor_2, _out, [](Compute _x, Compute _y) { return _x + _y; });
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::Subtract(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out)
+{
+    TypedTensor::Elementwise(_tensor_1, _tensor_2, _out, [](Compute _x, Compute _y) { return _x - _y; });
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::Multiply(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out)
+{
+    TypedTensor::Elementwise(_tensor_1, _tensor_2, _out, [](Compute _x, Compute _y) { return _x * _y; });
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::Divide(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, TypedTensor<R>& _out)
+{
+    TypedTensor::Elementwise(_tensor_1, _tensor_2, _out, [](Compute _x, Compute _y) { return _x / _y; });
+}
+
+// ========================================
+// Matrix Product Method(s)
+// ========================================
+template <TensorElement T>
+TypedTensor<T> TypedTensor<T>::MatMul(const TypedTensor& _tensor_1, const TypedTensor& _tensor_2, const LinAlg::Gemm::Accumulation& _accumulation)
+    requires FloatingElement<T>
+{
+    TypedTensor result;
+    TypedTensor::MatMul(_tensor_1, _tensor_2, result, _accumulation);
+
+    return result;
+}
+
+template <TensorElement T>
+template <TensorElement U>
+    requires ProductOperand<U, T>
+void TypedTensor<T>::MatMul(const TypedTensor<U>& _tensor_1, const TypedTensor<U>& _tensor_2, TypedTensor& _out, const LinAlg::Gemm::Accumulation& _accumulation)
+{
+    if (_tensor_1.Rank() == 0 || _tensor_2.Rank() == 0)
+    {
+        throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: rank of tensor(s) must be > 0.");
+    }
+
+    if constexpr (std::is_same_v<U, T>)
+    {
+        if (_tensor_1.SharesData(_out) || _tensor_2.SharesData(_out))
+        {
+            throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: output cannot share storage with an operand.");
+        }
+    }
+
+    std::vector<int> shape_1 = _tensor_1.shape;
+    std::vector<int> shape_2 = _tensor_2.shape;
+
+    if (_tensor_1.Rank() == 1)
+    {
+        shape_1.insert(shape_1.begin(), 1);
+    }
+
+    if (_tensor_2.Rank() == 1)
+    {
+        shape_2.push_back(1);
+    }
+
+    TypedTensor::MatrixProduct(_tensor_1, shape_1, _tensor_2, shape_2, _out, false, false, _accumulation, Compute(1), Compute(0));
+}
+
+template <TensorElement T>
+template <TensorElement U>
+    requires ProductOperand<U, T>
+void TypedTensor<T>::MatMul(const TypedTensor<U>& _tensor_1, const TypedTensor<U>& _tensor_2, TypedTensor& _out, const bool& _transpose_1, const bool& _transpose_2, const LinAlg::Gemm::Accumulation& _accumulation, const Compute& _alpha, const Compute& _beta)
+{
+    if (_tensor_1.Rank() < 2 || _tensor_2.Rank() < 2)
+    {
+        throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: transposed operands must be of rank >= 2.");
+    }
+
+    if constexpr (std::is_same_v<U, T>)
+    {
+        if (_tensor_1.SharesData(_out) || _tensor_2.SharesData(_out))
+        {
+            throw std::invalid_argument("[TypedTensor] Matrix Multiplication failed: output cannot share storage with an operand.");
+        }
+    }
+
+    TypedTensor::MatrixProduct(_tensor_1, _tensor_1.shape, _tensor_2, _tensor_2.shape, _out, _transpose_1, _transpose_2, _accumulation, _alpha, _beta);
+}
+
+// ========================================
+// Reduction Method(s)
+// ========================================
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::ReduceSum(const int& _axis, TypedTensor<R>& _out) const
+{
+    this->Reduce(_axis, ReduceKind::Sum, _out);
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::ReduceMean(const int& _axis, TypedTensor<R>& _out) const
+{
+    this->Reduce(_axis, ReduceKind::Mean, _out);
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::ReduceMax(const int& _axis, TypedTensor<R>& _out) const
+{
+    this->Reduce(_axis, ReduceKind::Max, _out);
+}
+
+template <TensorElement T>
+template <TensorElement R>
+    requires ResultElement<R, T>
+void TypedTensor<T>::ReduceMin(const int& _axis, TypedTensor<R>& _out) const
+{
+    this->Reduce(_axis, ReduceKind::Min, _out);
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::Compute TypedTensor<T>::Sum() const
+    requires FloatingElement<T>
+{
+    if (this->IsEmpty() || this->volume == 0)
+    {
+        return Compute(0);
+    }
+
+    return static_cast<Compute>(TypedTensor::ReduceRange(this->Data(), this->volume, ReduceKind::Sum));
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::Compute TypedTensor<T>::Mean() const
+    requires FloatingElement<T>
+{
+    if (this->IsEmpty() || this->volume == 0)
+    {
+        throw std::runtime_error("[TypedTensor] Mean failed: invalid operation on empty tensor.");
+    }
+
+    return static_cast<Compute>(TypedTensor::ReduceRange(this->Data(), this->volume, ReduceKind::Mean));
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::Compute TypedTensor<T>::Max() const
+    requires FloatingElement<T>
+{
+    if (this->IsEmpty() || this->volume == 0)
+    {
+        throw std::runtime_error("[TypedTensor] Max failed: invalid operation on empty tensor.");
+    }
+
+    return static_cast<Compute>(TypedTensor::ReduceRange(this->Data(), this->volume, ReduceKind::Max));
+}
+
+template <TensorElement T>
+typename TypedTensor<T>::Compute TypedTensor<T>::Min() const
+    requires FloatingElement<T>
+{
+    if (this->IsEmpty() || this->volume == 0)
+    {
+        throw std::runtime_error("[TypedTensor] Min failed: invalid operation on empty tensor.");
+    }
+
+    return static_cast<Compute>(TypedTensor::ReduceRange(this->Data(), this->volume, ReduceKind::Min));
+}
+
+// ========================================
+// Property Method(s)
+// ========================================
+template <TensorElement T>
+int TypedTensor<T>::Rank() const
+{
+    return static_cast<int>(this->shape.size());
+}
+
+template <TensorElement T>
+int TypedTensor<T>::Volume() const
+{
+    return this->volume;
+}
+
+template <TensorElement T>
+std::vector<int> TypedTensor<T>::Shape() const
+{
+    return this->shape;
+}
+
+template <TensorElement T>
+bool TypedTensor<T>::IsEmpty() const
+{
+    return this->data == nullptr;
+}
+
+template <TensorElement T>
+std::vector<T> TypedTensor<T>::ToVector() const
+{
+    return (this->data != nullptr) ? *this->data : std::vector<T>();
+}
@@ -183,6 +183,29 @@ std::vector<int> Utils::BroadcastShape(const std::vector<int>& shape_1, const st
 	return broadcast_shape;
 }
 
+std::vector<long long> Utils::BatchStrides(const std::vector<int>& shape, const std::vector<int>& batch_shape)
+{
+	int batch_rank = static_cast<int>(batch_shape.size());
+	int own_rank = static_cast<int>(shape.size()) - 2;
+
+	std::vector<long long> strides(batch_rank, 0);
+	long long stride = static_cast<long long>(shape[own_rank]) * shape[own_rank + 1];
+
+	for (int d = 1; d <= own_rank; d++)
+	{
+		int extent = shape[own_rank - d];
+
+		if (extent != 1)
+		{
+			strides[batch_rank - d] = stride;
+		}
+
+		stride *= extent;
+	}
+
+	return strides;
+}
+
 std::vector<int> Utils::ConvolvedFeatureShape(const std::vector<int>& main_shape, const std::vector<int>& filter_shape, const std::vector<int>& strides)
 {
 	if (!Utils::IsConvolveCompatible(main_shape, filter_shape))
@@ -247,3 +270,85 @@ std::vector<int> Utils::FindRangeComplement(const std::vector<int>& nums, std::p
 
 	return result;
 }
+
+
+// ========================================
+// Parallel Execution Function(s)
+// ========================================
+void Utils::ParallelFor(int begin, int end, const std::function<void(int, int)>& body, int min_grain)
+{
+	int range = end - begin;
+	if (range <= 0)
+	{
+		return;
+	}
+
+	int grain = std::max(min_grain, 1);
+
+	// Ranges of one chunk run inline without querying the thread count,
+	// which is a system call on some platforms; small kernels hit this path
+	// on every call.
+	if (range <= grain)
+	{
+		body(begin, end);
+		return;
+	}
+
+	static const int hardware_threads = static_cast<int>(std::thread::hardware_concurrency());
+	int n_threads = std::min(std::max(hardware_threads, 1), (range + grain - 1) / grain);
+
+	if (n_threads <= 1)
+	{
+		body(begin, end);
+		return;
+	}
+
+	std::vector<std::thread> workers;
+	std::vector<std::exception_ptr> errors(n_threads);
+	workers.reserve(n_threads - 1);
+
+	int chunk = range / n_threads;
+	int remainder = range % n_threads;
+
+	auto run = [&](int t, int chunk_begin, int chunk_end)
+		{
+			try
+			{
+				body(chunk_begin, chunk_end);
+			}
+			catch (...)
+			{
+				errors[t] = std::current_exception();
+			}
+		};
+
+	int chunk_begin = begin;
+	for (int t = 0; t < n_threads; t++)
+	{
+		int chunk_end = chunk_begin + chunk + ((t < remainder) ? 1 : 0);
+
+		if (t == n_threads - 1)
+		{
+			run(t, chunk_begin, chunk_end);
+		}
+		else
+		{
+			workers.emplace_back(run, t, chunk_begin, chunk_end);
+		}
+
+		chunk_begin = chunk_end;
+	}
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	for (const auto& error : errors)
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+}
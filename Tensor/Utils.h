@@ -12,6 +12,7 @@
 #include <utility>
 #include <functional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 
 template<typename T>
@@ -456,6 +457,20 @@ namespace Utils
      */
     std::vector<int> BroadcastShape(const std::vector<int>& shape_1, const std::vector<int>& shape_2);
 
+    /**
+     * @brief Computes the element stride of each batch axis in a stack of matrices.
+     *
+     * @param shape Shape of the stack (rank >= 2; the last two axes are the matrix)
+     * @param batch_shape Broadcast batch shape the stack is read over
+     *
+     * @return std::vector<long long> One stride per axis of batch_shape
+     *
+     * @note Axes are right-aligned as in broadcasting
+     * @note Axes the stack lacks or holds with extent 1 get stride 0, so every
+     *       batch entry along them reads the same matrix
+     */
+    std::vector<long long> BatchStrides(const std::vector<int>& shape, const std::vector<int>& batch_shape);
+
     /**
      * @brief Computes output shape after applying convolution operation.
      *
@@ -490,6 +505,19 @@ namespace Utils
      * @note Example: nums = {1, 3, 5}, bounds = {0, 6} ? result = {0, 2, 4}
      */
     std::vector<int> FindRangeComplement(const std::vector<int>& nums, std::pair<int, int> bounds);
+
+    /**
+     * @brief Runs a range-based loop body across hardware threads.
+     *
+     * @param begin First index of the range (inclusive)
+     * @param end Last index of the range (exclusive)
+     * @param body Callable invoked as body(chunk_begin, chunk_end) on disjoint sub-ranges
+     * @param min_grain Minimum number of indices per chunk; small ranges run on the calling thread
+     *
+     * @note Chunks are contiguous and cover [begin, end) exactly once
+     * @note The first exception thrown by any chunk is rethrown on the calling thread
+     */
+    void ParallelFor(int begin, int end, const std::function<void(int, int)>& body, int min_grain = 1);
 }
 
 #include "Utils.inl"
\ No newline at end of file